@@ -69,10 +69,11 @@ endfunction(generate_c_headerfile)
 #   FALLBACK_FILE - if no files are found in "defs" using the name match, this file will be used instead.
 #   MATCH_SUFFIX - the suffix to match in the "defs" directory (optional)
 #   PREFIXES - a list of prefixes to match in the "defs" directory (optional)
+#   EXTRA_FILES - a list of files to include after all others, e.g. generated overrides (optional)
 #
 function(generate_config_includefile)
 
-    cmake_parse_arguments(GENCONFIG_ARG "" "OUTPUT_DIRECTORY;FILE_NAME;FALLBACK_FILE;MATCH_SUFFIX" "PREFIXES" ${ARGN} )
+    cmake_parse_arguments(GENCONFIG_ARG "" "OUTPUT_DIRECTORY;FILE_NAME;FALLBACK_FILE;MATCH_SUFFIX" "PREFIXES;EXTRA_FILES" ${ARGN} )
     if (NOT GENCONFIG_ARG_OUTPUT_DIRECTORY)
         set(GENCONFIG_ARG_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/inc")
     endif (NOT GENCONFIG_ARG_OUTPUT_DIRECTORY)
@@ -118,6 +119,12 @@ function(generate_config_includefile)
         message("ERROR: No implementation for ${GENCONFIG_ARG_FILE_NAME} found")
         message(FATAL_ERROR "Tested: ${CHECK_PATH_LIST}")
     endif()
+
+    # Extra files come last, so they can override the values above
+    foreach(SRC_LOCAL_PATH ${GENCONFIG_ARG_EXTRA_FILES})
+        file(TO_NATIVE_PATH "${SRC_LOCAL_PATH}" SRC_NATIVE_PATH)
+        list(APPEND WRAPPER_FILE_CONTENT "#include \"${SRC_NATIVE_PATH}\"\n")
+    endforeach()
     
     # Generate a header file
     generate_c_headerfile("${GENCONFIG_ARG_OUTPUT_DIRECTORY}/${GENCONFIG_ARG_FILE_NAME}" ${WRAPPER_FILE_CONTENT})
@@ -66,6 +66,7 @@ function(initialize_globals)
     # in the local environment.    
     set(SIMULATION $ENV{SIMULATION} CACHE STRING "Enable simulation mode using specified toolchain")
     set(ENABLE_UNIT_TESTS $ENV{ENABLE_UNIT_TESTS} CACHE BOOL "Enable build of unit tests")
+    set(ENABLE_UNIT_TEST_BENCHMARKS $ENV{ENABLE_UNIT_TEST_BENCHMARKS} CACHE BOOL "Enable build of unit test benchmarks")
   
     # Export values to parent level 
     set(MISSION_DEFS ${MISSION_SOURCE_DIR}/${MISSIONCONFIG}_defs CACHE PATH "Full path to mission definitions directory")
@@ -249,6 +250,7 @@ function(prepare)
     "MISSION_PSPMODULES" 
     "MISSION_DEPS"
     "ENABLE_UNIT_TESTS"
+    "ENABLE_UNIT_TEST_BENCHMARKS"
   )
   foreach(APP ${MISSION_DEPS})
     list(APPEND VARLIST "${APP}_MISSION_DIR")
@@ -0,0 +1,387 @@
+##################################################################
+#
+# cFE memory pool block size generator
+#
+# Computes memory pool block size tables from the allocation profiles
+# recorded on a target, and generates a header file which overrides the
+# CFE_PLATFORM_SB_MEM_BLOCK_SIZE_xx and CFE_PLATFORM_ES_MEM_BLOCK_SIZE_xx
+# values of the platform configuration.
+#
+# The input files are written by the ES "Write Memory Pool Profile"
+# command (CFE_ES_WRITE_MEM_POOL_PROFILE_CC).  Several files may be given
+# for the same pool, e.g. from different runs, and their size histograms
+# are added together.  The largest block size of the pool (the
+# CFE_PLATFORM_xx_MAX_BLOCK_SIZE value) is not changed.
+#
+# The block sizes chosen are the ones that minimize the total size of
+# the blocks used by the recorded requests, i.e. the memory lost to
+# internal fragmentation.  As the profile only records the largest
+# request within each range of sizes, all requests in a range are
+# assumed to be as large as the largest one.
+#
+# This file can be run directly as a tool:
+#
+#   cmake -DOUTPUT_FILE=<header> -DSB_POOL_PROFILES=<file;...> \
+#         -DES_POOL_PROFILES=<file;...> -P pool_blocksizes.cmake
+#
+# Or included by the build, which calls generate_pool_blocksizes_header().
+#
+# The optional POOL_BLOCKSIZE_ALIGN variable sets the granularity of the
+# generated sizes (default 4, matching CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN)
+#
+##################################################################
+
+# Number of configurable block sizes below the maximum, per pool
+set(POOL_BLOCKSIZE_COUNT 16)
+
+# Layout of the profile file
+# These are checked against the structures with compile time asserts
+# in cfe_es_task.c, so a change to the file format fails the FSW build
+set(POOL_PROFILE_FS_HEADER_SIZE 64)          # CFE_FS_Header_t
+set(POOL_PROFILE_FS_CONTENT_TYPE 63464531)   # "cFE1", in hex
+set(POOL_PROFILE_FS_SUBTYPE 24)              # CFE_FS_SubType_ES_POOL_PROFILE
+set(POOL_PROFILE_NUM_BLOCK_SIZES_OFFSET 16)  # CFE_ES_MemPoolProfile_t NumBlockSizes
+set(POOL_PROFILE_NUM_RANGES_OFFSET 24)       # CFE_ES_MemPoolProfile_t NumSizeRanges
+set(POOL_PROFILE_FIXED_SIZE 36)              # CFE_ES_MemPoolProfile_t up to BlockProfile
+set(POOL_PROFILE_BLOCK_SIZE 24)              # CFE_ES_BlockProfile_t, which starts with BlockSize
+set(POOL_PROFILE_RANGE_SIZE 12)              # CFE_ES_MemPoolSizeProfile_t
+set(POOL_PROFILE_RANGE_MAXSIZE_OFFSET 4)     # CFE_ES_MemPoolSizeProfile_t MaxSize
+set(POOL_PROFILE_RANGE_COUNT_OFFSET 8)       # CFE_ES_MemPoolSizeProfile_t Count
+
+# per bucket: CFE_ES_BlockProfile_t and a suggested size
+math(EXPR POOL_PROFILE_BUCKET_SIZE "${POOL_PROFILE_BLOCK_SIZE} + 4")
+
+##################################################################
+#
+# FUNCTION: pool_profile_get_uint32
+#
+# Extracts a 32 bit value from the hex dump of a file, at the given
+# byte offset, and stores it as a decimal number in OUTVAR.
+#
+function(pool_profile_get_uint32 HEXDATA_VAR BYTE_OFFSET IS_LITTLE_ENDIAN OUTVAR)
+
+  math(EXPR HEX_POS "${BYTE_OFFSET} * 2")
+  string(SUBSTRING "${${HEXDATA_VAR}}" ${HEX_POS} 8 HEX_WORD)
+  if (IS_LITTLE_ENDIAN)
+    string(REGEX REPLACE "^(..)(..)(..)(..)$" "\\4\\3\\2\\1" HEX_WORD "${HEX_WORD}")
+  endif (IS_LITTLE_ENDIAN)
+
+  # Converted by digit, as math(EXPR) does not accept hex input in older versions
+  set(HEX_DIGITS 0 1 2 3 4 5 6 7 8 9 a b c d e f)
+  set(VALUE 0)
+  foreach(HEX_IDX 0 1 2 3 4 5 6 7)
+    string(SUBSTRING "${HEX_WORD}" ${HEX_IDX} 1 HEX_CHAR)
+    list(FIND HEX_DIGITS "${HEX_CHAR}" DIGIT)
+    math(EXPR VALUE "${VALUE} * 16 + ${DIGIT}")
+  endforeach()
+
+  set(${OUTVAR} ${VALUE} PARENT_SCOPE)
+
+endfunction(pool_profile_get_uint32)
+
+##################################################################
+#
+# FUNCTION: pool_profile_load
+#
+# Reads a profile file and adds its size histogram to the lists named
+# by COUNT_LIST_VAR and MAXSIZE_LIST_VAR, which hold the request count and
+# largest requested size of each size range.  LARGEST_VAR is raised to the
+# largest block size of the pool, if smaller.
+#
+# The profile is written in the byte order of the target, which is
+# detected from the file size, as only one order gives a consistent layout.
+#
+function(pool_profile_load PROFILE_FILE COUNT_LIST_VAR MAXSIZE_LIST_VAR LARGEST_VAR)
+
+  file(READ "${PROFILE_FILE}" PROFILE_HEX HEX)
+  string(LENGTH "${PROFILE_HEX}" HEX_LENGTH)
+  math(EXPR FILE_SIZE "${HEX_LENGTH} / 2")
+  math(EXPR MIN_SIZE "${POOL_PROFILE_FS_HEADER_SIZE} + ${POOL_PROFILE_FIXED_SIZE} + ${POOL_PROFILE_BUCKET_SIZE}")
+  if (FILE_SIZE LESS MIN_SIZE)
+    message(FATAL_ERROR "${PROFILE_FILE}: file is too short to be a pool profile")
+  endif (FILE_SIZE LESS MIN_SIZE)
+
+  # The standard cFE file header is always big endian
+  string(SUBSTRING "${PROFILE_HEX}" 0 8 CONTENT_TYPE)
+  pool_profile_get_uint32(PROFILE_HEX 4 FALSE SUBTYPE)
+  if (NOT CONTENT_TYPE STREQUAL POOL_PROFILE_FS_CONTENT_TYPE OR
+      NOT SUBTYPE EQUAL POOL_PROFILE_FS_SUBTYPE)
+    message(FATAL_ERROR "${PROFILE_FILE}: not a cFE memory pool profile file")
+  endif()
+
+  math(EXPR NUM_RANGES_OFFSET "${POOL_PROFILE_FS_HEADER_SIZE} + ${POOL_PROFILE_NUM_RANGES_OFFSET}")
+  set(BYTE_ORDER_FOUND FALSE)
+  foreach(IS_LITTLE_ENDIAN TRUE FALSE)
+    if (NOT BYTE_ORDER_FOUND)
+      pool_profile_get_uint32(PROFILE_HEX ${NUM_RANGES_OFFSET} ${IS_LITTLE_ENDIAN} NUM_RANGES)
+      # Only consider a plausible number of ranges, this also avoids overflow below
+      if (NUM_RANGES GREATER 0 AND NUM_RANGES LESS 65536)
+        math(EXPR BUCKET_SPACE "${FILE_SIZE} - ${POOL_PROFILE_FS_HEADER_SIZE} - ${POOL_PROFILE_FIXED_SIZE} - (${NUM_RANGES} * ${POOL_PROFILE_RANGE_SIZE})")
+        math(EXPR BUCKET_REMAINDER "${BUCKET_SPACE} % ${POOL_PROFILE_BUCKET_SIZE}")
+        if (BUCKET_SPACE GREATER 0 AND BUCKET_REMAINDER EQUAL 0)
+          set(BYTE_ORDER_FOUND TRUE)
+          set(FILE_LITTLE_ENDIAN ${IS_LITTLE_ENDIAN})
+        endif()
+      endif()
+    endif (NOT BYTE_ORDER_FOUND)
+  endforeach()
+
+  if (NOT BYTE_ORDER_FOUND)
+    message(FATAL_ERROR "${PROFILE_FILE}: inconsistent pool profile file size")
+  endif (NOT BYTE_ORDER_FOUND)
+
+  math(EXPR MAX_BUCKETS "${BUCKET_SPACE} / ${POOL_PROFILE_BUCKET_SIZE}")
+
+  # All files for the same pool must be recorded with the same size ranges
+  set(COUNT_LIST ${${COUNT_LIST_VAR}})
+  set(MAXSIZE_LIST ${${MAXSIZE_LIST_VAR}})
+  list(LENGTH COUNT_LIST PREV_RANGES)
+  if (PREV_RANGES EQUAL 0)
+    foreach(RANGE_IDX RANGE 1 ${NUM_RANGES})
+      list(APPEND COUNT_LIST 0)
+      list(APPEND MAXSIZE_LIST 0)
+    endforeach()
+  elseif (NOT PREV_RANGES EQUAL NUM_RANGES)
+    message(FATAL_ERROR "${PROFILE_FILE}: has ${NUM_RANGES} size ranges, other profiles have ${PREV_RANGES}")
+  endif()
+
+  # The largest block is the last valid entry in the block profile array
+  math(EXPR NUM_BLOCK_SIZES_OFFSET "${POOL_PROFILE_FS_HEADER_SIZE} + ${POOL_PROFILE_NUM_BLOCK_SIZES_OFFSET}")
+  pool_profile_get_uint32(PROFILE_HEX ${NUM_BLOCK_SIZES_OFFSET} ${FILE_LITTLE_ENDIAN} NUM_BLOCK_SIZES)
+  if (NUM_BLOCK_SIZES EQUAL 0 OR NUM_BLOCK_SIZES GREATER MAX_BUCKETS)
+    message(FATAL_ERROR "${PROFILE_FILE}: invalid number of block sizes (${NUM_BLOCK_SIZES})")
+  endif()
+  math(EXPR LARGEST_OFFSET "${POOL_PROFILE_FS_HEADER_SIZE} + ${POOL_PROFILE_FIXED_SIZE} + ((${NUM_BLOCK_SIZES} - 1) * ${POOL_PROFILE_BLOCK_SIZE})")
+  pool_profile_get_uint32(PROFILE_HEX ${LARGEST_OFFSET} ${FILE_LITTLE_ENDIAN} FILE_LARGEST)
+  if (FILE_LARGEST GREATER ${${LARGEST_VAR}})
+    set(${LARGEST_VAR} ${FILE_LARGEST} PARENT_SCOPE)
+  endif()
+
+  # Add the size ranges, which are the last records in the file
+  math(EXPR RANGE_OFFSET "${FILE_SIZE} - (${NUM_RANGES} * ${POOL_PROFILE_RANGE_SIZE})")
+  math(EXPR LAST_RANGE "${NUM_RANGES} - 1")
+  foreach(RANGE_IDX RANGE ${LAST_RANGE})
+    math(EXPR FIELD_OFFSET "${RANGE_OFFSET} + ${POOL_PROFILE_RANGE_MAXSIZE_OFFSET}")
+    pool_profile_get_uint32(PROFILE_HEX ${FIELD_OFFSET} ${FILE_LITTLE_ENDIAN} MAXSIZE)
+    math(EXPR FIELD_OFFSET "${RANGE_OFFSET} + ${POOL_PROFILE_RANGE_COUNT_OFFSET}")
+    pool_profile_get_uint32(PROFILE_HEX ${FIELD_OFFSET} ${FILE_LITTLE_ENDIAN} COUNT)
+
+    if (COUNT GREATER 0)
+      list(GET COUNT_LIST ${RANGE_IDX} PREV_COUNT)
+      list(GET MAXSIZE_LIST ${RANGE_IDX} PREV_MAXSIZE)
+      math(EXPR COUNT "${COUNT} + ${PREV_COUNT}")
+      if (PREV_MAXSIZE GREATER MAXSIZE)
+        set(MAXSIZE ${PREV_MAXSIZE})
+      endif()
+      list(REMOVE_AT COUNT_LIST ${RANGE_IDX})
+      list(INSERT COUNT_LIST ${RANGE_IDX} ${COUNT})
+      list(REMOVE_AT MAXSIZE_LIST ${RANGE_IDX})
+      list(INSERT MAXSIZE_LIST ${RANGE_IDX} ${MAXSIZE})
+    endif (COUNT GREATER 0)
+
+    math(EXPR RANGE_OFFSET "${RANGE_OFFSET} + ${POOL_PROFILE_RANGE_SIZE}")
+  endforeach()
+
+  set(${COUNT_LIST_VAR} ${COUNT_LIST} PARENT_SCOPE)
+  set(${MAXSIZE_LIST_VAR} ${MAXSIZE_LIST} PARENT_SCOPE)
+
+endfunction(pool_profile_load)
+
+##################################################################
+#
+# FUNCTION: pool_blocksizes_compute
+#
+# Computes the POOL_BLOCKSIZE_COUNT block sizes, in ascending order, which
+# minimize the total block size used by the requests in the given profile
+# files.  The block sizes are stored in OUTVAR, and a description of the
+# result is stored in DESC_VAR.
+#
+# This is the same dynamic programming solution as
+# CFE_ES_GenPoolSuggestBlockSizes(): COST_<k>_<j> is the lowest total
+# for the requests up to range j, using k sizes of which the largest is
+# exactly the size of range j.  Requests in ranges after the last chosen
+# size use the largest (fixed) block size.
+#
+function(pool_blocksizes_compute PROFILE_LIST OUTVAR DESC_VAR)
+
+  if (NOT POOL_BLOCKSIZE_ALIGN)
+    set(POOL_BLOCKSIZE_ALIGN 4)
+  endif (NOT POOL_BLOCKSIZE_ALIGN)
+
+  set(COUNT_LIST)
+  set(MAXSIZE_LIST)
+  set(LARGEST 0)
+  foreach(PROFILE_FILE ${PROFILE_LIST})
+    pool_profile_load("${PROFILE_FILE}" COUNT_LIST MAXSIZE_LIST LARGEST)
+  endforeach()
+
+  # Collect the distinct sizes used, rounded up to the alignment
+  # Requests that need the largest block anyway are only counted
+  set(NUM_USED 0)
+  set(TOTAL_COUNT 0)
+  set(FIXED_COUNT 0)
+  set(PREV_SIZE 0)
+  list(LENGTH COUNT_LIST NUM_RANGES)
+  math(EXPR LAST_RANGE "${NUM_RANGES} - 1")
+  foreach(RANGE_IDX RANGE ${LAST_RANGE})
+    list(GET COUNT_LIST ${RANGE_IDX} COUNT)
+    list(GET MAXSIZE_LIST ${RANGE_IDX} SIZE)
+    if (COUNT GREATER 0)
+      math(EXPR SIZE "((${SIZE} + ${POOL_BLOCKSIZE_ALIGN} - 1) / ${POOL_BLOCKSIZE_ALIGN}) * ${POOL_BLOCKSIZE_ALIGN}")
+      math(EXPR TOTAL_COUNT "${TOTAL_COUNT} + ${COUNT}")
+      if (NOT SIZE LESS LARGEST)
+        math(EXPR FIXED_COUNT "${FIXED_COUNT} + ${COUNT}")
+      elseif (SIZE EQUAL PREV_SIZE)
+        math(EXPR USED_IDX "${NUM_USED} - 1")
+        math(EXPR USED_COUNT_${USED_IDX} "${USED_COUNT_${USED_IDX}} + ${COUNT}")
+      else ()
+        set(USED_SIZE_${NUM_USED} ${SIZE})
+        set(USED_COUNT_${NUM_USED} ${COUNT})
+        math(EXPR NUM_USED "${NUM_USED} + 1")
+        set(PREV_SIZE ${SIZE})
+      endif ()
+    endif (COUNT GREATER 0)
+  endforeach()
+
+  if (NUM_USED EQUAL 0)
+    message(FATAL_ERROR "No requests smaller than the largest block size (${LARGEST}) in: ${PROFILE_LIST}")
+  endif (NUM_USED EQUAL 0)
+
+  # ABOVE_j = number of requests after range j, which use the largest block if j is the last size
+  set(ABOVE 0)
+  set(USED_IDX ${NUM_USED})
+  while (USED_IDX GREATER 0)
+    math(EXPR USED_IDX "${USED_IDX} - 1")
+    set(ABOVE_${USED_IDX} ${ABOVE})
+    math(EXPR ABOVE "${ABOVE} + ${USED_COUNT_${USED_IDX}}")
+  endwhile ()
+  set(ALL_USED_COUNT ${ABOVE})
+
+  # Best solution so far, starting from using only the largest block
+  math(EXPR BEST_COST "${LARGEST} * ${ALL_USED_COUNT}")
+  set(BEST_K 0)
+  set(BEST_J 0)
+
+  set(MAX_K ${POOL_BLOCKSIZE_COUNT})
+  if (MAX_K GREATER NUM_USED)
+    set(MAX_K ${NUM_USED})
+  endif (MAX_K GREATER NUM_USED)
+
+  math(EXPR LAST_USED "${NUM_USED} - 1")
+  foreach(K RANGE 1 ${MAX_K})
+    math(EXPR PREV_K "${K} - 1")
+    math(EXPR FIRST_J "${K} - 1")
+    foreach(J RANGE ${FIRST_J} ${LAST_USED})
+      if (K EQUAL 1)
+        # All requests up to this range use this size
+        math(EXPR COST_${K}_${J} "${USED_SIZE_${J}} * (${ALL_USED_COUNT} - ${ABOVE_${J}})")
+      else (K EQUAL 1)
+        # Requests after the previous size, up to this range, use this size
+        math(EXPR LAST_I "${J} - 1")
+        unset(COST_${K}_${J})
+        foreach(I RANGE ${LAST_I})
+          if (DEFINED COST_${PREV_K}_${I})
+            math(EXPR COST "${COST_${PREV_K}_${I}} + (${USED_SIZE_${J}} * (${ABOVE_${I}} - ${ABOVE_${J}}))")
+            if (NOT DEFINED COST_${K}_${J} OR COST LESS COST_${K}_${J})
+              set(COST_${K}_${J} ${COST})
+              set(FROM_${K}_${J} ${I})
+            endif()
+          endif (DEFINED COST_${PREV_K}_${I})
+        endforeach()
+      endif (K EQUAL 1)
+
+      math(EXPR COST "${COST_${K}_${J}} + (${LARGEST} * ${ABOVE_${J}})")
+      if (COST LESS BEST_COST)
+        set(BEST_COST ${COST})
+        set(BEST_K ${K})
+        set(BEST_J ${J})
+      endif (COST LESS BEST_COST)
+    endforeach()
+  endforeach()
+
+  # Trace back the chosen sizes, largest first
+  set(SIZE_LIST)
+  set(K ${BEST_K})
+  set(J ${BEST_J})
+  while (K GREATER 0)
+    list(INSERT SIZE_LIST 0 ${USED_SIZE_${J}})
+    set(J ${FROM_${K}_${J}})
+    math(EXPR K "${K} - 1")
+  endwhile ()
+
+  # The platform configuration has a fixed number of sizes, so pad with
+  # copies of the smallest one.  The pool merges repeated sizes into a
+  # single bucket, so this does not add any buckets.
+  if (BEST_K EQUAL 0)
+    set(SIZE_LIST ${USED_SIZE_0})
+    set(BEST_K 1)
+  endif (BEST_K EQUAL 0)
+  list(GET SIZE_LIST 0 SMALLEST)
+  while (BEST_K LESS POOL_BLOCKSIZE_COUNT)
+    list(INSERT SIZE_LIST 0 ${SMALLEST})
+    math(EXPR BEST_K "${BEST_K} + 1")
+  endwhile ()
+
+  math(EXPR BEST_COST "${BEST_COST} + (${LARGEST} * ${FIXED_COUNT})")
+  math(EXPR AVG_SIZE "${BEST_COST} / ${TOTAL_COUNT}")
+
+  set(${OUTVAR} ${SIZE_LIST} PARENT_SCOPE)
+  set(${DESC_VAR} "${TOTAL_COUNT} requests, average block size ${AVG_SIZE}, largest block size ${LARGEST}" PARENT_SCOPE)
+
+endfunction(pool_blocksizes_compute)
+
+##################################################################
+#
+# FUNCTION: generate_pool_blocksizes_header
+#
+# Generates OUTPUT_FILE with the block sizes computed from the profiles
+# in SB_PROFILE_LIST and ES_PROFILE_LIST.  Either list may be empty,
+# in which case the platform configuration of that pool is not overridden.
+#
+# The generated file must be included after the platform configuration.
+#
+function(generate_pool_blocksizes_header OUTPUT_FILE SB_PROFILE_LIST ES_PROFILE_LIST)
+
+  set(FILE_GUARD "GENERATED_INCLUDE_CFE_POOL_BLOCKSIZES_H")
+  set(CONTENT "/* Generated header file.  Do not edit */\n\n#ifndef ${FILE_GUARD}\n#define ${FILE_GUARD}\n")
+
+  foreach(POOL SB ES)
+    if (${POOL}_PROFILE_LIST)
+      pool_blocksizes_compute("${${POOL}_PROFILE_LIST}" SIZE_LIST SIZE_DESC)
+      message(STATUS "Generated ${POOL} pool block sizes: ${SIZE_DESC}")
+
+      set(CONTENT "${CONTENT}\n/*\n * ${POOL} memory pool block sizes: ${SIZE_DESC}\n * Computed from:\n")
+      foreach(PROFILE_FILE ${${POOL}_PROFILE_LIST})
+        set(CONTENT "${CONTENT} *   ${PROFILE_FILE}\n")
+      endforeach()
+      set(CONTENT "${CONTENT} */\n")
+
+      set(SIZE_IDX 0)
+      foreach(SIZE ${SIZE_LIST})
+        math(EXPR SIZE_IDX "${SIZE_IDX} + 1")
+        if (SIZE_IDX LESS 10)
+          set(SIZE_IDX "0${SIZE_IDX}")
+        endif (SIZE_IDX LESS 10)
+        set(CONTENT "${CONTENT}#undef  CFE_PLATFORM_${POOL}_MEM_BLOCK_SIZE_${SIZE_IDX}\n")
+        set(CONTENT "${CONTENT}#define CFE_PLATFORM_${POOL}_MEM_BLOCK_SIZE_${SIZE_IDX}    ${SIZE}\n")
+      endforeach()
+    endif (${POOL}_PROFILE_LIST)
+  endforeach()
+
+  set(CONTENT "${CONTENT}\n#endif /* ${FILE_GUARD} */\n")
+
+  # Avoid updating the timestamp if the content is the same, so nothing is rebuilt
+  set(PREV_CONTENT)
+  if (EXISTS "${OUTPUT_FILE}")
+    file(READ "${OUTPUT_FILE}" PREV_CONTENT)
+  endif (EXISTS "${OUTPUT_FILE}")
+  if (NOT PREV_CONTENT STREQUAL CONTENT)
+    file(WRITE "${OUTPUT_FILE}" "${CONTENT}")
+  endif (NOT PREV_CONTENT STREQUAL CONTENT)
+
+endfunction(generate_pool_blocksizes_header)
+
+# When run as a script, generate the file given on the command line
+if (CMAKE_SCRIPT_MODE_FILE AND OUTPUT_FILE)
+  generate_pool_blocksizes_header("${OUTPUT_FILE}" "${SB_POOL_PROFILES}" "${ES_POOL_PROFILES}")
+endif (CMAKE_SCRIPT_MODE_FILE AND OUTPUT_FILE)
@@ -130,5 +130,9 @@
 #define CFE_SB_ALLSUBS_TLM_MID      CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_SB_ALLSUBS_TLM_MSG  /* 0x080D */
 #define CFE_SB_ONESUB_TLM_MID       CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_SB_ONESUB_TLM_MSG   /* 0x080E */
 #define CFE_ES_MEMSTATS_TLM_MID     CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_MEMSTATS_TLM_MSG /* 0x0810 */
+#define CFE_ES_PERF_STATS_TLM_MID   CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_PERF_STATS_TLM_MSG /* 0x0811 */
+#define CFE_ES_STARTUP_PROFILE_TLM_MID CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_STARTUP_PROFILE_TLM_MSG /* 0x0812 */
+#define CFE_ES_TASK_UTIL_TLM_MID    CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_TASK_UTIL_TLM_MSG /* 0x0813 */
+#define CFE_ES_GEN_COUNTER_TLM_MID  CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_GEN_COUNTER_TLM_MSG /* 0x0814 */
 
 #endif
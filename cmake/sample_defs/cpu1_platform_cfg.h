@@ -261,8 +261,12 @@
 **  \par Description:
 **       Software Bus Memory Pool Block Sizes
 **
+**       If memory pool profiles named cpu1_sb_pool_profile*.dat are present
+**       in the mission defs directory, the build replaces these values with
+**       sizes computed from the profiles (see cmake/pool_blocksizes.cmake).
+**
 **  \par Limits
-**       These sizes MUST be increasing and MUST be an integral multiple of 4.
+**       These sizes MUST NOT decrease and MUST be an integral multiple of 4.
 **       The number of block sizes defined cannot exceed
 **       #CFE_PLATFORM_ES_POOL_MAX_BUCKETS
 */
@@ -563,11 +567,13 @@
 **
 **  \par Description:
 **       Defines the maximum number of Generic Counters that can be registered.
+**       This covers both the counters registered by name and the counters
+**       registered by applications under their own name.
 **
 **  \par Limits
 **       This parameter has a lower limit of 1 and an upper limit of 65535.
 */
-#define CFE_PLATFORM_ES_MAX_GEN_COUNTERS    8
+#define CFE_PLATFORM_ES_MAX_GEN_COUNTERS    256
 
 
 /**
@@ -589,6 +595,77 @@
 */
 #define CFE_PLATFORM_ES_APP_SCAN_RATE 1000
 
+/**
+**  \cfeescfg Define ES Task CPU Utilization Sample Rate
+**
+**  \par Description:
+**       ES samples the CPU time used by each task this often, in milliseconds,
+**       from its background task.  The CPU utilization of each task is computed
+**       from the samples in a sliding window of #CFE_PLATFORM_ES_TASK_UTIL_WINDOW
+**       samples.  The CPU time and utilization are reported in #CFE_ES_TaskInfo_t
+**       and in the #CFE_ES_TaskUtilTlm_t packet, which is sent along with the ES
+**       housekeeping telemetry.
+**
+**       The CPU time of tasks is read through the PSP.  If the PSP does not
+**       support this, the CPU time and utilization are reported as 0.
+**
+**  \par Limits
+**       There is a lower limit of 100 and an upper limit of 20000 on this
+**       configuration paramater. millisecond units.
+*/
+#define CFE_PLATFORM_ES_TASK_UTIL_SAMPLE_MSEC       1000
+
+/**
+**  \cfeescfg Define ES Task CPU Utilization Window
+**
+**  \par Description:
+**       The number of CPU time samples over which the CPU utilization of each task
+**       is computed.  The window covers one sample period less than this number of
+**       periods of #CFE_PLATFORM_ES_TASK_UTIL_SAMPLE_MSEC, so the default of 11
+**       samples 1 second apart gives the utilization over the last 10 seconds.
+**       Each task keeps 8 bytes per sample.
+**
+**  \par Limits
+**       There is a lower limit of 2 and an upper limit of 100 on this
+**       configuration paramater.
+*/
+#define CFE_PLATFORM_ES_TASK_UTIL_WINDOW            11
+
+/**
+**  \cfeescfg Define Number of ES Background Worker Tasks
+**
+**  \par Description:
+**       The number of tasks that run the ES background jobs, such as the
+**       application table scan, the exception scan and the performance log
+**       and ER log file writes, as well as jobs submitted through
+**       #CFE_ES_SubmitBackgroundJob.  Each job is only run by one worker at
+**       a time, so with more than one worker a slow job (e.g. writing a
+**       large file) does not delay the other jobs.
+**
+**       The worker tasks use the #CFE_PLATFORM_ES_PERF_CHILD_PRIORITY and
+**       #CFE_PLATFORM_ES_PERF_CHILD_STACK_SIZE settings.
+**
+**  \par Limits
+**       There is a lower limit of 1 and an upper limit of 8 on this
+**       configuration parameter.
+*/
+#define CFE_PLATFORM_ES_BACKGROUND_WORKERS 2
+
+/**
+**  \cfeescfg Define Maximum Number of Submitted ES Background Jobs
+**
+**  \par Description:
+**       The maximum number of jobs that may be pending at once through
+**       #CFE_ES_SubmitBackgroundJob, in addition to the jobs that ES defines
+**       for itself.
+**
+**  \par Limits
+**       There is a lower limit of 1 and an upper limit of 64 on this
+**       configuration parameter.
+*/
+#define CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS 16
+
+
 
 /**
 **  \cfeescfg Define ES Application Kill Timeout
@@ -810,6 +887,32 @@
 */
 #define CFE_PLATFORM_ES_VOLATILE_STARTUP_FILE  "/ram/cfe_es_startup.scr"
 
+/**
+**  \cfeescfg Define Number of Startup App Load Worker Tasks
+**
+**  \par Description:
+**       Loading the app modules listed in the startup script can take a long
+**       time for large apps.  When this is nonzero, the modules of the apps are
+**       loaded by the ES startup task and this many additional worker tasks at
+**       the same time, which exit when the startup script is complete.
+**
+**       Each CFE_LIB entry in the script is loaded only after all of the
+**       entries before it, and before any of the entries after it, so an app
+**       may use any library listed above it in the script.  The main tasks of
+**       the apps are still created in the order of the script, once the
+**       modules of all apps up to the next library (or the end of the script)
+**       are loaded.
+**
+**       The worker tasks use the #CFE_PLATFORM_ES_START_TASK_PRIORITY and
+**       #CFE_PLATFORM_ES_DEFAULT_STACK_SIZE settings.  The OS module loader
+**       must allow modules to be loaded from several tasks at once.
+**
+**  \par Limits
+**       There is a lower limit of 0, where each app is loaded and started
+**       before the next entry in the script is read, and an upper limit of 16.
+*/
+#define CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS   2
+
 /**
 **  \cfeescfg Default Shell Filename
 **
@@ -948,6 +1051,34 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME    "/ram/cfe_es_perf.dat"
 
+/**
+**  \cfeescfg Default Performance Data Stream Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename that performance data
+**       is streamed to.  This filename is used only when no filename is specified
+**       in the command to start streaming performance data.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME  "/ram/cfe_es_perf_stream.dat"
+
+/**
+**  \cfeescfg Default Performance Trace Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       Performance Data as a trace file.  This filename is used only when no
+**       filename is specified in the command to write the trace file.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_PERF_TRACE_FILENAME   "/ram/cfe_es_perf_trace.json"
+
 
 /**
 **  \cfeescfg Default Critical Data Store Registry Filename
@@ -963,6 +1094,34 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_CDS_REG_DUMP_FILE     "/ram/cfe_cds_reg.log"
 
+/**
+**  \cfeescfg Default Memory Pool Profile Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store a
+**       memory pool allocation profile. This filename is used only when no
+**       filename is specified in the command to write the profile.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_POOL_PROFILE_FILE     "/ram/cfe_es_pool_profile.dat"
+
+/**
+**  \cfeescfg Default Startup Profile Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       startup profile. This filename is used only when no filename is
+**       specified in the command to write the profile.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_STARTUP_PROFILE_FILE  "/ram/cfe_es_startup_profile.dat"
+
 /**
 **  \cfeescfg Define Default System Log Mode following Power On Reset
 **
@@ -1135,6 +1294,123 @@
 */
 #define CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS             50
 
+/**
+**  \cfeescfg Lock-free Performance Log Entries
+**
+**  \par Description:
+**       When set to true, #CFE_ES_PerfLogEntry and #CFE_ES_PerfLogExit store
+**       entries in the performance log using atomic operations, instead of
+**       taking the performance data mutex.  This avoids blocking or
+**       rescheduling the calling task while performance data is collected,
+**       which would otherwise change the timing that is being measured.
+**
+**       The commands which reset or read the log still take the mutex, and
+**       then wait for any lock-free writer which is adding an entry to finish.
+**
+**       This has no effect if the compiler does not provide atomic operations,
+**       in which case the mutex is always used.
+**
+**  \par Limits
+**       Must be true or false.  The default is false.
+*/
+#define CFE_PLATFORM_ES_PERF_LOCKFREE                      false
+
+/**
+**  \cfeescfg Lock-free Task Context Lookup
+**
+**  \par Description:
+**       When set to true, #CFE_ES_GetAppID and #CFE_ES_GetTaskID read the
+**       calling task's record without taking the ES shared data lock,
+**       using a generation count in the record to detect a concurrent
+**       change.  These are called by other cFE services on most requests,
+**       so this avoids contention on the ES lock between apps.  If the
+**       record is changing or does not match, the lock is taken as before.
+**
+**       This has no effect if the compiler does not provide atomic operations,
+**       in which case the lock is always taken.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_TASK_CONTEXT_LOCKFREE              true
+
+/**
+**  \cfeescfg Performance Marker Statistics
+**
+**  \par Description:
+**       When set to true, #CFE_ES_PerfLogEntry and #CFE_ES_PerfLogExit also
+**       keep statistics for each performance marker: the number of times the
+**       marker was exited after being entered by the same task, the minimum,
+**       maximum and mean time between the entry and exit, and a histogram of
+**       these times.
+**       These are kept at all times, independently of the performance log
+**       state and filter mask, and no individual entries are stored.  They
+**       are reported in the #CFE_ES_PerfStatsTlm_t packet, which is sent along
+**       with the ES housekeeping telemetry.
+**
+**       This adds a timer read and a few arithmetic operations to every
+**       marker entry and exit.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_PERF_MARKER_STATS                  true
+
+/**
+**  \cfeescfg High Resolution Performance Log Timestamps
+**
+**  \par Description:
+**       When set to true, performance log entries are timestamped with a
+**       64 bit count of nanoseconds from the PSP high resolution timebase,
+**       CFE_PSP_GetHighResTimebase(), instead of the PSP timebase, and also
+**       hold the number of the CPU which recorded the entry, from
+**       CFE_PSP_GetCpuNumber().  If the PSP does not implement these, the
+**       PSP timebase is still used, and CPU 0 is recorded.
+**
+**       The timestamp is stored in the TimerUpper32 and TimerLower32 fields
+**       with a lower 32 bit rollover of 0 and 1000000000 ticks per second,
+**       as given in the performance log metadata, so the existing timestamp
+**       calculations still apply.  The entries are
+**       4 bytes larger, which is indicated by a perf data Version of 2 in
+**       the performance log metadata.
+**
+**  \par Limits
+**       Must be true or false.  Changing this changes the layout of the
+**       performance log in the reset area, so a power-on reset is needed.
+*/
+#define CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS              false
+
+/**
+**  \cfeescfg Define Performance Data Stream Number of Entries Between Delay
+**
+**  \par Description:
+**       This parameter defines the number of performance analyzer entries the
+**       background task will write to the stream output between delays of
+**       #CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY.  This limits the rate at which
+**       performance data can be streamed, so it should be high enough to keep
+**       up with the rate at which entries are recorded.  Otherwise entries
+**       are overwritten before being written, and are reported as lost.
+**
+**  \par Limits
+**       Must be greater than zero.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_ENTRIES_BTWN_DLYS      1000
+
+/**
+**  \cfeescfg Define Number of Performance Data Stream Files
+**
+**  \par Description:
+**       When a performance data stream is split into files of a fixed number
+**       of entries, this parameter defines the number of files that are
+**       kept.  The files are named by appending ".0", ".1", etc. to the stream
+**       filename, and the oldest file is overwritten once this number of files
+**       has been written.
+**
+**  \par Limits
+**       Must be between 1 and 1000.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES              4
+
 /**
 **  \cfeescfg Define Default Stack Size for an Application
 **
@@ -1151,6 +1427,22 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_STACK_SIZE 8192
 
+/**
+**  \cfeescfg Define CPU Affinity of the cFE Core Applications
+**
+**  \par Description:
+**       Defines the CPUs that the main tasks of the cFE Core Applications may run
+**       on, as a mask with one bit per CPU (bit 0 is CPU 0).  Keeping them on a
+**       fixed set of CPUs keeps their data in those CPUs' caches.
+**
+**       0 means the tasks may run on any CPU, as placed by the OS.
+**
+**  \par Limits
+**       Only CPUs which exist on the platform should be included.  The mask is
+**       not applied on operating systems which do not support CPU affinity.
+*/
+#define CFE_PLATFORM_ES_CORE_APP_CPU_AFFINITY              0
+
 /**
 **  \cfeescfg Define EVS Task Priority
 **
@@ -1304,6 +1596,54 @@
 */
 #define CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES           512
 
+/**
+**  \cfeescfg Keep a RAM Shadow of the CDS
+**
+**  \par Description:
+**       When set to true, ES keeps a copy of the CDS blocks in RAM.  Writes
+**       to a CDS block update the RAM copy and record the range of the block
+**       which was changed, and reads are served from the RAM copy.  The
+**       changed ranges are written to the CDS by the ES background task
+**       every #CFE_PLATFORM_ES_CDS_SHADOW_FLUSH_MSEC milliseconds, and
+**       before a commanded processor reset.
+**
+**       This is useful where CDS memory is slow to access, but data written
+**       since the last flush is lost if the processor resets unexpectedly.
+**
+**  \par Limits
+**       Must be true or false.  When true, this uses an additional
+**       #CFE_PLATFORM_ES_CDS_SIZE bytes of RAM.
+*/
+#define CFE_PLATFORM_ES_CDS_SHADOW                    false
+
+/**
+**  \cfeescfg Define CDS RAM Shadow Flush Period
+**
+**  \par Description:
+**       The period, in milliseconds, at which changed CDS blocks are written
+**       from the RAM shadow to the CDS.  Only used when
+**       #CFE_PLATFORM_ES_CDS_SHADOW is true.
+**
+**  \par Limits
+**       There is a lower limit of 1.  This is also the longest time for which
+**       data written to the CDS may be lost on an unexpected reset.
+*/
+#define CFE_PLATFORM_ES_CDS_SHADOW_FLUSH_MSEC         1000
+
+/**
+**  \cfeescfg Define CDS Rebuild Read-Ahead Size
+**
+**  \par Description:
+**       When the CDS is recovered after a processor reset, the memory pool is
+**       rebuilt by walking the block descriptors in the CDS.  Rather than
+**       reading each descriptor individually, ES reads this many bytes of
+**       the CDS at a time and takes the descriptors from that copy.
+**
+**  \par Limits
+**       There is a lower limit of 64.  This many bytes of RAM are used by ES.
+*/
+#define CFE_PLATFORM_ES_CDS_READAHEAD_SIZE            4096
+
 
 /**
 **  \cfeescfg Define Number of Processor Resets Before a Power On Reset
@@ -1336,6 +1676,70 @@
  */
 #define CFE_PLATFORM_ES_POOL_MAX_BUCKETS      17
 
+/** \cfeescfg Use buddy allocation for ES memory pools
+**
+**  \par Description:
+**      When set to true, memory pools created through the ES pool API
+**      (including the SB and TBL pools) use power-of-two block spans that are
+**      split on allocation and merged with their buddy when freed.  This allows
+**      memory released from one block size to be reused for another, at the cost
+**      of some internal fragmentation due to rounding up to the next span.
+**      The number of split or merge steps per call is bounded by the number of
+**      spans, so allocation time remains deterministic.
+**
+**      When false, pools use the fixed size buckets in which a block, once
+**      created, only ever holds requests of its own size.
+**
+**      The Critical Data Store pool is not affected by this setting.
+**
+**  \par Limits:
+**       Must be true or false.  The ES/SB block size lists still determine
+**       the smallest and largest span in buddy mode.
+ */
+#define CFE_PLATFORM_ES_MEMPOOL_BUDDY_MODE    false
+
+/** \cfeescfg Use lock-free free lists for ES memory pools
+**
+**  \par Description:
+**      When set to true, memory pools created with a mutex (including the SB
+**      and TBL pools) keep their lists of returned blocks as lock-free stacks
+**      updated with atomic compare-exchange operations.  Returning a block and
+**      recycling a previously returned block then do not take the pool mutex,
+**      which reduces contention between tasks sharing a pool on multicore
+**      targets.  The mutex is still used when a new block must be created.
+**
+**      This requires compiler support for atomic operations and a CPU that
+**      supports 64 bit atomic operations without a lock.  If either is not
+**      available, or if #CFE_PLATFORM_ES_MEMPOOL_BUDDY_MODE is enabled, or
+**      the pool is larger than 4GB, the pool falls back to using the mutex
+**      for all operations.
+**
+**  \par Limits:
+**       Must be true or false.
+ */
+#define CFE_PLATFORM_ES_MEMPOOL_LOCKFREE      false
+
+/** \cfeescfg Record allocation profiles for ES memory pools
+**
+**  \par Description:
+**      When set to true, every memory pool records the distribution of
+**      requested sizes, the peak number of blocks of each size that were in
+**      use at the same time, and the requested bytes held by blocks in use.
+**      This information can be written to a file with the
+**      #CFE_ES_WRITE_MEM_POOL_PROFILE_CC command, which also suggests a block
+**      size table (e.g. for the CFE_PLATFORM_SB_MEM_BLOCK_SIZE_xx values)
+**      based on the recorded requests.
+**
+**      When false, the profile is not updated and the command outputs
+**      only the block counts.  This saves the atomic counter updates in
+**      every pool allocation and release, so this should only be enabled
+**      while profiling.
+**
+**  \par Limits:
+**       Must be true or false.
+ */
+#define CFE_PLATFORM_ES_MEMPOOL_PROFILE       false
+
 /** \cfeescfg Maximum number of memory pools
 **
 **  \par Description:
@@ -1365,8 +1769,12 @@
 **       inappropriate for their use, they may wish to use the #CFE_ES_PoolCreateEx
 **       API to specify their own intermediate block sizes
 **
+**       If memory pool profiles named cpu1_es_pool_profile*.dat are present
+**       in the mission defs directory, the build replaces these values with
+**       sizes computed from the profiles (see cmake/pool_blocksizes.cmake).
+**
 **  \par Limits
-**       These sizes MUST be increasing and MUST be an integral multiple of 4.  Also,
+**       These sizes MUST NOT decrease and MUST be an integral multiple of 4.  Also,
 **       CFE_PLATFORM_ES_MAX_BLOCK_SIZE must be larger than CFE_MISSION_SB_MAX_SB_MSG_SIZE and both
 **       CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE and CFE_PLATFORM_TBL_MAX_DBL_TABLE_SIZE.  Note that if Table
 **       Services have been removed from the CFE, the table size limits are still
@@ -1757,13 +2165,15 @@
 **      During startup, some tasks may need to synchronize their own initialization
 **      with the initialization of other applications in the system.
 **
-**      CFE ES implements an API to accomplish this, that performs a task delay (sleep)
-**      while polling the overall system state until other tasks are ready.
+**      CFE ES implements an API to accomplish this.  The waiting tasks pend on a
+**      semaphore which ES flushes whenever the system state or the state of an
+**      application changes, so they wake up as soon as other tasks are ready.
 **
-**      This value controls the amount of time that the CFE_ES_ApplicationSyncDelay
-**      will sleep between each check of the system state.  This should be large enough
-**      to allow other tasks to run, but not so large as to noticeably delay the startup
-**      completion.
+**      This value is the longest time that a waiting task will pend before it
+**      checks the system state again anyway.  This only matters if a notification
+**      is missed, or if the semaphore could not be created, in which case this is
+**      the polling interval.  This should be large enough to allow other tasks to
+**      run, but not so large as to noticeably delay the startup completion.
 **
 **      Units are in milliseconds
 **
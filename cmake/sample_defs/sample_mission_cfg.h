@@ -274,7 +274,8 @@
 /** \{ */
 #define CFE_MISSION_ES_CRC_8   1  /**< \brief CRC ( 8 bit additive - returns 32 bit total) (Currently not implemented) */
 #define CFE_MISSION_ES_CRC_16  2  /**< \brief CRC (16 bit additive - returns 32 bit total) */
-#define CFE_MISSION_ES_CRC_32  3  /**< \brief CRC (32 bit additive - returns 32 bit total) (Currently not implemented) */
+#define CFE_MISSION_ES_CRC_32  3  /**< \brief CRC-32 (IEEE 802.3 polynomial, as used by zlib) */
+#define CFE_MISSION_ES_CRC_32C 4  /**< \brief CRC-32C (Castagnoli polynomial, uses CPU CRC32 instructions where available) */
 /** \} */
 
 /**
@@ -285,8 +286,14 @@
 **      for verifying the contents of Critical Data Stores and when calculating
 **      Table Image data integrity values.
 **
+**      CFE_MISSION_ES_CRC_32C is the fastest where the processor implements
+**      the CRC32 instructions (x86 with SSE4.2, or ARMv8 built with the CRC
+**      extension enabled), and is computed in software elsewhere.
+**
 **  \par Limits
-**      Currently only CFE_MISSION_ES_CRC_16 is supported (see #CFE_MISSION_ES_CRC_16)
+**      Must be CFE_MISSION_ES_CRC_16, CFE_MISSION_ES_CRC_32 or CFE_MISSION_ES_CRC_32C.
+**      Changing this invalidates the CRCs stored in an existing CDS, so a
+**      power-on reset is needed.
 */
 #define CFE_MISSION_ES_DEFAULT_CRC  CFE_MISSION_ES_CRC_16
 
@@ -380,6 +387,10 @@
 #define CFE_MISSION_SB_ONESUB_TLM_MSG         14
 #define CFE_MISSION_ES_SHELL_TLM_MSG          15
 #define CFE_MISSION_ES_MEMSTATS_TLM_MSG       16
+#define CFE_MISSION_ES_PERF_STATS_TLM_MSG     17
+#define CFE_MISSION_ES_STARTUP_PROFILE_TLM_MSG 18
+#define CFE_MISSION_ES_TASK_UTIL_TLM_MSG      19
+#define CFE_MISSION_ES_GEN_COUNTER_TLM_MSG    20
 
 /**
 **  \cfeescfg Mission Max Apps in a message
@@ -459,6 +470,63 @@
 */
 #define CFE_MISSION_ES_PERF_MAX_IDS                  128
 
+/**
+**  \cfeescfg Define Max Number of Performance Markers in a Statistics Message
+**
+**  \par Description:
+**       Defines the number of performance markers whose statistics are reported
+**       in each performance marker statistics telemetry message.  Markers that
+**       have statistics are reported in turn, this many at a time.
+**
+**      This affects the layout of command/telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+*/
+#define CFE_MISSION_ES_PERF_STATS_MAX_MARKERS        4
+
+/**
+**  \cfeescfg Define Max Number of Tasks in a CPU Utilization Message
+**
+**  \par Description:
+**       Defines the number of tasks whose CPU time and utilization are reported
+**       in each task CPU utilization telemetry message.  The registered tasks
+**       are reported in turn, this many at a time.
+**
+**      This affects the layout of command/telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+*/
+#define CFE_MISSION_ES_TASK_UTIL_MAX_TASKS           8
+
+/**
+**  \cfeescfg Define Max Number of Generic Counters in a Snapshot Message
+**
+**  \par Description:
+**       Defines the number of generic counters reported in each generic
+**       counter snapshot telemetry message.  A snapshot of all registered
+**       counters is sent as a series of these messages, this many at a time.
+**
+**      This affects the layout of command/telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+*/
+#define CFE_MISSION_ES_GEN_COUNTER_SNAPSHOT_MAX_COUNTERS 16
+
 /** \cfeescfg Maximum number of block sizes in pool structures
 **
 **  \par Description:
@@ -612,6 +680,27 @@
 */
 #define CFE_MISSION_ES_CDS_MAX_FULL_NAME_LEN       (CFE_MISSION_ES_CDS_MAX_NAME_LENGTH + CFE_MISSION_MAX_API_LEN + 4)
 
+/**
+**  \cfeescfg Maximum Length of Full Generic Counter Name in messages
+**
+**  \par Description:
+**      Indicates the maximum length (in characters) of the entire name of a
+**      generic counter, including counters registered by an application
+**      which are of the following form: "ApplicationName.CounterName"
+**
+**       This affects the layout of command/telemetry messages but does not affect run
+**       time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+**       This value should be kept as a multiple of 4, to maintain alignment of
+**       any possible neighboring fields without implicit padding.
+*/
+#define CFE_MISSION_ES_GEN_COUNTER_MAX_FULL_NAME_LEN (CFE_MISSION_MAX_API_LEN * 2)
+
 
 
 #endif /* _cfe_mission_cfg_ */
@@ -8,6 +8,25 @@
 # 
 ###########################################################
 
+# If memory pool profiles were recorded for this platform, generate
+# block sizes tuned to them, overriding those in the platform config
+set(SB_POOL_PROFILE_LIST)
+set(ES_POOL_PROFILE_LIST)
+foreach(PREFIX ${BUILD_CONFIG})
+    file(GLOB PROFILE_FILES "${MISSION_DEFS}/${PREFIX}_sb_pool_profile*.dat")
+    list(APPEND SB_POOL_PROFILE_LIST ${PROFILE_FILES})
+    file(GLOB PROFILE_FILES "${MISSION_DEFS}/${PREFIX}_es_pool_profile*.dat")
+    list(APPEND ES_POOL_PROFILE_LIST ${PROFILE_FILES})
+endforeach()
+
+set(PLATFORM_CFG_OVERRIDES)
+if (SB_POOL_PROFILE_LIST OR ES_POOL_PROFILE_LIST)
+    include("${CFE_SOURCE_DIR}/cmake/pool_blocksizes.cmake")
+    generate_pool_blocksizes_header("${CMAKE_BINARY_DIR}/inc/cfe_pool_blocksizes.h"
+        "${SB_POOL_PROFILE_LIST}" "${ES_POOL_PROFILE_LIST}")
+    list(APPEND PLATFORM_CFG_OVERRIDES "${CMAKE_BINARY_DIR}/inc/cfe_pool_blocksizes.h")
+endif (SB_POOL_PROFILE_LIST OR ES_POOL_PROFILE_LIST)
+
 # Generate the "cfe_platform_cfg.h" and "cfe_msgids.h" header files
 # these must come from mission config
 
@@ -15,6 +34,7 @@ generate_config_includefile(
     FILE_NAME           "cfe_platform_cfg.h" 
     MATCH_SUFFIX        "platform_cfg.h"
     PREFIXES            ${BUILD_CONFIG}
+    EXTRA_FILES         ${PLATFORM_CFG_OVERRIDES}
 )
 
 generate_config_includefile(
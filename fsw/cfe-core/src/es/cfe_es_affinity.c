@@ -0,0 +1,68 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File: cfe_es_affinity.c
+**
+** Purpose: This file contains the function which restricts a task to a set
+**  of CPUs, for the CPU affinity of app main tasks and child tasks.
+**
+**  OSAL does not provide a CPU affinity for tasks, so each new task applies
+**  its own affinity through the PSP when it starts, before running the app
+**  or child task code.  If the PSP does not support CPU affinity on this
+**  system, CFE_ES_NOT_IMPLEMENTED is returned.
+**
+**  This is a separate file so that the ES unit test can replace it with
+**  a stub.
+**
+*/
+
+/*
+** Include Section
+*/
+
+#include "private/cfe_private.h"
+#include "cfe_es.h"
+#include "cfe_es_apps.h"
+#include "cfe_psp.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_SetTaskAffinity                                                  */
+/*                                                                               */
+/* Purpose: Restricts the calling task to the CPUs in the mask, one bit per CPU  */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_SetTaskAffinity(uint32 CpuAffinity)
+{
+    int32 PspStatus;
+
+    PspStatus = CFE_PSP_SetTaskCpuAffinity(CpuAffinity);
+    if (PspStatus == CFE_PSP_ERROR_NOT_IMPLEMENTED)
+    {
+        return CFE_ES_NOT_IMPLEMENTED;
+    }
+
+    if (PspStatus != CFE_PSP_SUCCESS)
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    return CFE_SUCCESS;
+}
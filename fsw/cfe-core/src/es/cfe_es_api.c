@@ -43,8 +43,10 @@
 #include "cfe_es_events.h"
 #include "cfe_es_cds.h"
 #include "cfe_es_cds_mempool.h"
+#include "cfe_es_crc.h"
 #include "cfe_es_task.h"
 #include "cfe_es_resource.h"
+#include "cfe_es_start.h"
 #include "cfe_psp.h"
 #include "cfe_es_log.h"
 
@@ -119,6 +121,15 @@ int32 CFE_ES_ResetCFE(uint32 ResetType)
            CFE_ES_WriteToERLog(CFE_ES_LogEntryType_CORE, CFE_PSP_RST_TYPE_PROCESSOR,
                                        CFE_PSP_RST_SUBTYPE_RESET_COMMAND,
                                        "PROCESSOR RESET called from CFE_ES_ResetCFE (Commanded).");
+
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+           /*
+           ** The CDS is preserved over a processor reset, so
+           ** write any changes still held in the RAM shadow
+           */
+           CFE_ES_CDSShadowFlush();
+#endif
+
            /*
            ** Call the BSP reset routine
            */
@@ -473,6 +484,7 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
 bool CFE_ES_RunLoop(uint32 *RunStatus)
 {
     bool   ReturnCode;
+    bool   StateChanged;
     CFE_ES_AppRecord_t *AppRecPtr;
 
     /*
@@ -502,6 +514,7 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         return false;
     }
 
+    StateChanged = false;
     CFE_ES_LockSharedData(__func__,__LINE__);
 
     /*
@@ -516,6 +529,8 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         if (AppRecPtr->AppState < CFE_ES_AppState_RUNNING)
         {
             AppRecPtr->AppState = CFE_ES_AppState_RUNNING;
+            CFE_ES_StartupProfileMarkAppState(CFE_ES_AppRecordGetID(AppRecPtr), CFE_ES_AppState_RUNNING);
+            StateChanged = true;
         }
 
         /*
@@ -550,6 +565,12 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
 
     CFE_ES_UnlockSharedData(__func__,__LINE__);
 
+    if (StateChanged)
+    {
+        /* wake up any tasks waiting for this app to be running */
+        CFE_ES_StartupSyncNotify();
+    }
+
     return(ReturnCode);
 
 } /* End of CFE_ES_RunLoop() */
@@ -562,8 +583,8 @@ int32 CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMillisecond
     int32 Status = CFE_SUCCESS;
     CFE_ES_AppRecord_t *AppRecPtr;
     uint32 RequiredAppState;
-    uint32 WaitTime;
     uint32 WaitRemaining;
+    bool StateChanged;
 
     /*
      * Calling app is assumed to have completed its own initialization up to the point
@@ -571,6 +592,7 @@ int32 CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMillisecond
      *
      * Determine the implicit app state based on the system state it is indicating
      */
+    StateChanged = false;
     CFE_ES_LockSharedData(__func__,__LINE__);
 
     /*
@@ -617,38 +639,33 @@ int32 CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMillisecond
         if (AppRecPtr->AppState < RequiredAppState)
         {
             AppRecPtr->AppState = RequiredAppState;
+            CFE_ES_StartupProfileMarkAppState(CFE_ES_AppRecordGetID(AppRecPtr), RequiredAppState);
+            StateChanged = true;
         }
 
     }
     CFE_ES_UnlockSharedData(__func__,__LINE__);
 
+    if (StateChanged)
+    {
+        /* wake up the main task, if it is waiting for this app */
+        CFE_ES_StartupSyncNotify();
+    }
+
     /*
-     * Do the actual delay loop.
-     *
-     * This is only dependent on the main (startup) task updating the global variable
-     * to be at least the state requested.
+     * Wait for the main (startup) task to update the global variable
+     * to be at least the state requested.  The main task notifies
+     * waiters whenever it changes the state, so this wakes up without
+     * any polling delay.
      */
     WaitRemaining = TimeOutMilliseconds;
     while (CFE_ES_Global.SystemState < MinSystemState)
     {
-        /* TBD: Very Crude timing here, but not sure if it matters,
-         * as this is only done during startup, not real work */
-        if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
-        {
-            WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
-        }
-        else if (WaitRemaining > 0)
+        Status = CFE_ES_StartupSyncWait(&WaitRemaining);
+        if (Status != CFE_SUCCESS)
         {
-            WaitTime = WaitRemaining;
-        }
-        else
-        {
-            Status = CFE_ES_OPERATION_TIMED_OUT;
             break;
         }
-
-        OS_TaskDelay(WaitTime);
-        WaitRemaining -= WaitTime;
     }
 
     return Status;
@@ -812,8 +829,18 @@ CFE_Status_t CFE_ES_GetTaskIDByName(CFE_ES_TaskId_t *TaskIdPtr, const char *Task
 int32 CFE_ES_GetAppID(CFE_ES_AppId_t *AppIdPtr)
 {
    CFE_ES_AppRecord_t *AppRecPtr;
+   CFE_ES_TaskId_t TaskId;
    int32 Result;
 
+   /*
+   ** This is called by other services on most requests, so first try
+   ** reading the calling task's record without the lock
+   */
+   if (CFE_ES_GetTaskContextLockFree(&TaskId, AppIdPtr))
+   {
+       return CFE_SUCCESS;
+   }
+
    CFE_ES_LockSharedData(__func__,__LINE__);
 
    AppRecPtr = CFE_ES_GetAppRecordByContext();
@@ -842,6 +869,13 @@ int32 CFE_ES_GetTaskID(CFE_ES_TaskId_t *TaskIdPtr)
 {
     int32 Result;
     CFE_ES_TaskRecord_t *TaskRecPtr;
+    CFE_ES_AppId_t AppId;
+
+    /* As in CFE_ES_GetAppID(), first try without the lock */
+    if (CFE_ES_GetTaskContextLockFree(TaskIdPtr, &AppId))
+    {
+        return CFE_SUCCESS;
+    }
 
     CFE_ES_LockSharedData(__func__,__LINE__);
     TaskRecPtr = CFE_ES_GetTaskRecordByContext();
@@ -1021,6 +1055,7 @@ int32 CFE_ES_GetAppInfo(CFE_ES_AppInfo_t *AppInfo, CFE_ES_AppId_t AppId)
        AppInfo->StackSize = AppRecPtr->StartParams.StackSize;
        AppInfo->ExceptionAction = AppRecPtr->StartParams.ExceptionAction;
        AppInfo->Priority = AppRecPtr->StartParams.Priority;
+       AppInfo->CpuAffinity = AppRecPtr->StartParams.CpuAffinity;
        AppInfo->MainTaskId = AppRecPtr->MainTaskId;
 
        ModuleId = AppRecPtr->ModuleInfo.ModuleId;
@@ -1163,6 +1198,7 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t TaskId)
 {
     CFE_ES_TaskRecord_t *TaskRecPtr;
     CFE_ES_AppRecord_t *AppRecPtr;
+    uint64 CpuTimeUsec;
     int32  Status;
 
     if ( TaskInfo == NULL )
@@ -1206,6 +1242,19 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t TaskId)
         */
         TaskInfo->ExecutionCounter =  TaskRecPtr->ExecutionCounter;
 
+        /*
+        ** Get the CPUs the task may run on
+        */
+        TaskInfo->CpuAffinity = TaskRecPtr->CpuAffinity;
+
+        /*
+        ** Get the CPU time and utilization of the task
+        */
+        CpuTimeUsec = CFE_ES_TaskRecordGetCpuTime(TaskRecPtr);
+        TaskInfo->CpuTimeSeconds = (uint32)(CpuTimeUsec / 1000000);
+        TaskInfo->CpuTimeMicroseconds = (uint32)(CpuTimeUsec % 1000000);
+        TaskInfo->CpuUtilization = TaskRecPtr->CpuUtilization;
+
         /*
         ** Get the Application Details
         */
@@ -1243,6 +1292,23 @@ int32 CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr,
                         CFE_ES_TaskPriority_Atom_t  Priority,
                         uint32  Flags)
 {
+   return CFE_ES_CreateChildTaskWithAffinity(TaskIdPtr, TaskName, FunctionPtr,
+           StackPtr, StackSize, Priority, 0);
+
+} /* End of CFE_ES_CreateChildTask() */
+
+
+/*
+** Function: CFE_ES_CreateChildTaskWithAffinity - See API and header file for details
+*/
+int32 CFE_ES_CreateChildTaskWithAffinity(CFE_ES_TaskId_t *TaskIdPtr,
+                        const char   *TaskName,
+                        CFE_ES_ChildTaskMainFuncPtr_t   FunctionPtr,
+                        CFE_ES_StackPointer_t StackPtr,
+                        size_t  StackSize,
+                        CFE_ES_TaskPriority_Atom_t  Priority,
+                        uint32  CpuAffinity)
+{
 
    int32          Result;
    CFE_ES_AppRecord_t *AppRecPtr;
@@ -1304,8 +1370,12 @@ int32 CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr,
          {
             /*
             ** Step 2: Create the new task using the OS API call
+            **
+            ** OSAL cannot set the CPU affinity of the task or read its
+            ** CPU time, so the task is started through an intermediate
+            ** entry point which sets these up from the task table.
             */
-            Result = OS_TaskCreate(&OsalId, TaskName, FunctionPtr, StackPtr,
+            Result = OS_TaskCreate(&OsalId, TaskName, CFE_ES_ChildTaskEntryPoint, StackPtr,
                                 StackSize, Priority, OS_FP_ENABLED );
 
             /*
@@ -1316,10 +1386,20 @@ int32 CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr,
                LocalChildTaskId = CFE_ES_TaskId_FromOSAL(OsalId);
                TaskRecPtr = CFE_ES_LocateTaskRecordByID(LocalChildTaskId);
 
-               CFE_ES_TaskRecordSetUsed(TaskRecPtr, CFE_RESOURCEID_UNWRAP(LocalChildTaskId));
+               /*
+               ** The new task may already be running, so the
+               ** entry is only marked as used once it is filled in
+               */
                TaskRecPtr->AppId = CFE_ES_AppRecordGetID(AppRecPtr);
                strncpy(TaskRecPtr->TaskName,TaskName,sizeof(TaskRecPtr->TaskName) - 1);
                TaskRecPtr->TaskName[sizeof(TaskRecPtr->TaskName) - 1] = '\0';
+               TaskRecPtr->EntryFunc = FunctionPtr;
+               TaskRecPtr->CpuAffinity = CpuAffinity;
+               TaskRecPtr->CpuClock.IsValid = false;
+               TaskRecPtr->NumCpuTimeSamples = 0;
+               TaskRecPtr->CpuUtilization = 0;
+               TaskRecPtr->CpuUtilWindowMsec = 0;
+               CFE_ES_TaskRecordSetUsed(TaskRecPtr, CFE_RESOURCEID_UNWRAP(LocalChildTaskId));
                CFE_ES_Global.RegisteredTasks++;
 
                *TaskIdPtr = CFE_ES_TaskRecordGetID(TaskRecPtr);
@@ -1346,7 +1426,7 @@ int32 CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr,
 
    return(ReturnCode);
 
-} /* End of CFE_ES_CreateChildTask() */
+} /* End of CFE_ES_CreateChildTaskWithAffinity() */
 
 
 /*
@@ -1607,12 +1687,10 @@ int32 CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
     va_end(ArgPtr);
 
     /*
-     * Append to the syslog buffer, which must be done while locked.
-     * Only one thread can actively write into the buffer at time.
+     * Append to the syslog buffer.  This only takes the lock
+     * when the message does not fit before the end of the buffer.
      */
-    CFE_ES_LockSharedData(__func__, __LINE__);
-    ReturnCode = CFE_ES_SysLogAppend_Unsync(TmpString);
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    ReturnCode = CFE_ES_SysLogAppend(TmpString);
 
     /* Output the entry to the console */
     OS_printf("%s",TmpString);
@@ -1627,70 +1705,23 @@ int32 CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
 */
 uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC)
 {
-    uint32  i;
-    int16  Index;
-    int16  Crc = 0;
-    const uint8 *BufPtr;
-    uint8  ByteValue;
-
-    static const uint16 CrcTable[256]=
-    {
-
-		    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
-		    0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
-		    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
-		    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
-		    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
-		    0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
-		    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
-		    0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
-		    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
-		    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
-		    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
-		    0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
-		    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
-		    0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
-		    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
-		    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
-		    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
-		    0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
-		    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
-		    0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
-		    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
-		    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
-		    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
-		    0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
-		    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
-		    0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
-		    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
-		    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
-		    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
-		    0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
-		    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
-		    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
-
-    };
+    uint32  Crc = 0;
 
     switch(TypeCRC)
     {
       case CFE_MISSION_ES_CRC_32:
-           CFE_ES_WriteToSysLog("CFE ES Calculate CRC32 not Implemented\n");
+      case CFE_MISSION_ES_CRC_32C:
+           /* The register is inverted before and after, so the InputCRC for the first block is 0 */
+           Crc = ~CFE_ES_CrcRawUpdate(TypeCRC, ~InputCRC, DataPtr, DataLength);
            break;
 
       case CFE_MISSION_ES_CRC_16:
-           Crc    =  (int16 )( 0xFFFF & InputCRC );
-           BufPtr = (const uint8 *)DataPtr;
+           Crc = CFE_ES_CrcRawUpdate(TypeCRC, 0xFFFF & InputCRC, DataPtr, DataLength);
 
-           for ( i = 0 ; i < DataLength ; i++,  BufPtr++)
+           /* The CRC-16 has always been returned sign extended from 16 bits */
+           if ((Crc & 0x8000) != 0)
            {
-              /*
-               * It is assumed that the supplied buffer is in a
-               * directly-accessible memory space that does not
-               * require special logic to access
-               */
-              ByteValue = *BufPtr;
-              Index = ( ( Crc ^ ByteValue) & 0x00FF);
-              Crc = ( (Crc >> 8 ) & 0x00FF) ^ CrcTable[Index];
+              Crc |= 0xFFFF0000;
            }
            break;
 
@@ -1878,6 +1909,22 @@ int32 CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy)
     return CFE_ES_CDSBlockWrite(Handle, DataToCopy);
 } /* End of CFE_ES_CopyToCDS() */
 
+/*
+** Function: CFE_ES_CopyToCDSRange
+**
+** Purpose:  Copies part of a data block to a Critical Data Store.
+**
+*/
+int32 CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size)
+{
+    if (DataToCopy == NULL || Size == 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    return CFE_ES_CDSBlockWriteRange(Handle, DataToCopy, Offset, Size);
+} /* End of CFE_ES_CopyToCDSRange() */
+
 /*
 ** Function: CFE_ES_RestoreFromCDS
 **
@@ -1890,27 +1937,17 @@ int32 CFE_ES_RestoreFromCDS(void *RestoreToMemory, CFE_ES_CDSHandle_t Handle)
 } /* End of CFE_ES_RestoreFromCDS() */
 
 /*
-** Function: CFE_ES_RegisterGenCounter
+** Function: CFE_ES_CreateGenCounter
 **
-** Purpose:  Allocates a generic counter resource and assigns ID
+** Purpose:  Allocates a generic counter resource under the given full name
+**           and assigns ID.  Local helper for the register functions.
 */
-int32 CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *CounterName)
+static int32 CFE_ES_CreateGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *CounterName, CFE_ES_AppId_t OwnerAppId)
 {
    CFE_ES_GenCounterRecord_t *CountRecPtr;
    CFE_ResourceId_t PendingResourceId;
    int32 Status;
 
-   if (CounterName == NULL || CounterIdPtr == NULL)
-   {
-       return CFE_ES_BAD_ARGUMENT;
-   }
-
-   if (strlen(CounterName) >= sizeof(CountRecPtr->CounterName))
-   {
-       return CFE_ES_BAD_ARGUMENT;
-   }
-
-
    CFE_ES_LockSharedData(__func__,__LINE__);
 
    /*
@@ -1926,7 +1963,7 @@ int32 CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *Co
    else
    {
        /* scan for a free slot */
-       PendingResourceId = CFE_ResourceId_FindNext(CFE_ES_Global.LastCounterId, CFE_PLATFORM_ES_MAX_GEN_COUNTERS, CFE_ES_CheckCounterIdSlotUsed);
+       PendingResourceId = CFE_ResourceId_FindNextFree(CFE_ES_Global.LastCounterId, CFE_PLATFORM_ES_MAX_GEN_COUNTERS, CFE_ES_Global.CounterSlotMap, CFE_ES_CheckCounterIdSlotUsed);
        CountRecPtr = CFE_ES_LocateCounterRecordByID(CFE_ES_COUNTERID_C(PendingResourceId));
 
        if (CountRecPtr == NULL)
@@ -1936,10 +1973,9 @@ int32 CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *Co
        }
        else
        {
-           strncpy(CountRecPtr->CounterName,CounterName,
-                   sizeof(CountRecPtr->CounterName) - 1);
-           CountRecPtr->CounterName[sizeof(CountRecPtr->CounterName) - 1] = '\0';
-           CountRecPtr->Counter = 0;
+           CFE_ES_CounterRecordSetName(CountRecPtr, CounterName);
+           CountRecPtr->OwnerAppId = OwnerAppId;
+           CFE_ES_AtomicStore32(&CountRecPtr->Counter, 0);
            CFE_ES_CounterRecordSetUsed(CountRecPtr, PendingResourceId);
            CFE_ES_Global.LastCounterId = PendingResourceId;
            Status = CFE_SUCCESS;
@@ -1951,7 +1987,71 @@ int32 CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *Co
    *CounterIdPtr = CFE_ES_COUNTERID_C(PendingResourceId);
    return Status;
 
-}
+} /* End of CFE_ES_CreateGenCounter() */
+
+/*
+** Function: CFE_ES_RegisterGenCounter
+**
+** Purpose:  Allocates a generic counter resource and assigns ID
+*/
+int32 CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *CounterName)
+{
+   if (CounterName == NULL || CounterIdPtr == NULL)
+   {
+       return CFE_ES_BAD_ARGUMENT;
+   }
+
+   if (strlen(CounterName) >= OS_MAX_API_NAME)
+   {
+       return CFE_ES_BAD_ARGUMENT;
+   }
+
+   return CFE_ES_CreateGenCounter(CounterIdPtr, CounterName, CFE_ES_APPID_UNDEFINED);
+
+} /* End of CFE_ES_RegisterGenCounter() */
+
+/*
+** Function: CFE_ES_RegisterAppGenCounter
+**
+** Purpose:  Allocates a generic counter resource named after the calling
+**           app, of the form "AppName.CounterName", and assigns ID
+*/
+int32 CFE_ES_RegisterAppGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *CounterName)
+{
+   CFE_ES_AppId_t ThisAppId;
+   char AppName[OS_MAX_API_NAME];
+   char FullName[CFE_MISSION_ES_GEN_COUNTER_MAX_FULL_NAME_LEN];
+   int32 Status;
+
+   if (CounterName == NULL || CounterIdPtr == NULL)
+   {
+       return CFE_ES_BAD_ARGUMENT;
+   }
+
+   *CounterIdPtr = CFE_ES_COUNTERID_UNDEFINED;
+
+   if (CounterName[0] == '\0' || strlen(CounterName) >= OS_MAX_API_NAME)
+   {
+       return CFE_ES_BAD_ARGUMENT;
+   }
+
+   Status = CFE_ES_GetAppID(&ThisAppId);
+   if (Status == CFE_SUCCESS)
+   {
+       Status = CFE_ES_GetAppName(AppName, ThisAppId, sizeof(AppName));
+   }
+
+   if (Status != CFE_SUCCESS)
+   {
+       CFE_ES_WriteToSysLog("CFE_ES_RegisterAppGenCounter: Bad AppId context\n");
+       return Status;
+   }
+
+   snprintf(FullName, sizeof(FullName), "%s.%s", AppName, CounterName);
+
+   return CFE_ES_CreateGenCounter(CounterIdPtr, FullName, ThisAppId);
+
+} /* End of CFE_ES_RegisterAppGenCounter() */
 
 /*
 ** Function: CFE_ES_DeleteGenCounter
@@ -1970,7 +2070,7 @@ int32 CFE_ES_DeleteGenCounter(CFE_ES_CounterId_t CounterId)
       CFE_ES_LockSharedData(__func__,__LINE__);
       if (CFE_ES_CounterRecordIsMatch(CountRecPtr, CounterId))
       {
-          CountRecPtr->Counter = 0;
+          CFE_ES_AtomicStore32(&CountRecPtr->Counter, 0);
           CFE_ES_CounterRecordSetFree(CountRecPtr);
           Status = CFE_SUCCESS;
       }
@@ -1982,24 +2082,52 @@ int32 CFE_ES_DeleteGenCounter(CFE_ES_CounterId_t CounterId)
 } /* End of CFE_ES_DeleteGenCounter() */
 
 /*
-** Function: CFE_ES_IncrementGenCounter
+** Function: CFE_ES_AddGenCounter
 **
-** Purpose:  Increment a Generic Counter.
+** Purpose:  Add an amount to a Generic Counter.
 **
+** Where atomic operations are available the count is updated without
+** taking the ES lock, so counters are cheap to update from any task.
+** Otherwise the update is done under the lock, so that no update is lost.
 */
-int32 CFE_ES_IncrementGenCounter(CFE_ES_CounterId_t CounterId)
+int32 CFE_ES_AddGenCounter(CFE_ES_CounterId_t CounterId, uint32 Amount)
 {
    int32 Status = CFE_ES_BAD_ARGUMENT;
    CFE_ES_GenCounterRecord_t *CountRecPtr;
 
    CountRecPtr = CFE_ES_LocateCounterRecordByID(CounterId);
+#if CFE_ES_ATOMIC_AVAILABLE
    if(CFE_ES_CounterRecordIsMatch(CountRecPtr, CounterId))
    {
-       ++CountRecPtr->Counter;
+       CFE_ES_AtomicAdd32(&CountRecPtr->Counter, Amount);
        Status = CFE_SUCCESS;
    }
+#else
+   if(CountRecPtr != NULL)
+   {
+       CFE_ES_LockSharedData(__func__,__LINE__);
+       if(CFE_ES_CounterRecordIsMatch(CountRecPtr, CounterId))
+       {
+           CountRecPtr->Counter += Amount;
+           Status = CFE_SUCCESS;
+       }
+       CFE_ES_UnlockSharedData(__func__,__LINE__);
+   }
+#endif
    return Status;
 
+} /* End of CFE_ES_AddGenCounter() */
+
+/*
+** Function: CFE_ES_IncrementGenCounter
+**
+** Purpose:  Increment a Generic Counter.
+**
+*/
+int32 CFE_ES_IncrementGenCounter(CFE_ES_CounterId_t CounterId)
+{
+   return CFE_ES_AddGenCounter(CounterId, 1);
+
 } /* End of CFE_ES_IncrementGenCounter() */
 
 /*
@@ -2014,11 +2142,24 @@ int32 CFE_ES_SetGenCount(CFE_ES_CounterId_t CounterId, uint32 Count)
    CFE_ES_GenCounterRecord_t *CountRecPtr;
 
    CountRecPtr = CFE_ES_LocateCounterRecordByID(CounterId);
+#if CFE_ES_ATOMIC_AVAILABLE
    if(CFE_ES_CounterRecordIsMatch(CountRecPtr, CounterId))
    {
-      CountRecPtr->Counter = Count;
+      CFE_ES_AtomicStore32(&CountRecPtr->Counter, Count);
       Status = CFE_SUCCESS;
    }
+#else
+   if(CountRecPtr != NULL)
+   {
+      CFE_ES_LockSharedData(__func__,__LINE__);
+      if(CFE_ES_CounterRecordIsMatch(CountRecPtr, CounterId))
+      {
+         CountRecPtr->Counter = Count;
+         Status = CFE_SUCCESS;
+      }
+      CFE_ES_UnlockSharedData(__func__,__LINE__);
+   }
+#endif
    return Status;
 } /* End of CFE_ES_SetGenCount() */
 
@@ -2037,7 +2178,7 @@ int32 CFE_ES_GetGenCount(CFE_ES_CounterId_t CounterId, uint32 *Count)
    if(CFE_ES_CounterRecordIsMatch(CountRecPtr, CounterId) &&
            Count != NULL)
    {
-      *Count = CountRecPtr->Counter;
+      *Count = CFE_ES_AtomicLoad32(&CountRecPtr->Counter);
       Status = CFE_SUCCESS;
    }
    return Status;
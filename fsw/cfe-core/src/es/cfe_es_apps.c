@@ -42,18 +42,15 @@
 #include "cfe_es_global.h"
 #include "cfe_es_task.h"
 #include "cfe_es_apps.h"
+#include "cfe_es_start.h"
 #include "cfe_es_log.h"
 #include "cfe_es_resource.h"
+#include "cfe_es_atomic.h"
 
 #include <stdio.h>
 #include <string.h> /* memset() */
 #include <fcntl.h>
 
-/*
-** Defines
-*/
-#define ES_START_BUFF_SIZE 128
-
 /*
 **
 **  Global Variables
@@ -76,14 +73,10 @@
 */
 void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath )
 {
-   char ES_AppLoadBuffer[ES_START_BUFF_SIZE];  /* A buffer of for a line in a file */
-   const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
-   uint32      NumTokens;
-   uint32      BuffLen;                            /* Length of the current buffer */
+   char        ReadBuffer[CFE_ES_STARTSCRIPT_READ_SIZE];  /* A block of the file */
+   CFE_ES_StartScriptParser_t Parser;
    osal_id_t   AppFile;
    int32       Status;
-   char        c;
-   bool        LineTooLong = false;
    bool        FileOpened = false;
 
    /*
@@ -141,18 +134,20 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath )
    */
    if ( FileOpened == true)
    {
-      memset(ES_AppLoadBuffer,0x0,ES_START_BUFF_SIZE);
-      BuffLen = 0;
-      NumTokens = 0;
-      TokenList[0] = ES_AppLoadBuffer;
+      /*
+      ** Start the workers which load the apps in parallel, if enabled
+      */
+      CFE_ES_StartupLoadInit();
+
+      CFE_ES_StartScriptParserInit(&Parser);
 
       /*
-      ** Parse the lines from the file. If it has an error
-      ** or reaches EOF, then abort the loop.
+      ** Parse the file a block at a time. If it has an error,
+      ** reaches EOF or the end of the script, then abort the loop.
       */
       while(1)
       {
-         Status = OS_read(AppFile, &c, 1);
+         Status = OS_read(AppFile, ReadBuffer, sizeof(ReadBuffer));
          if ( Status < 0 )
          {
             CFE_ES_WriteToSysLog ("ES Startup: Error Reading Startup file. EC = 0x%08X\n",(unsigned int)Status);
@@ -165,84 +160,12 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath )
             */
             break;
          }
-         else if(c != '!')
-         {
-             if ( c <= ' ')
-             {
-                /*
-                ** Skip all white space in the file
-                */
-                ;
-             }
-             else if ( c == ',' )
-             {
-                /*
-                ** replace the field delimiter with a null
-                ** This is used to separate the tokens
-                */
-                if ( BuffLen < ES_START_BUFF_SIZE )
-                {
-                   ES_AppLoadBuffer[BuffLen] = 0;
-                }
-                else
-                {
-                   LineTooLong = true;
-                }
-                BuffLen++;
-
-                if ( NumTokens < (CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE-1))
-                {
-                    /*
-                     * NOTE: pointer never deferenced unless "LineTooLong" is false.
-                     */
-                    ++NumTokens;
-                    TokenList[NumTokens] = &ES_AppLoadBuffer[BuffLen];
-                }
-             }
-             else if ( c != ';' )
-             {
-                /*
-                ** Regular data gets copied in
-                */
-                if ( BuffLen < ES_START_BUFF_SIZE )
-                {
-                   ES_AppLoadBuffer[BuffLen] = c;
-                }
-                else
-                {
-                   LineTooLong = true;
-                }
-                BuffLen++;
-             }
-             else
-             {
-                if ( LineTooLong == true )
-                {
-                   /*
-                   ** The was too big for the buffer
-                   */
-                   CFE_ES_WriteToSysLog ("ES Startup: ES Startup File Line is too long: %u bytes.\n",(unsigned int)BuffLen);
-                   LineTooLong = false;
-                }
-                else
-                {
-                   /*
-                   ** Send the line to the file parser
-                   ** Ensure termination of the last token and send it along
-                   */
-                   ES_AppLoadBuffer[BuffLen] = 0;
-                   CFE_ES_ParseFileEntry(TokenList, 1 + NumTokens);
-                }
-                BuffLen = 0;
-                NumTokens = 0;
-             }
-         }
-         else
+         else if ( CFE_ES_StartScriptParse(&Parser, ReadBuffer, Status) )
          {
-           /*
-           ** break when EOF character '!' is reached
-           */
-           break;
+            /*
+            ** break when EOF character '!' is reached
+            */
+            break;
          }
       }
       /*
@@ -250,9 +173,133 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath )
       */
       OS_close(AppFile);
 
+      /*
+      ** Start the apps which are still loading, and stop the workers
+      */
+      CFE_ES_StartupLoadCleanup();
+
    }
 }
 
+/*
+** Name:
+**   CFE_ES_StartApplicationsFromBuffer
+**
+** Purpose:
+**   This routine loads/starts cFE applications from a startup script in memory.
+**
+*/
+void CFE_ES_StartApplicationsFromBuffer(const char *ScriptBuffer, size_t ScriptSize)
+{
+   CFE_ES_StartScriptParser_t Parser;
+
+   CFE_ES_StartupLoadInit();
+
+   CFE_ES_StartScriptParserInit(&Parser);
+   CFE_ES_StartScriptParse(&Parser, ScriptBuffer, ScriptSize);
+
+   CFE_ES_StartupLoadCleanup();
+}
+
+/*
+** Name:
+**   CFE_ES_StartScriptParserInit
+**
+** Purpose:
+**   This routine resets the startup script parser to the start of a script.
+**
+*/
+void CFE_ES_StartScriptParserInit(CFE_ES_StartScriptParser_t *ParserPtr)
+{
+   memset(ParserPtr, 0, sizeof(*ParserPtr));
+}
+
+/*
+** Name:
+**   CFE_ES_StartScriptParse
+**
+** Purpose:
+**   This routine splits a block of the startup script into lines and tokens,
+**   and passes each complete line to CFE_ES_ParseFileEntry.
+**
+*/
+bool CFE_ES_StartScriptParse(CFE_ES_StartScriptParser_t *ParserPtr, const char *Buffer, size_t BufferSize)
+{
+   const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
+   size_t      Pos;
+   uint32      i;
+   char        c;
+
+   for (Pos = 0; Pos < BufferSize && !ParserPtr->IsEndOfScript; ++Pos)
+   {
+      c = Buffer[Pos];
+
+      if ( c == '!' )
+      {
+         /*
+         ** The EOF character '!' ends the script
+         */
+         ParserPtr->IsEndOfScript = true;
+      }
+      else if ( c <= ' ')
+      {
+         /*
+         ** Skip all white space in the file
+         */
+         ;
+      }
+      else if ( c == ';' )
+      {
+         if ( ParserPtr->LineLength >= sizeof(ParserPtr->LineBuffer) )
+         {
+            /*
+            ** The line was too big for the buffer
+            */
+            CFE_ES_WriteToSysLog ("ES Startup: ES Startup File Line is too long: %u bytes.\n",
+                  (unsigned int)ParserPtr->LineLength);
+         }
+         else
+         {
+            /*
+            ** Send the line to the file parser
+            ** Ensure termination of the last token and send it along
+            */
+            ParserPtr->LineBuffer[ParserPtr->LineLength] = 0;
+            for (i = 0; i <= ParserPtr->NumTokens; ++i)
+            {
+               TokenList[i] = &ParserPtr->LineBuffer[ParserPtr->TokenStart[i]];
+            }
+            CFE_ES_ParseFileEntry(TokenList, 1 + ParserPtr->NumTokens);
+         }
+         ParserPtr->LineLength = 0;
+         ParserPtr->NumTokens = 0;
+      }
+      else
+      {
+         /*
+         ** Regular data gets copied in, and the field delimiter
+         ** is replaced with a null to separate the tokens
+         */
+         if ( ParserPtr->LineLength < sizeof(ParserPtr->LineBuffer) )
+         {
+            ParserPtr->LineBuffer[ParserPtr->LineLength] = (c == ',') ? 0 : c;
+         }
+         ++ParserPtr->LineLength;
+
+         if ( c == ',' && ParserPtr->NumTokens < (CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE-1) )
+         {
+            /*
+             * NOTE: offset never used unless the line fits in the buffer
+             */
+            ++ParserPtr->NumTokens;
+            ParserPtr->TokenStart[ParserPtr->NumTokens] = ParserPtr->LineLength;
+         }
+      }
+   }
+
+   return ParserPtr->IsEndOfScript;
+}
+
 /*
 **---------------------------------------------------------------------------------------
 ** Name: CFE_ES_ParseFileEntry
@@ -270,6 +317,7 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
    unsigned long PriorityIn;
    unsigned long StackSizeIn;
    unsigned long ExceptionActionIn;
+   unsigned long CpuAffinityIn;
    union
    {
         CFE_ES_AppId_t AppId;
@@ -310,6 +358,19 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
    StackSizeIn = strtoul(TokenList[5], NULL, 0);
    ExceptionActionIn = strtoul(TokenList[7], NULL, 0);
 
+   /*
+    * The CPU affinity is optional, so scripts written for
+    * earlier versions are still accepted.  0 means any CPU.
+    */
+   if ( NumTokens > 8 )
+   {
+      CpuAffinityIn = strtoul(TokenList[8], NULL, 0);
+   }
+   else
+   {
+      CpuAffinityIn = 0;
+   }
+
    if(strcmp(EntryType,"CFE_APP")==0)
    {
       CFE_ES_WriteToSysLog("ES Startup: Loading file: %s, APP: %s\n",
@@ -334,19 +395,44 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
           PriorityIn = OS_MAX_TASK_PRIORITY;
       }
 
-      /*
-      ** Now create the application
-      */
-      CreateStatus = CFE_ES_AppCreate(&IdBuf.AppId, FileName,
-                               EntryPoint, AppName,
-                               PriorityIn,
-                               StackSizeIn,
-                               ExceptionActionIn);
+      if ( CFE_ES_Global.StartupLoad.IsActive )
+      {
+         /*
+         ** Queue the application to be loaded by the load workers
+         */
+         CreateStatus = CFE_ES_StartupLoadQueueApp(FileName,
+                                  EntryPoint, AppName,
+                                  PriorityIn,
+                                  StackSizeIn,
+                                  ExceptionActionIn,
+                                  CpuAffinityIn);
+      }
+      else
+      {
+         /*
+         ** Now create the application
+         */
+         CreateStatus = CFE_ES_AppCreate(&IdBuf.AppId, FileName,
+                                  EntryPoint, AppName,
+                                  PriorityIn,
+                                  StackSizeIn,
+                                  ExceptionActionIn,
+                                  CpuAffinityIn);
+      }
    }
    else if(strcmp(EntryType,"CFE_LIB")==0)
    {
       CFE_ES_WriteToSysLog("ES Startup: Loading shared library: %s\n",FileName);
 
+      /*
+      ** The apps above this library in the script are loaded and started
+      ** first, and the apps after it are not loaded until it is complete
+      */
+      if ( CFE_ES_Global.StartupLoad.IsActive )
+      {
+         CFE_ES_StartupLoadFlush();
+      }
+
       /*
       ** Now load the library
       */
@@ -385,6 +471,8 @@ int32 CFE_ES_LoadModule(CFE_ResourceId_t ResourceId, const CFE_ES_ModuleLoadPara
     StartAddr = 0;
     ReturnCode = CFE_SUCCESS;
 
+    CFE_ES_StartupProfileMarkModule(ResourceId, CFE_ES_STARTUP_PROFILE_LOAD_START);
+
     if (LoadParams->FileName[0] != 0)
     {
         switch(CFE_ResourceId_GetBase(ResourceId))
@@ -466,6 +554,8 @@ int32 CFE_ES_LoadModule(CFE_ResourceId_t ResourceId, const CFE_ES_ModuleLoadPara
         }
     }
 
+    CFE_ES_StartupProfileMarkModule(ResourceId, CFE_ES_STARTUP_PROFILE_LOAD_END);
+
     return ReturnCode;
 }
 
@@ -483,36 +573,68 @@ int32 CFE_ES_LoadModule(CFE_ResourceId_t ResourceId, const CFE_ES_ModuleLoadPara
 int32 CFE_ES_GetAppEntryPoint(osal_task_entry *FuncPtr)
 {
     CFE_ES_AppRecord_t *AppRecPtr;
+    CFE_ES_TaskRecord_t *TaskRecPtr;
     int32 ReturnCode;
-    int32 Timeout;
+    int32 AffinityStatus;
+    uint32 WaitRemaining;
+    uint32 CpuAffinity;
 
     /*
      * Use the same timeout as was used for the startup script itself.
      */
     ReturnCode = CFE_ES_ERR_APP_REGISTER;
-    Timeout = CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC;
+    WaitRemaining = CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC;
+    CpuAffinity = 0;
 
     while(true)
     {
-        OS_TaskDelay(CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC);
-
         CFE_ES_LockSharedData(__func__,__LINE__);
         AppRecPtr = CFE_ES_GetAppRecordByContext();
         if (AppRecPtr != NULL)
         {
             AppRecPtr->AppState = CFE_ES_AppState_EARLY_INIT;
             *FuncPtr = (osal_task_entry)AppRecPtr->ModuleInfo.EntryAddress;
+            CpuAffinity = AppRecPtr->StartParams.CpuAffinity;
             ReturnCode = CFE_SUCCESS;
+
+            /* the CPU time reference can only be obtained by the task itself */
+            TaskRecPtr = CFE_ES_GetTaskRecordByContext();
+            if (TaskRecPtr != NULL)
+            {
+                CFE_ES_GetTaskCpuClock(&TaskRecPtr->CpuClock);
+            }
         }
         CFE_ES_UnlockSharedData(__func__,__LINE__);
 
-        if (ReturnCode == CFE_SUCCESS || Timeout <= 0)
+        if (ReturnCode == CFE_SUCCESS)
         {
             /* end of loop condition */
             break;
         }
 
-        Timeout -= CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+        /*
+         * The app record is completed by the creating task, which
+         * notifies this task when it is done.
+         */
+        if (CFE_ES_StartupSyncWait(&WaitRemaining) != CFE_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    /*
+     * OSAL creates tasks without a CPU affinity, so the
+     * new task restricts itself before running the app.
+     * An affinity that cannot be applied is not fatal.
+     */
+    if (ReturnCode == CFE_SUCCESS && CpuAffinity != 0)
+    {
+        AffinityStatus = CFE_ES_SetTaskAffinity(CpuAffinity);
+        if (AffinityStatus != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("ES Startup: Unable to set CPU affinity 0x%08lx, RC = 0x%08lx\n",
+                    (unsigned long)CpuAffinity, (unsigned long)AffinityStatus);
+        }
     }
 
     return (ReturnCode);
@@ -540,6 +662,55 @@ void CFE_ES_AppEntryPoint(void)
     }
 }
 
+/*
+**-------------------------------------------------------------------------------------
+** Name: CFE_ES_ChildTaskEntryPoint
+**
+** Helper function to act as the intermediate entry point of a child task.
+** OSAL does not set the affinity of the tasks it creates or provide their
+** CPU time, so the task sets its own affinity and gets its own CPU time clock
+** before calling the actual entry point.  The task record is filled in by
+** CFE_ES_CreateChildTask while it holds the lock, so it is complete once this
+** task can take the lock.
+**
+**-------------------------------------------------------------------------------------
+*/
+void CFE_ES_ChildTaskEntryPoint(void)
+{
+    CFE_ES_TaskRecord_t *TaskRecPtr;
+    CFE_ES_ChildTaskMainFuncPtr_t RealEntryFunc;
+    uint32 CpuAffinity;
+    int32 Status;
+
+    RealEntryFunc = NULL;
+    CpuAffinity = 0;
+
+    CFE_ES_LockSharedData(__func__,__LINE__);
+    TaskRecPtr = CFE_ES_GetTaskRecordByContext();
+    if (TaskRecPtr != NULL)
+    {
+        RealEntryFunc = TaskRecPtr->EntryFunc;
+        CpuAffinity = TaskRecPtr->CpuAffinity;
+        CFE_ES_GetTaskCpuClock(&TaskRecPtr->CpuClock);
+    }
+    CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+    if (CpuAffinity != 0)
+    {
+        Status = CFE_ES_SetTaskAffinity(CpuAffinity);
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("CFE_ES_CreateChildTask: Unable to set CPU affinity 0x%08lx, RC = 0x%08lx\n",
+                    (unsigned long)CpuAffinity, (unsigned long)Status);
+        }
+    }
+
+    if (RealEntryFunc != NULL)
+    {
+        (*RealEntryFunc)();
+    }
+}
+
 /*
 **-------------------------------------------------------------------------------------
 ** Name: CFE_ES_StartMainTask
@@ -601,6 +772,7 @@ int32 CFE_ES_StartAppTask(const CFE_ES_AppStartParams_t* StartParams, CFE_ES_App
         TaskRecPtr->AppId = RefAppId;
         strncpy(TaskRecPtr->TaskName, StartParams->BasicInfo.Name, sizeof(TaskRecPtr->TaskName)-1);
         TaskRecPtr->TaskName[sizeof(TaskRecPtr->TaskName)-1] = 0;
+        TaskRecPtr->CpuAffinity = StartParams->CpuAffinity;
         CFE_ES_TaskRecordSetUsed(TaskRecPtr, CFE_RESOURCEID_UNWRAP(LocalTaskId));
 
         /*
@@ -625,25 +797,25 @@ int32 CFE_ES_StartAppTask(const CFE_ES_AppStartParams_t* StartParams, CFE_ES_App
 
 /*
 **---------------------------------------------------------------------------------------
-** Name: ES_AppCreate
+** Name: CFE_ES_ReserveAppRecord
 **
-**   Purpose: This function loads and creates a cFE Application.
-**            This function can be called from the ES startup code when it
-**            loads the cFE Applications from the disk using the startup script, or it
-**            can be called when the ES Start Application command is executed.
+**   Purpose: This function allocates an ES_AppTable entry for a new cFE Application,
+**            and fills in its start parameters.  The entry is set to RESERVED, so
+**            the caller has exclusive access to it until CFE_ES_CompleteAppCreate
+**            is called.
 **
 **---------------------------------------------------------------------------------------
 */
-int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr,
+int32 CFE_ES_ReserveAppRecord(CFE_ResourceId_t *PendingResourceIdPtr,
                        const char   *FileName,
                        const char   *EntryPointName,
                        const char   *AppName,
                        CFE_ES_TaskPriority_Atom_t  Priority,
                        size_t  StackSize,
-                       CFE_ES_ExceptionAction_Enum_t  ExceptionAction)
+                       CFE_ES_ExceptionAction_Enum_t  ExceptionAction,
+                       uint32  CpuAffinity)
 {
    CFE_Status_t        Status;
-   CFE_ES_TaskId_t     MainTaskId;
    CFE_ES_AppRecord_t *AppRecPtr;
    CFE_ResourceId_t    PendingResourceId;
 
@@ -692,7 +864,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr,
    else
    {
        /* scan for a free slot */
-       PendingResourceId = CFE_ResourceId_FindNext(CFE_ES_Global.LastAppId, CFE_PLATFORM_ES_MAX_APPLICATIONS, CFE_ES_CheckAppIdSlotUsed);
+       PendingResourceId = CFE_ResourceId_FindNextFree(CFE_ES_Global.LastAppId, CFE_PLATFORM_ES_MAX_APPLICATIONS, CFE_ES_Global.AppSlotMap, CFE_ES_CheckAppIdSlotUsed);
        AppRecPtr = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(PendingResourceId));
 
        if (AppRecPtr == NULL)
@@ -709,9 +881,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr,
             * Fill out the parameters in the StartParams sub-structure
             */
            AppRecPtr->Type = CFE_ES_AppType_EXTERNAL;
-           strncpy(AppRecPtr->StartParams.BasicInfo.Name, AppName,
-                   sizeof(AppRecPtr->StartParams.BasicInfo.Name)-1);
-           AppRecPtr->StartParams.BasicInfo.Name[sizeof(AppRecPtr->StartParams.BasicInfo.Name)-1] = '\0';
+           CFE_ES_AppRecordSetName(AppRecPtr, AppName);
            strncpy(AppRecPtr->StartParams.BasicInfo.FileName, FileName,
                    sizeof(AppRecPtr->StartParams.BasicInfo.FileName)-1);
            AppRecPtr->StartParams.BasicInfo.FileName[sizeof(AppRecPtr->StartParams.BasicInfo.FileName)-1] = '\0';
@@ -726,6 +896,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr,
            AppRecPtr->StartParams.StackSize = StackSize;
            AppRecPtr->StartParams.ExceptionAction = ExceptionAction;
            AppRecPtr->StartParams.Priority = Priority;
+           AppRecPtr->StartParams.CpuAffinity = CpuAffinity;
 
            /*
             * Fill out the Task State info
@@ -735,25 +906,39 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr,
 
            CFE_ES_AppRecordSetUsed(AppRecPtr, CFE_RESOURCEID_RESERVED);
            CFE_ES_Global.LastAppId = PendingResourceId;
+           *PendingResourceIdPtr = PendingResourceId;
+
+           CFE_ES_StartupProfileStartModule(PendingResourceId, AppName, CFE_ES_AppType_EXTERNAL);
            Status = CFE_SUCCESS;
        }
    }
 
    CFE_ES_UnlockSharedData(__func__,__LINE__);
 
-   /*
-    * If ID allocation was not successful, return now.
-    * A message regarding the issue should have already been logged
-    */
-   if (Status != CFE_SUCCESS)
-   {
-       return Status;
-   }
+   return Status;
 
-   /*
-    * Load the module based on StartParams configured above.
-    */
-   Status = CFE_ES_LoadModule(PendingResourceId, &AppRecPtr->StartParams.BasicInfo, &AppRecPtr->ModuleInfo);
+} /* End Function */
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_CompleteAppCreate
+**
+**   Purpose: This function creates the main task of a cFE Application whose module
+**            has been loaded into an entry reserved by CFE_ES_ReserveAppRecord, then
+**            turns the entry into a valid app record.  If the load or the task
+**            creation failed, the entry is freed instead.
+**
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_CompleteAppCreate(CFE_ResourceId_t PendingResourceId, int32 LoadStatus,
+                       CFE_ES_AppId_t *ApplicationIdPtr)
+{
+   CFE_Status_t        Status;
+   CFE_ES_TaskId_t     MainTaskId;
+   CFE_ES_AppRecord_t *AppRecPtr;
+
+   AppRecPtr = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(PendingResourceId));
+   Status = LoadStatus;
 
    /*
     * If the Load was OK, then complete the initialization
@@ -786,6 +971,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr,
         ** Increment the registered App counter.
         */
        CFE_ES_Global.RegisteredExternalApps++;
+       CFE_ES_StartupProfileMarkModule(PendingResourceId, CFE_ES_STARTUP_PROFILE_REGISTERED);
    }
    else
    {
@@ -798,12 +984,64 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr,
 
    CFE_ES_UnlockSharedData(__func__,__LINE__);
 
+   if ( Status == CFE_SUCCESS )
+   {
+       /* the new app task may now get its entry point */
+       CFE_ES_StartupSyncNotify();
+   }
+
    *ApplicationIdPtr = CFE_ES_APPID_C(PendingResourceId);
 
    return Status;
 
 } /* End Function */
 
+/*
+**---------------------------------------------------------------------------------------
+** Name: ES_AppCreate
+**
+**   Purpose: This function loads and creates a cFE Application.
+**            This function can be called from the ES startup code when it
+**            loads the cFE Applications from the disk using the startup script, or it
+**            can be called when the ES Start Application command is executed.
+**
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr,
+                       const char   *FileName,
+                       const char   *EntryPointName,
+                       const char   *AppName,
+                       CFE_ES_TaskPriority_Atom_t  Priority,
+                       size_t  StackSize,
+                       CFE_ES_ExceptionAction_Enum_t  ExceptionAction,
+                       uint32  CpuAffinity)
+{
+   CFE_Status_t        Status;
+   CFE_ES_AppRecord_t *AppRecPtr;
+   CFE_ResourceId_t    PendingResourceId;
+
+   Status = CFE_ES_ReserveAppRecord(&PendingResourceId, FileName, EntryPointName, AppName,
+           Priority, StackSize, ExceptionAction, CpuAffinity);
+
+   /*
+    * If ID allocation was not successful, return now.
+    * A message regarding the issue should have already been logged
+    */
+   if (Status != CFE_SUCCESS)
+   {
+       return Status;
+   }
+
+   /*
+    * Load the module based on StartParams configured above.
+    */
+   AppRecPtr = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(PendingResourceId));
+   Status = CFE_ES_LoadModule(PendingResourceId, &AppRecPtr->StartParams.BasicInfo, &AppRecPtr->ModuleInfo);
+
+   return CFE_ES_CompleteAppCreate(PendingResourceId, Status, ApplicationIdPtr);
+
+} /* End Function */
+
 /*
 **---------------------------------------------------------------------------------------
 ** Name: CFE_ES_LoadLibrary
@@ -873,7 +1111,7 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t       *LibraryIdPtr,
    else
    {
        /* scan for a free slot */
-       PendingResourceId = CFE_ResourceId_FindNext(CFE_ES_Global.LastLibId, CFE_PLATFORM_ES_MAX_LIBRARIES, CFE_ES_CheckLibIdSlotUsed);
+       PendingResourceId = CFE_ResourceId_FindNextFree(CFE_ES_Global.LastLibId, CFE_PLATFORM_ES_MAX_LIBRARIES, CFE_ES_Global.LibSlotMap, CFE_ES_CheckLibIdSlotUsed);
        LibSlotPtr = CFE_ES_LocateLibRecordByID(CFE_ES_LIBID_C(PendingResourceId));
 
        if (LibSlotPtr == NULL)
@@ -889,9 +1127,7 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t       *LibraryIdPtr,
            /*
             * Fill out the parameters in the AppStartParams sub-structure
             */
-           strncpy(LibSlotPtr->BasicInfo.Name, LibName,
-                   sizeof(LibSlotPtr->BasicInfo.Name)-1);
-           LibSlotPtr->BasicInfo.Name[sizeof(LibSlotPtr->BasicInfo.Name)-1] = '\0';
+           CFE_ES_LibRecordSetName(LibSlotPtr, LibName);
            strncpy(LibSlotPtr->BasicInfo.FileName, FileName,
                    sizeof(LibSlotPtr->BasicInfo.FileName)-1);
            LibSlotPtr->BasicInfo.FileName[sizeof(LibSlotPtr->BasicInfo.FileName)-1] = '\0';
@@ -905,6 +1141,8 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t       *LibraryIdPtr,
            CFE_ES_LibRecordSetUsed(LibSlotPtr, CFE_RESOURCEID_RESERVED);
            CFE_ES_Global.LastLibId = PendingResourceId;
            Status = CFE_SUCCESS;
+
+           CFE_ES_StartupProfileStartModule(PendingResourceId, LibName, CFE_ES_AppType_LIBRARY);
        }
    }
 
@@ -957,6 +1195,7 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t       *LibraryIdPtr,
        * Increment the registered Lib counter.
        */
       CFE_ES_Global.RegisteredLibs++;
+      CFE_ES_StartupProfileMarkModule(PendingResourceId, CFE_ES_STARTUP_PROFILE_REGISTERED);
    }
    else
    {
@@ -972,6 +1211,448 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t       *LibraryIdPtr,
 
 } /* End Function */
 
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupLoadRunNextJob
+**
+**   Purpose: Takes the next queued app from the startup script and loads its module.
+**            This is run by the ES startup task and by each load worker task at the
+**            same time.  Returns false if there was no app left to load.
+**---------------------------------------------------------------------------------------
+*/
+static bool CFE_ES_StartupLoadRunNextJob(void)
+{
+   CFE_ES_StartupLoadState_t *LoadPtr = &CFE_ES_Global.StartupLoad;
+   CFE_ES_StartupLoadJob_t   *JobPtr;
+   CFE_ES_AppRecord_t        *AppRecPtr;
+   uint32                     JobIdx;
+
+   JobIdx = CFE_ES_AtomicLoad32(&LoadPtr->NextJob);
+   do
+   {
+      if (JobIdx >= CFE_ES_AtomicLoad32(&LoadPtr->NumJobs))
+      {
+         return false;
+      }
+   }
+   while (!CFE_ES_AtomicCompareExchange32(&LoadPtr->NextJob, &JobIdx, JobIdx + 1));
+
+   /*
+    * The app table entry is RESERVED, so only this task accesses it until the job is done
+    */
+   JobPtr = &LoadPtr->Jobs[JobIdx];
+   AppRecPtr = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(JobPtr->PendingAppId));
+   JobPtr->LoadStatus = CFE_ES_LoadModule(JobPtr->PendingAppId, &AppRecPtr->StartParams.BasicInfo,
+         &AppRecPtr->ModuleInfo);
+
+   CFE_ES_AtomicAdd32(&LoadPtr->NumDone, 1);
+   OS_BinSemGive(LoadPtr->DoneSem);
+
+   return true;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupLoadWorker
+**
+**   Purpose: Entry point of a load worker task.  Loads queued apps until the
+**            startup script is complete, then gives the exit semaphore and exits.
+**---------------------------------------------------------------------------------------
+*/
+static void CFE_ES_StartupLoadWorker(void)
+{
+   CFE_ES_StartupLoadState_t *LoadPtr = &CFE_ES_Global.StartupLoad;
+
+   while (true)
+   {
+      if (!CFE_ES_StartupLoadRunNextJob())
+      {
+         if (CFE_ES_AtomicLoad32(&LoadPtr->IsShutdown) != 0 ||
+               OS_CountSemTake(LoadPtr->WorkSem) != OS_SUCCESS)
+         {
+            break;
+         }
+      }
+   }
+
+   OS_CountSemGive(LoadPtr->ExitSem);
+   OS_TaskExit();
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupLoadInit
+**
+**   Purpose: Creates the semaphores and starts the worker tasks used to load the
+**            apps from the startup script in parallel.  If the semaphores cannot be
+**            created, or atomics are not available, then the apps are loaded one
+**            at a time as they are parsed.  If any of the worker tasks cannot be
+**            started then the apps are loaded by those which did start, and by
+**            the ES startup task.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_StartupLoadInit(void)
+{
+   CFE_ES_StartupLoadState_t *LoadPtr = &CFE_ES_Global.StartupLoad;
+   char      TaskName[OS_MAX_API_NAME];
+   osal_id_t TaskId;
+   uint32    i;
+   int32     Status;
+
+   memset(LoadPtr, 0, sizeof(*LoadPtr));
+
+   /*
+    * The queued apps are handed out with atomic operations, so without
+    * atomics the apps are loaded one at a time as they are parsed.
+    */
+   if (CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS == 0 || !CFE_ES_ATOMIC_AVAILABLE)
+   {
+      return;
+   }
+
+   Status = OS_CountSemCreate(&LoadPtr->WorkSem, CFE_ES_STARTUP_LOAD_WORK_SEM_NAME, 0, 0);
+   if (Status == OS_SUCCESS)
+   {
+      Status = OS_BinSemCreate(&LoadPtr->DoneSem, CFE_ES_STARTUP_LOAD_DONE_SEM_NAME, 0, 0);
+      if (Status == OS_SUCCESS)
+      {
+         Status = OS_CountSemCreate(&LoadPtr->ExitSem, CFE_ES_STARTUP_LOAD_EXIT_SEM_NAME, 0, 0);
+         if (Status != OS_SUCCESS)
+         {
+            OS_BinSemDelete(LoadPtr->DoneSem);
+         }
+      }
+      if (Status != OS_SUCCESS)
+      {
+         OS_CountSemDelete(LoadPtr->WorkSem);
+      }
+   }
+
+   if (Status != OS_SUCCESS)
+   {
+      CFE_ES_WriteToSysLog("ES Startup: Cannot create app load semaphores, loading apps sequentially. EC = 0x%08X\n",
+            (unsigned int)Status);
+      return;
+   }
+
+   for (i = 0; i < CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS; ++i)
+   {
+      snprintf(TaskName, sizeof(TaskName), CFE_ES_STARTUP_LOAD_TASK_NAME, (unsigned int)i);
+      Status = OS_TaskCreate(&TaskId, TaskName, CFE_ES_StartupLoadWorker,
+            OSAL_TASK_STACK_ALLOCATE, CFE_PLATFORM_ES_DEFAULT_STACK_SIZE,
+            CFE_PLATFORM_ES_START_TASK_PRIORITY, 0);
+      if (Status != OS_SUCCESS)
+      {
+         CFE_ES_WriteToSysLog("ES Startup: Unable to start app load worker %u. EC = 0x%08X\n",
+               (unsigned int)i, (unsigned int)Status);
+         break;
+      }
+      ++LoadPtr->NumWorkers;
+   }
+
+   LoadPtr->IsActive = true;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupLoadQueueApp
+**
+**   Purpose: Reserves an app table entry for an app in the startup script, and
+**            queues its module to be loaded by the next free load worker.
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_StartupLoadQueueApp(const char   *FileName,
+                       const char   *EntryPointName,
+                       const char   *AppName,
+                       CFE_ES_TaskPriority_Atom_t  Priority,
+                       size_t  StackSize,
+                       CFE_ES_ExceptionAction_Enum_t  ExceptionAction,
+                       uint32  CpuAffinity)
+{
+   CFE_ES_StartupLoadState_t *LoadPtr = &CFE_ES_Global.StartupLoad;
+   CFE_ResourceId_t           PendingResourceId;
+   uint32                     JobIdx;
+   int32                      Status;
+
+   /*
+    * Each queued job holds a reserved app table entry, so
+    * there is always a free job if an entry could be reserved
+    */
+   Status = CFE_ES_ReserveAppRecord(&PendingResourceId, FileName, EntryPointName, AppName,
+         Priority, StackSize, ExceptionAction, CpuAffinity);
+   if (Status != CFE_SUCCESS)
+   {
+      return Status;
+   }
+
+   JobIdx = LoadPtr->NumJobs;
+   LoadPtr->Jobs[JobIdx].PendingAppId = PendingResourceId;
+   LoadPtr->Jobs[JobIdx].LoadStatus = CFE_ES_ERR_APP_CREATE;
+
+   /* publish the job only after it is filled in */
+   CFE_ES_AtomicStore32(&LoadPtr->NumJobs, JobIdx + 1);
+   OS_CountSemGive(LoadPtr->WorkSem);
+
+   return CFE_SUCCESS;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupLoadFlush
+**
+**   Purpose: Loads queued apps along with the load workers until none are left, waits
+**            for the workers to finish the loads they took, then creates the main
+**            tasks of the queued apps in the order of the startup script.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_StartupLoadFlush(void)
+{
+   CFE_ES_StartupLoadState_t *LoadPtr = &CFE_ES_Global.StartupLoad;
+   CFE_ES_AppId_t             AppId;
+   uint32                     NumJobs;
+   uint32                     i;
+
+   NumJobs = LoadPtr->NumJobs;
+
+   while (CFE_ES_StartupLoadRunNextJob())
+   {
+      /* keep loading */
+   }
+
+   while (CFE_ES_AtomicLoad32(&LoadPtr->NumDone) < NumJobs)
+   {
+      OS_BinSemTake(LoadPtr->DoneSem);
+   }
+
+   for (i = 0; i < NumJobs; ++i)
+   {
+      CFE_ES_CompleteAppCreate(LoadPtr->Jobs[i].PendingAppId, LoadPtr->Jobs[i].LoadStatus, &AppId);
+   }
+
+   /*
+    * Empty the queue.  NumJobs is cleared first so that a worker
+    * which sees the cleared NextJob does not take a stale job.
+    */
+   CFE_ES_AtomicStore32(&LoadPtr->NumJobs, 0);
+   CFE_ES_AtomicStore32(&LoadPtr->NextJob, 0);
+   CFE_ES_AtomicStore32(&LoadPtr->NumDone, 0);
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupLoadCleanup
+**
+**   Purpose: Starts the apps which are still queued, then stops the load workers
+**            and deletes the semaphores.  Further apps are loaded one at a time.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_StartupLoadCleanup(void)
+{
+   CFE_ES_StartupLoadState_t *LoadPtr = &CFE_ES_Global.StartupLoad;
+   uint32                     i;
+
+   if (!LoadPtr->IsActive)
+   {
+      return;
+   }
+
+   CFE_ES_StartupLoadFlush();
+
+   CFE_ES_AtomicStore32(&LoadPtr->IsShutdown, 1);
+   for (i = 0; i < LoadPtr->NumWorkers; ++i)
+   {
+      OS_CountSemGive(LoadPtr->WorkSem);
+   }
+   for (i = 0; i < LoadPtr->NumWorkers; ++i)
+   {
+      OS_CountSemTake(LoadPtr->ExitSem);
+   }
+
+   OS_CountSemDelete(LoadPtr->ExitSem);
+   OS_BinSemDelete(LoadPtr->DoneSem);
+   OS_CountSemDelete(LoadPtr->WorkSem);
+
+   LoadPtr->IsActive = false;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_TaskRecordGetCpuTime
+**
+**   Purpose: Gets the CPU time used by a task as of the latest sample, in microseconds,
+**            or 0 if its CPU time has not been sampled.  Must be called with the ES
+**            shared data locked.
+**---------------------------------------------------------------------------------------
+*/
+uint64 CFE_ES_TaskRecordGetCpuTime(const CFE_ES_TaskRecord_t *TaskRecPtr)
+{
+   if (TaskRecPtr->NumCpuTimeSamples == 0)
+   {
+      return 0;
+   }
+
+   return TaskRecPtr->CpuTimeUsec[CFE_ES_Global.TaskUtilSampleIdx];
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_RunTaskUtilScan
+**
+**   Purpose: This function samples the CPU time used by each task, and computes the
+**            CPU utilization of each task over the samples in the window.
+**
+**            The samples of all tasks share one ring of sample times, so a task which
+**            was created or could not be read more recently than the start of the window
+**            uses the shorter span of samples that it has.  The span actually used is
+**            kept with the utilization, for the telemetry.
+**---------------------------------------------------------------------------------------
+*/
+bool CFE_ES_RunTaskUtilScan(uint32 ElapsedTime, void *Arg)
+{
+   CFE_ES_TaskRecord_t *TaskRecPtr;
+   OS_time_t            SampleTime;
+   int64                SinceLastMsec;
+   int64                WindowUsec;
+   uint64               CpuTimeUsec;
+   uint64               Utilization;
+   uint32               SampleIdx;
+   uint32               OldestIdx;
+   uint32               i;
+
+   CFE_PSP_GetTime(&SampleTime);
+
+   CFE_ES_LockSharedData(__func__,__LINE__);
+
+   /*
+    * The job also runs early on any background wakeup,
+    * so a sample is only taken when one is nearly due.
+    */
+   SampleIdx = CFE_ES_Global.TaskUtilSampleIdx;
+   SinceLastMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(SampleTime,
+         CFE_ES_Global.TaskUtilSampleTime[SampleIdx]));
+   if (SinceLastMsec >= 0 && SinceLastMsec < (CFE_PLATFORM_ES_TASK_UTIL_SAMPLE_MSEC / 2))
+   {
+      CFE_ES_UnlockSharedData(__func__,__LINE__);
+      return false;
+   }
+
+   SampleIdx = (SampleIdx + 1) % CFE_PLATFORM_ES_TASK_UTIL_WINDOW;
+   CFE_ES_Global.TaskUtilSampleIdx = SampleIdx;
+   CFE_ES_Global.TaskUtilSampleTime[SampleIdx] = SampleTime;
+
+   TaskRecPtr = CFE_ES_Global.TaskTable;
+   for ( i = 0; i < OS_MAX_TASKS; i++ )
+   {
+      if ( CFE_ES_TaskRecordIsUsed(TaskRecPtr) )
+      {
+         if (CFE_ES_ReadTaskCpuTime(&TaskRecPtr->CpuClock, &CpuTimeUsec) != CFE_SUCCESS)
+         {
+            /* not available, or the task has exited */
+            TaskRecPtr->NumCpuTimeSamples = 0;
+            TaskRecPtr->CpuUtilization = 0;
+            TaskRecPtr->CpuUtilWindowMsec = 0;
+         }
+         else
+         {
+            TaskRecPtr->CpuTimeUsec[SampleIdx] = CpuTimeUsec;
+            if (TaskRecPtr->NumCpuTimeSamples < CFE_PLATFORM_ES_TASK_UTIL_WINDOW)
+            {
+               ++TaskRecPtr->NumCpuTimeSamples;
+            }
+
+            if (TaskRecPtr->NumCpuTimeSamples > 1)
+            {
+               OldestIdx = (SampleIdx + CFE_PLATFORM_ES_TASK_UTIL_WINDOW + 1 -
+                     TaskRecPtr->NumCpuTimeSamples) % CFE_PLATFORM_ES_TASK_UTIL_WINDOW;
+               WindowUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(SampleTime,
+                     CFE_ES_Global.TaskUtilSampleTime[OldestIdx]));
+               if (WindowUsec > 0 && CpuTimeUsec >= TaskRecPtr->CpuTimeUsec[OldestIdx])
+               {
+                  Utilization = ((CpuTimeUsec - TaskRecPtr->CpuTimeUsec[OldestIdx]) * 10000) / (uint64)WindowUsec;
+
+                  /* a task cannot use more than one CPU, this is only sampling jitter */
+                  if (Utilization > 10000)
+                  {
+                     Utilization = 10000;
+                  }
+                  TaskRecPtr->CpuUtilization = (uint32)Utilization;
+                  TaskRecPtr->CpuUtilWindowMsec = (uint32)(WindowUsec / 1000);
+               }
+            }
+         }
+      }
+
+      ++TaskRecPtr;
+   }
+
+   CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+   return false;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_SendTaskUtil
+**
+**   Purpose: This function sends the CPU time and utilization of the next tasks in
+**            the task CPU utilization telemetry packet.  Tasks are reported in turn,
+**            up to CFE_MISSION_ES_TASK_UTIL_MAX_TASKS each time.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_SendTaskUtil(void)
+{
+   CFE_ES_TaskUtilTlm_Payload_t *PayloadPtr;
+   CFE_ES_TaskRecord_t *TaskRecPtr;
+   CFE_ES_TaskUtil_t *UtilPtr;
+   uint64 CpuTimeUsec;
+   uint32 TaskIdx;
+   uint32 Checked;
+
+   PayloadPtr = &CFE_ES_TaskData.TaskUtilPacket.Payload;
+   memset(PayloadPtr, 0, sizeof(*PayloadPtr));
+
+   TaskIdx = CFE_ES_TaskData.TaskUtilNextTask;
+
+   CFE_ES_LockSharedData(__func__,__LINE__);
+
+   for (Checked = 0; Checked < OS_MAX_TASKS &&
+         PayloadPtr->NumTasks < CFE_MISSION_ES_TASK_UTIL_MAX_TASKS; ++Checked)
+   {
+      if (TaskIdx >= OS_MAX_TASKS)
+      {
+         TaskIdx = 0;
+      }
+
+      TaskRecPtr = &CFE_ES_Global.TaskTable[TaskIdx];
+      if (CFE_ES_TaskRecordIsUsed(TaskRecPtr))
+      {
+         UtilPtr = &PayloadPtr->Tasks[PayloadPtr->NumTasks];
+         ++PayloadPtr->NumTasks;
+
+         UtilPtr->TaskId = CFE_ES_TaskRecordGetID(TaskRecPtr);
+         UtilPtr->AppId = TaskRecPtr->AppId;
+         strncpy(UtilPtr->TaskName, CFE_ES_TaskRecordGetName(TaskRecPtr), sizeof(UtilPtr->TaskName) - 1);
+         CpuTimeUsec = CFE_ES_TaskRecordGetCpuTime(TaskRecPtr);
+         UtilPtr->CpuTimeSeconds = (uint32)(CpuTimeUsec / 1000000);
+         UtilPtr->CpuTimeMicroseconds = (uint32)(CpuTimeUsec % 1000000);
+         UtilPtr->CpuUtilization = TaskRecPtr->CpuUtilization;
+         UtilPtr->WindowMsec = TaskRecPtr->CpuUtilWindowMsec;
+      }
+
+      ++TaskIdx;
+   }
+
+   CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+   CFE_ES_TaskData.TaskUtilNextTask = TaskIdx;
+
+   if (PayloadPtr->NumTasks != 0)
+   {
+      CFE_SB_TimeStampMsg(&CFE_ES_TaskData.TaskUtilPacket.TlmHeader.Msg);
+      CFE_SB_TransmitMsg(&CFE_ES_TaskData.TaskUtilPacket.TlmHeader.Msg, true);
+   }
+}
+
 /*
 **---------------------------------------------------------------------------------------
 ** Name: CFE_ES_RunAppTableScan
@@ -1083,11 +1764,19 @@ bool CFE_ES_RunAppTableScan(uint32 ElapsedTime, void *Arg)
    for ( i = 0; i < NumAppTimeouts; i++ )
    {
        /*
-        * Call CFE_ES_ProcessControlRequest() with a reference to
-        * the _copies_ of the app record details.  (This avoids
-        * needing to access the global records outside of the lock).
+        * The app code cannot be unloaded while a background worker is
+        * running one of its jobs.  The jobs are cancelled, and the app
+        * stays pending until a later scan finds that they have returned.
         */
-       CFE_ES_ProcessControlRequest(AppTimeoutList[i]);
+       if (CFE_ES_BackgroundCleanUpApp(AppTimeoutList[i]) == CFE_SUCCESS)
+       {
+           /*
+            * Call CFE_ES_ProcessControlRequest() with a reference to
+            * the _copies_ of the app record details.  (This avoids
+            * needing to access the global records outside of the lock).
+            */
+           CFE_ES_ProcessControlRequest(AppTimeoutList[i]);
+       }
    }
 
 
@@ -1180,7 +1869,8 @@ void CFE_ES_ProcessControlRequest(CFE_ES_AppId_t AppId)
                 OrigStartParams.BasicInfo.Name,
                 OrigStartParams.Priority,
                 OrigStartParams.StackSize,
-                OrigStartParams.ExceptionAction);
+                OrigStartParams.ExceptionAction,
+                OrigStartParams.CpuAffinity);
     }
 
     /*
@@ -1353,6 +2043,7 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
     CFE_ES_AppRecord_t      *AppRecPtr;
     CFE_ES_TaskRecord_t     *TaskRecPtr;
     CFE_ES_MemPoolRecord_t  *MemPoolRecPtr;
+    CFE_ES_GenCounterRecord_t *CountRecPtr;
 
 
     NumTasks = 0;
@@ -1427,6 +2118,23 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
             ++MemPoolRecPtr;
         } /* end for */
 
+        /*
+         * Delete the generic counters registered under this app's name.
+         * Nothing else needs to be freed for these, so this is done here.
+         */
+        CountRecPtr = CFE_ES_Global.CounterTable;
+        for ( i = 0; i < CFE_PLATFORM_ES_MAX_GEN_COUNTERS; i++ )
+        {
+            if ( CFE_ES_CounterRecordIsUsed(CountRecPtr) &&
+                    CFE_RESOURCEID_TEST_EQUAL(CountRecPtr->OwnerAppId, AppId))
+            {
+                CFE_ES_AtomicStore32(&CountRecPtr->Counter, 0);
+                CFE_ES_CounterRecordSetFree(CountRecPtr);
+            }
+
+            ++CountRecPtr;
+        } /* end for */
+
         /*
          * Set the record to RESERVED.
          *
@@ -1485,6 +2193,19 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
         ReturnCode = CFE_ES_APP_CLEANUP_ERR;
     }
 
+    /*
+     ** Remove any background jobs the app submitted.  If one of them is
+     ** still running, the module must stay loaded for it to return.
+     */
+    Status = CFE_ES_BackgroundCleanUpApp(AppId);
+    if ( Status != CFE_SUCCESS )
+    {
+        CFE_ES_WriteToSysLog("CFE_ES_CleanUpApp: Background job of AppID %lu still running, module not unloaded\n",
+                CFE_RESOURCEID_TO_ULONG(AppId));
+        ModuleId = OS_OBJECT_ID_UNDEFINED;
+        ReturnCode = CFE_ES_APP_CLEANUP_ERR;
+    }
+
     /*
      * Delete all tasks.
      *
@@ -41,11 +41,19 @@
 */
 #include "common_types.h"
 #include "osapi.h"
+#include "cfe_platform_cfg.h"
 
 /*
 ** Macro Definitions
 */
-#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE      8
+#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE      9
+#define CFE_ES_STARTSCRIPT_LINE_BUFFER_SIZE         128   /* Longest line of the startup script, including delimiters */
+#define CFE_ES_STARTSCRIPT_READ_SIZE                512   /* Number of bytes of the startup file read at a time */
+
+#define CFE_ES_STARTUP_LOAD_WORK_SEM_NAME   "ES_LOAD_WORK"  /* Name of semaphore given for each queued app load */
+#define CFE_ES_STARTUP_LOAD_DONE_SEM_NAME   "ES_LOAD_DONE"  /* Name of semaphore given when an app load finishes */
+#define CFE_ES_STARTUP_LOAD_EXIT_SEM_NAME   "ES_LOAD_EXIT"  /* Name of semaphore given by exiting load workers */
+#define CFE_ES_STARTUP_LOAD_TASK_NAME       "ES_LOAD_%u"    /* Format of the name of a load worker task */
 
 /*
 ** Type Definitions
@@ -120,6 +128,7 @@ typedef struct
     size_t                          StackSize;
     CFE_ES_TaskPriority_Atom_t      Priority;
     CFE_ES_ExceptionAction_Enum_t   ExceptionAction;
+    uint32                          CpuAffinity;    /* CPUs the main task may run on, one bit per CPU, 0 if any CPU */
 
 } CFE_ES_AppStartParams_t;
 
@@ -140,6 +149,16 @@ typedef struct
 } CFE_ES_AppRecord_t;
 
 
+/*
+** CFE_ES_TaskCpuClock_t identifies the CPU time of a task to the PSP.  It is
+** obtained by the task itself, and read by the CPU utilization scan.
+*/
+typedef struct
+{
+   bool      IsValid;                         /* Whether the task's reference was obtained */
+   uint32    CpuTimeRef;                      /* PSP reference to the CPU time of the task */
+} CFE_ES_TaskCpuClock_t;
+
 /*
 ** CFE_ES_TaskRecord_t is an internal structure used to keep track of
 ** CFE Tasks that are active in the system.
@@ -148,8 +167,16 @@ typedef struct
 {
    CFE_ES_TaskId_t         TaskId;            /* The actual TaskID of this entry, or undefined */
    CFE_ES_AppId_t          AppId;             /* The parent Application's App ID */
+   uint32    Generation;                      /* Incremented before and after TaskId changes, updated atomically */
    uint32    ExecutionCounter;                /* The execution counter for the Child task */
    char      TaskName[OS_MAX_API_NAME];       /* Task Name */
+   uint32    CpuAffinity;                     /* CPUs the task may run on, one bit per CPU, 0 if any CPU */
+   CFE_ES_ChildTaskMainFuncPtr_t EntryFunc;   /* Entry point of a child task */
+   CFE_ES_TaskCpuClock_t CpuClock;            /* CPU time clock of the task, set by the task itself */
+   uint32    NumCpuTimeSamples;               /* Number of valid samples in CpuTimeUsec, up to the window size */
+   uint32    CpuUtilization;                  /* CPU utilization over the window, in hundredths of a percent of one CPU */
+   uint32    CpuUtilWindowMsec;               /* Time actually covered by the samples of CpuUtilization */
+   uint64    CpuTimeUsec[CFE_PLATFORM_ES_TASK_UTIL_WINDOW]; /* CPU time used at each sample, indexed as the scan sample times */
 
 
 } CFE_ES_TaskRecord_t;
@@ -165,6 +192,20 @@ typedef struct
    CFE_ES_ModuleLoadStatus_t  ModuleInfo;     /* Runtime information about the module */
 } CFE_ES_LibRecord_t;
 
+/*
+** CFE_ES_StartScriptParser_t is an internal structure used to keep the state of
+** the startup script parser between blocks of the script, so that a line
+** may be split across blocks.
+*/
+typedef struct
+{
+    char   LineBuffer[CFE_ES_STARTSCRIPT_LINE_BUFFER_SIZE];       /* The current line, with the delimiters replaced by NUL */
+    uint32 TokenStart[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];    /* Offset of each token of the current line in LineBuffer */
+    uint32 NumTokens;                                             /* Number of tokens of the current line, less one */
+    uint32 LineLength;                                            /* Length of the current line, even if too long for LineBuffer */
+    bool   IsEndOfScript;                                         /* Whether the end marker '!' was reached */
+} CFE_ES_StartScriptParser_t;
+
 /*
 ** CFE_ES_AppTableScanState_t is an internal structure used to keep state of
 ** the background app table scan/cleanup process
@@ -188,6 +229,24 @@ typedef struct
 */
 void  CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath );
 
+/*
+** Internal function to start applications based on a startup script in memory,
+** such as one built into the executable, without any file access
+*/
+void  CFE_ES_StartApplicationsFromBuffer(const char *ScriptBuffer, size_t ScriptSize);
+
+/*
+** Internal function to reset the startup script parser to the start of a script
+*/
+void  CFE_ES_StartScriptParserInit(CFE_ES_StartScriptParser_t *ParserPtr);
+
+/*
+** Internal function to parse a block of the startup script, passing each complete
+** line to CFE_ES_ParseFileEntry().  A line may span several blocks.  Returns true
+** once the end of the script is reached, after which the rest is ignored.
+*/
+bool  CFE_ES_StartScriptParse(CFE_ES_StartScriptParser_t *ParserPtr, const char *Buffer, size_t BufferSize);
+
 /*
 ** Internal function to parse/execute a line of the cFE application startup 'script'
 */
@@ -214,11 +273,52 @@ int32 CFE_ES_GetAppEntryPoint(osal_task_entry *FuncPtr);
 */
 void CFE_ES_AppEntryPoint(void);
 
+/*
+** Intermediate entry point of a child task.  Gets the CPU time clock of
+** the task and applies its affinity, then calls the entry point in the
+** task table.
+*/
+void CFE_ES_ChildTaskEntryPoint(void);
+
+/*
+** Gets the CPU time clock of the calling task, and reads the CPU time
+** used by a task from its clock.  These are implemented in cfe_es_cputime.c.
+*/
+int32 CFE_ES_GetTaskCpuClock(CFE_ES_TaskCpuClock_t *ClockPtr);
+int32 CFE_ES_ReadTaskCpuTime(const CFE_ES_TaskCpuClock_t *ClockPtr, uint64 *CpuTimeUsecPtr);
+
+/*
+** Restricts the calling task to the CPUs in the given mask, one bit per CPU.
+** This is implemented in cfe_es_affinity.c.
+*/
+int32 CFE_ES_SetTaskAffinity(uint32 CpuAffinity);
+
 /*
 ** Internal function to start the main task of an app.
 */
 int32 CFE_ES_StartAppTask(const CFE_ES_AppStartParams_t* StartParams, CFE_ES_AppId_t RefAppId, CFE_ES_TaskId_t *TaskIdPtr);
 
+/*
+** Internal function to allocate an app table entry for a new cFE app,
+** based on the parameters passed in.  The entry is left in the RESERVED
+** state, and must be passed to CFE_ES_CompleteAppCreate() afterwards.
+*/
+int32 CFE_ES_ReserveAppRecord(CFE_ResourceId_t *PendingResourceIdPtr,
+                       const char   *FileName,
+                       const char   *EntryPointName,
+                       const char   *AppName,
+                       CFE_ES_TaskPriority_Atom_t    Priority,
+                       size_t                        StackSize,
+                       CFE_ES_ExceptionAction_Enum_t ExceptionAction,
+                       uint32                        CpuAffinity);
+
+/*
+** Internal function to start the main task of a new cFE app once its
+** module is loaded, and to finalize or free its reserved app table entry.
+*/
+int32 CFE_ES_CompleteAppCreate(CFE_ResourceId_t PendingResourceId, int32 LoadStatus,
+                       CFE_ES_AppId_t *ApplicationIdPtr);
+
 /*
 ** Internal function to create/start a new cFE app
 ** based on the parameters passed in
@@ -229,7 +329,8 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr,
                        const char   *AppName,
                        CFE_ES_TaskPriority_Atom_t    Priority,
                        size_t                        StackSize,
-                       CFE_ES_ExceptionAction_Enum_t ExceptionAction);
+                       CFE_ES_ExceptionAction_Enum_t ExceptionAction,
+                       uint32                        CpuAffinity);
 /*
 ** Internal function to load a a new cFE shared Library
 */
@@ -238,11 +339,56 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr,
                        const char   *EntryPointName,
                        const char   *LibName);
 
+/*
+** Internal function to start the app load workers before the startup script is processed.
+** Apps in the script are then loaded in parallel until CFE_ES_StartupLoadCleanup() is called.
+*/
+void CFE_ES_StartupLoadInit(void);
+
+/*
+** Internal function to queue the load of an app from the startup script.
+** The main task of the app is not created until CFE_ES_StartupLoadFlush() is called.
+*/
+int32 CFE_ES_StartupLoadQueueApp(const char   *FileName,
+                       const char   *EntryPointName,
+                       const char   *AppName,
+                       CFE_ES_TaskPriority_Atom_t    Priority,
+                       size_t                        StackSize,
+                       CFE_ES_ExceptionAction_Enum_t ExceptionAction,
+                       uint32                        CpuAffinity);
+
+/*
+** Internal function to wait for all queued app loads to finish, then
+** create the main tasks of those apps in the order they were queued.
+*/
+void CFE_ES_StartupLoadFlush(void);
+
+/*
+** Internal function to flush the queued app loads and stop the app load workers
+** after the startup script is processed.
+*/
+void CFE_ES_StartupLoadCleanup(void);
+
 /*
 ** Scan the Application Table for actions to take
 */
 bool CFE_ES_RunAppTableScan(uint32 ElapsedTime, void *Arg);
 
+/*
+** Get the CPU time used by a task as of the latest sample, in microseconds
+*/
+uint64 CFE_ES_TaskRecordGetCpuTime(const CFE_ES_TaskRecord_t *TaskRecPtr);
+
+/*
+** Sample the CPU time of all tasks and update their CPU utilization
+*/
+bool CFE_ES_RunTaskUtilScan(uint32 ElapsedTime, void *Arg);
+
+/*
+** Send the CPU time and utilization of the next tasks in telemetry
+*/
+void CFE_ES_SendTaskUtil(void);
+
 /*
 ** Scan for new exceptions stored in the PSP
 */
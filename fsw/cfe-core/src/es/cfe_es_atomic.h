@@ -0,0 +1,250 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+**  File:
+**  cfe_es_atomic.h
+**
+**  Purpose:
+**  This file contains a minimal set of atomic memory operations, used
+**  internally by ES for data that is updated without holding a lock.
+**
+**  These map directly to the compiler atomic builtins where available.
+**  If the compiler does not provide them, CFE_ES_ATOMIC_AVAILABLE is
+**  defined as false, the operations below are NOT atomic, and callers
+**  must use their locked implementation instead.
+**
+**  Notes:
+**  All operations are sequentially consistent.
+**
+*/
+
+#ifndef cfe_es_atomic_h
+#define cfe_es_atomic_h
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+#if defined(__GNUC__) && defined(__ATOMIC_SEQ_CST)
+
+#define CFE_ES_ATOMIC_AVAILABLE     true
+
+/*
+ * Whether 64 bit operations are implemented without a hidden lock.
+ * Some 32 bit CPUs can only do this via a library call, which is
+ * not suitable for use where a lock-free algorithm is expected.
+ */
+#define CFE_ES_ATOMIC_LOCKFREE_64   (__atomic_always_lock_free(sizeof(uint64), 0))
+
+static inline uint32 CFE_ES_AtomicLoad32(uint32 *Ptr)
+{
+    return __atomic_load_n(Ptr, __ATOMIC_SEQ_CST);
+}
+
+static inline void CFE_ES_AtomicStore32(uint32 *Ptr, uint32 Value)
+{
+    __atomic_store_n(Ptr, Value, __ATOMIC_SEQ_CST);
+}
+
+/* Returns the updated value */
+static inline uint32 CFE_ES_AtomicAdd32(uint32 *Ptr, uint32 Value)
+{
+    return __atomic_add_fetch(Ptr, Value, __ATOMIC_SEQ_CST);
+}
+
+/*
+ * Stores Desired if the current value equals *ExpectedPtr, and returns true.
+ * Otherwise returns false and updates *ExpectedPtr with the current value.
+ */
+static inline bool CFE_ES_AtomicCompareExchange32(uint32 *Ptr, uint32 *ExpectedPtr, uint32 Desired)
+{
+    return __atomic_compare_exchange_n(Ptr, ExpectedPtr, Desired, false,
+            __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/*
+ * 16 bit operations, for fields that are part of a stored layout
+ * and cannot be widened
+ */
+static inline void CFE_ES_AtomicStore16(uint16 *Ptr, uint16 Value)
+{
+    __atomic_store_n(Ptr, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline bool CFE_ES_AtomicCompareExchange16(uint16 *Ptr, uint16 *ExpectedPtr, uint16 Desired)
+{
+    return __atomic_compare_exchange_n(Ptr, ExpectedPtr, Desired, false,
+            __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+static inline uint64 CFE_ES_AtomicLoad64(uint64 *Ptr)
+{
+    return __atomic_load_n(Ptr, __ATOMIC_SEQ_CST);
+}
+
+/* Returns the updated value */
+static inline uint64 CFE_ES_AtomicAdd64(uint64 *Ptr, uint64 Value)
+{
+    return __atomic_add_fetch(Ptr, Value, __ATOMIC_SEQ_CST);
+}
+
+/*
+ * Orders all memory accesses before the fence with those after it,
+ * including non-atomic accesses
+ */
+static inline void CFE_ES_AtomicFence(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/*
+ * Operations on a size_t, which is the native word size
+ * and therefore always lock-free where atomics are available
+ */
+static inline size_t CFE_ES_AtomicLoadSize(size_t *Ptr)
+{
+    return __atomic_load_n(Ptr, __ATOMIC_SEQ_CST);
+}
+
+static inline void CFE_ES_AtomicStoreSize(size_t *Ptr, size_t Value)
+{
+    __atomic_store_n(Ptr, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline bool CFE_ES_AtomicCompareExchangeSize(size_t *Ptr, size_t *ExpectedPtr, size_t Desired)
+{
+    return __atomic_compare_exchange_n(Ptr, ExpectedPtr, Desired, false,
+            __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/*
+ * Stores Desired if the current value equals *ExpectedPtr, and returns true.
+ * Otherwise returns false and updates *ExpectedPtr with the current value.
+ */
+static inline bool CFE_ES_AtomicCompareExchange64(uint64 *Ptr, uint64 *ExpectedPtr, uint64 Desired)
+{
+    return __atomic_compare_exchange_n(Ptr, ExpectedPtr, Desired, false,
+            __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+#else
+
+#define CFE_ES_ATOMIC_AVAILABLE     false
+#define CFE_ES_ATOMIC_LOCKFREE_64   false
+
+static inline uint32 CFE_ES_AtomicLoad32(uint32 *Ptr)
+{
+    return *Ptr;
+}
+
+static inline void CFE_ES_AtomicStore32(uint32 *Ptr, uint32 Value)
+{
+    *Ptr = Value;
+}
+
+static inline uint32 CFE_ES_AtomicAdd32(uint32 *Ptr, uint32 Value)
+{
+    *Ptr += Value;
+    return *Ptr;
+}
+
+static inline bool CFE_ES_AtomicCompareExchange32(uint32 *Ptr, uint32 *ExpectedPtr, uint32 Desired)
+{
+    if (*Ptr != *ExpectedPtr)
+    {
+        *ExpectedPtr = *Ptr;
+        return false;
+    }
+
+    *Ptr = Desired;
+    return true;
+}
+
+static inline void CFE_ES_AtomicStore16(uint16 *Ptr, uint16 Value)
+{
+    *Ptr = Value;
+}
+
+static inline bool CFE_ES_AtomicCompareExchange16(uint16 *Ptr, uint16 *ExpectedPtr, uint16 Desired)
+{
+    if (*Ptr != *ExpectedPtr)
+    {
+        *ExpectedPtr = *Ptr;
+        return false;
+    }
+
+    *Ptr = Desired;
+    return true;
+}
+
+static inline uint64 CFE_ES_AtomicLoad64(uint64 *Ptr)
+{
+    return *Ptr;
+}
+
+static inline uint64 CFE_ES_AtomicAdd64(uint64 *Ptr, uint64 Value)
+{
+    *Ptr += Value;
+    return *Ptr;
+}
+
+static inline void CFE_ES_AtomicFence(void)
+{
+}
+
+static inline size_t CFE_ES_AtomicLoadSize(size_t *Ptr)
+{
+    return *Ptr;
+}
+
+static inline void CFE_ES_AtomicStoreSize(size_t *Ptr, size_t Value)
+{
+    *Ptr = Value;
+}
+
+static inline bool CFE_ES_AtomicCompareExchangeSize(size_t *Ptr, size_t *ExpectedPtr, size_t Desired)
+{
+    if (*Ptr != *ExpectedPtr)
+    {
+        *ExpectedPtr = *Ptr;
+        return false;
+    }
+
+    *Ptr = Desired;
+    return true;
+}
+
+static inline bool CFE_ES_AtomicCompareExchange64(uint64 *Ptr, uint64 *ExpectedPtr, uint64 Desired)
+{
+    if (*Ptr != *ExpectedPtr)
+    {
+        *ExpectedPtr = *Ptr;
+        return false;
+    }
+
+    *Ptr = Desired;
+    return true;
+}
+
+#endif
+
+#endif  /* cfe_es_atomic_h */
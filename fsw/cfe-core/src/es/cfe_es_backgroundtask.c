@@ -27,6 +27,14 @@
 ** for various maintenance duties that may take time to execute, such as
 ** writing status/log files.
 **
+** The jobs are run by a small pool of worker tasks (see
+** CFE_PLATFORM_ES_BACKGROUND_WORKERS).  Each worker claims the highest
+** priority job which is due, runs it once, and then looks for another, so
+** a slow job only occupies one worker.  A job is never run by two workers
+** at once, and jobs which share data can be put in a group so that only one
+** of them runs at a time.  Applications and other services may add their
+** own jobs via CFE_ES_SubmitBackgroundJob().
+**
 */
 
 /*
@@ -34,14 +42,18 @@
 */
 
 #include <string.h>
+#include <stdio.h>
 
 #include "osapi.h"
 #include "private/cfe_private.h"
 #include "cfe_es_perf.h"
 #include "cfe_es_global.h"
 #include "cfe_es_task.h"
+#include "cfe_es_cds_mempool.h"
+#include "cfe_es_atomic.h"
 
 #define CFE_ES_BACKGROUND_SEM_NAME             "ES_BG_SEM"
+#define CFE_ES_BACKGROUND_MUTEX_NAME           "ES_BG_MUTEX"
 #define CFE_ES_BACKGROUND_CHILD_NAME           "ES_BG_TASK"
 #define CFE_ES_BACKGROUND_CHILD_STACK_PTR      CFE_ES_TASK_STACK_ALLOCATE
 #define CFE_ES_BACKGROUND_CHILD_STACK_SIZE     CFE_PLATFORM_ES_PERF_CHILD_STACK_SIZE
@@ -49,55 +61,268 @@
 #define CFE_ES_BACKGROUND_CHILD_FLAGS          0
 #define CFE_ES_BACKGROUND_MAX_IDLE_DELAY       30000        /* 30 seconds */
 
+/*
+ * Job groups, for jobs which must not run at the same time.
+ * The perf log dump and stream both read the perf data buffer and
+ * reset its state, so only one of them may run at once.
+ */
+#define CFE_ES_BACKGROUND_GROUP_NONE           0
+#define CFE_ES_BACKGROUND_GROUP_PERF_LOG       1
+
 
 typedef struct
 {
-    bool (*RunFunc)(uint32 ElapsedTime, void *Arg);
+    CFE_ES_BackgroundJobFunc_t RunFunc;
     void *JobArg;
     uint32 ActivePeriod;            /**< max wait/delay time between calls when job is active */
     uint32 IdlePeriod;              /**< max wait/delay time between calls when job is idle */
+    uint32 Deadline;                /**< max time the job may wait once it is due, 0 if none */
+    uint16 Priority;                /**< jobs with lower values are run first when several are due */
+    uint8 Group;                    /**< jobs in the same non-zero group are never run at the same time */
 } CFE_ES_BackgroundJobEntry_t;
 
 /*
  * List of "background jobs"
  *
  * This is just a list of functions to periodically call from the context of the background task,
- * and can be added/extended as needed.
+ * and can be added/extended as needed.  CFE_ES_BACKGROUND_NUM_FIXED_JOBS must match the number
+ * of entries.
  *
  * Each Job function returns a boolean, and should return "true" if it is active, or "false" if it is idle.
  *
  * This uses "cooperative multitasking" -- the function should do some limited work, then return to the
  * background task.  It will be called again after a delay period to do more work.
  */
-const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] =
+const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[CFE_ES_BACKGROUND_NUM_FIXED_JOBS] =
 {
         {   /* ES app table background scan */
                 .RunFunc = CFE_ES_RunAppTableScan,
                 .JobArg = &CFE_ES_TaskData.BackgroundAppScanState,
                 .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE / 4,
-                .IdlePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE
+                .IdlePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                .Deadline = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                .Priority = CFE_ES_BACKGROUND_PRIORITY_HIGH,
+                .Group = CFE_ES_BACKGROUND_GROUP_NONE
         },
         {   /* Performance Log Data Dump to file */
                 .RunFunc = CFE_ES_RunPerfLogDump,
                 .JobArg = &CFE_ES_TaskData.BackgroundPerfDumpState,
                 .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
-                .IdlePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000
+                .IdlePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000,
+                .Deadline = 0,
+                .Priority = CFE_ES_BACKGROUND_PRIORITY_LOW,
+                .Group = CFE_ES_BACKGROUND_GROUP_PERF_LOG
+        },
+        {   /* Performance Log Data Stream to file */
+                .RunFunc = CFE_ES_RunPerfLogStream,
+                .JobArg = &CFE_ES_TaskData.BackgroundPerfStreamState,
+                .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+                .IdlePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000,
+                .Deadline = 0,
+                .Priority = CFE_ES_BACKGROUND_PRIORITY_NORMAL,
+                .Group = CFE_ES_BACKGROUND_GROUP_PERF_LOG
         },
         {   /* Check for exceptions stored in the PSP */
                 .RunFunc = CFE_ES_RunExceptionScan,
                 .JobArg = NULL,
                 .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
-                .IdlePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE
+                .IdlePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                .Deadline = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                .Priority = CFE_ES_BACKGROUND_PRIORITY_HIGH,
+                .Group = CFE_ES_BACKGROUND_GROUP_NONE
         },
         {   /* Check for ER log write requests */
                 .RunFunc = CFE_ES_RunERLogDump,
                 .JobArg = &CFE_ES_TaskData.BackgroundERLogDumpState,
                 .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
-                .IdlePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE
+                .IdlePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                .Deadline = 0,
+                .Priority = CFE_ES_BACKGROUND_PRIORITY_LOW,
+                .Group = CFE_ES_BACKGROUND_GROUP_NONE
+        },
+        {   /* Sample the CPU time of all tasks */
+                .RunFunc = CFE_ES_RunTaskUtilScan,
+                .JobArg = NULL,
+                .ActivePeriod = CFE_PLATFORM_ES_TASK_UTIL_SAMPLE_MSEC,
+                .IdlePeriod = CFE_PLATFORM_ES_TASK_UTIL_SAMPLE_MSEC,
+                .Deadline = CFE_PLATFORM_ES_TASK_UTIL_SAMPLE_MSEC,
+                .Priority = CFE_ES_BACKGROUND_PRIORITY_NORMAL,
+                .Group = CFE_ES_BACKGROUND_GROUP_NONE
+        },
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+        {   /* Write changed CDS blocks from the RAM shadow to the CDS */
+                .RunFunc = CFE_ES_RunCDSShadowFlush,
+                .JobArg = NULL,
+                .ActivePeriod = CFE_PLATFORM_ES_CDS_SHADOW_FLUSH_MSEC,
+                .IdlePeriod = CFE_PLATFORM_ES_CDS_SHADOW_FLUSH_MSEC,
+                .Deadline = CFE_PLATFORM_ES_CDS_SHADOW_FLUSH_MSEC,
+                .Priority = CFE_ES_BACKGROUND_PRIORITY_NORMAL,
+                .Group = CFE_ES_BACKGROUND_GROUP_NONE
         }
+#endif
 };
 
-#define CFE_ES_BACKGROUND_NUM_JOBS          (sizeof(CFE_ES_BACKGROUND_JOB_TABLE) / sizeof(CFE_ES_BACKGROUND_JOB_TABLE[0]))
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_BackgroundJobPeriod                                              */
+/*                                                                               */
+/* Purpose: Gets the maximum time between calls to a job, in milliseconds,       */
+/* which depends on whether it was active on the last call.                      */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CFE_ES_BackgroundJobPeriod(const CFE_ES_BackgroundJobState_t *JobPtr)
+{
+    uint32 Period;
+
+    if (JobPtr->IsActive)
+    {
+        Period = JobPtr->ActivePeriod;
+    }
+    else
+    {
+        Period = JobPtr->IdlePeriod;
+    }
+
+    if (Period == 0)
+    {
+        /* no requirement, only polled on wakeup */
+        Period = CFE_ES_BACKGROUND_MAX_IDLE_DELAY;
+    }
+
+    return Period;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_BackgroundClaimJob                                               */
+/*                                                                               */
+/* Purpose: Selects the next job for a worker to run, and marks it as running.   */
+/*                                                                               */
+/* Assumptions and Notes: A job is due if its period has expired, or if there    */
+/* has been a wakeup since it last ran.  Jobs which have been due for longer     */
+/* than their deadline are selected first, then the job with the lowest          */
+/* priority value, and then the one which has been due for longest.  A job is   */
+/* not selected while another job of its group is running.  If no job is due,   */
+/* NULL is returned and NextDelay is reduced to the time until the next one is.  */
+/* OtherDue is set if more than one job is due.                                  */
+/*                                                                               */
+/* Must be called with the job mutex held.                                       */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CFE_ES_BackgroundJobState_t *CFE_ES_BackgroundClaimJob(OS_time_t CurrTime, uint32 *NextDelay, bool *OtherDue)
+{
+    CFE_ES_BackgroundTaskState_t *BgPtr = &CFE_ES_Global.BackgroundTask;
+    CFE_ES_BackgroundJobState_t *JobPtr;
+    CFE_ES_BackgroundJobState_t *SelectedPtr;
+    uint32 WakeupCount;
+    int64 TimeLeft;
+    int64 SelectedTimeLeft;
+    bool IsLate;
+    bool SelectedIsLate;
+    uint32 i;
+
+    SelectedPtr = NULL;
+    SelectedTimeLeft = 0;
+    SelectedIsLate = false;
+    WakeupCount = CFE_ES_AtomicLoad32(&BgPtr->WakeupCount);
+    JobPtr = BgPtr->Jobs;
+    for (i = 0; i < CFE_ES_BACKGROUND_MAX_JOBS; ++i)
+    {
+        if (JobPtr->RunFunc != NULL && !JobPtr->IsRunning && !JobPtr->IsCancelled &&
+                (BgPtr->RunningGroups & (1UL << JobPtr->Group)) == 0)
+        {
+            TimeLeft = CFE_ES_BackgroundJobPeriod(JobPtr) -
+                    OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrTime, JobPtr->LastRunTime));
+            if (TimeLeft > 0 && JobPtr->WakeupCount == WakeupCount)
+            {
+                if (*NextDelay > TimeLeft)
+                {
+                    *NextDelay = TimeLeft;
+                }
+            }
+            else
+            {
+                IsLate = (JobPtr->Deadline != 0 && -TimeLeft >= (int64)JobPtr->Deadline);
+                if (SelectedPtr == NULL)
+                {
+                    SelectedPtr = JobPtr;
+                    SelectedTimeLeft = TimeLeft;
+                    SelectedIsLate = IsLate;
+                }
+                else
+                {
+                    *OtherDue = true;
+                    if ((IsLate && !SelectedIsLate) ||
+                            (IsLate == SelectedIsLate && (JobPtr->Priority < SelectedPtr->Priority ||
+                            (JobPtr->Priority == SelectedPtr->Priority && TimeLeft < SelectedTimeLeft))))
+                    {
+                        SelectedPtr = JobPtr;
+                        SelectedTimeLeft = TimeLeft;
+                        SelectedIsLate = IsLate;
+                    }
+                }
+            }
+        }
+        ++JobPtr;
+    }
+
+    if (SelectedPtr != NULL)
+    {
+        if (SelectedIsLate)
+        {
+            ++BgPtr->MissedDeadlines;
+        }
+
+        SelectedPtr->IsRunning = true;
+        SelectedPtr->WakeupCount = WakeupCount;
+        if (SelectedPtr->Group != CFE_ES_BACKGROUND_GROUP_NONE)
+        {
+            BgPtr->RunningGroups |= 1UL << SelectedPtr->Group;
+        }
+    }
+
+    return SelectedPtr;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_BackgroundJobDone                                                */
+/*                                                                               */
+/* Purpose: Records the result of running a job, and frees the slot of a         */
+/* submitted job which is finished.                                              */
+/*                                                                               */
+/* Assumptions and Notes: Must be called with the job mutex held.                */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_BackgroundJobDone(CFE_ES_BackgroundJobState_t *JobPtr, bool IsActive, OS_time_t CurrTime)
+{
+    uint32 i;
+    uint32 NumJobsRunning;
+
+    JobPtr->IsRunning = false;
+    JobPtr->IsActive = IsActive;
+    JobPtr->LastRunTime = CurrTime;
+
+    if (JobPtr->Group != CFE_ES_BACKGROUND_GROUP_NONE)
+    {
+        CFE_ES_Global.BackgroundTask.RunningGroups &= ~(1UL << JobPtr->Group);
+    }
+
+    if (JobPtr->IsSubmitted && (!IsActive || JobPtr->IsCancelled))
+    {
+        /* job is complete, or its app was deleted while it was running */
+        memset(JobPtr, 0, sizeof(*JobPtr));
+    }
+
+    NumJobsRunning = 0;
+    for (i = 0; i < CFE_ES_BACKGROUND_MAX_JOBS; ++i)
+    {
+        if (CFE_ES_Global.BackgroundTask.Jobs[i].RunFunc != NULL &&
+                CFE_ES_Global.BackgroundTask.Jobs[i].IsActive)
+        {
+            ++NumJobsRunning;
+        }
+    }
+
+    CFE_ES_Global.BackgroundTask.NumJobsRunning = NumJobsRunning;
+}
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /* Name: CFE_ES_BackgroundTask                                                   */
@@ -110,17 +335,20 @@ const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] =
 /* avoid the need to create a child task "on demand" when work items arrive,     */
 /* which is a form of dynamic allocation.                                        */
 /*                                                                               */
+/* Several instances of this task may run, each taking one due job at a time.   */
+/* When a worker takes a job while others are also due, it gives the semaphore   */
+/* so that another worker can take them.                                         */
+/*                                                                               */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CFE_ES_BackgroundTask(void)
 {
     int32 status;
-    uint32 JobTotal;
-    uint32 NumJobsRunning;
     uint32 NextDelay;
     uint32 ElapsedTime;
+    bool OtherDue;
+    bool IsActive;
     OS_time_t CurrTime;
-    OS_time_t LastTime;
-    const CFE_ES_BackgroundJobEntry_t *JobPtr;
+    CFE_ES_BackgroundJobState_t *JobPtr;
 
     status = CFE_ES_RegisterChildTask();
     if (status != CFE_SUCCESS)
@@ -130,59 +358,57 @@ void CFE_ES_BackgroundTask(void)
         return;
     }
 
-    CFE_PSP_GetTime(&LastTime);
-
     while (true)
     {
-        /*
-         * compute the elapsed time (difference) between last
-         * execution and now, in milliseconds.
-         */
+        NextDelay = CFE_ES_BACKGROUND_MAX_IDLE_DELAY;   /* default; will be adjusted based on pending jobs */
+        OtherDue = false;
+        ElapsedTime = 0;
+
         CFE_PSP_GetTime(&CurrTime);
-        ElapsedTime = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrTime, LastTime));
-        LastTime = CurrTime;
 
-        NextDelay = CFE_ES_BACKGROUND_MAX_IDLE_DELAY;   /* default; will be adjusted based on active jobs */
-        JobPtr = CFE_ES_BACKGROUND_JOB_TABLE;
-        JobTotal = CFE_ES_BACKGROUND_NUM_JOBS;
-        NumJobsRunning = 0;
+        OS_MutSemTake(CFE_ES_Global.BackgroundTask.JobMutex);
+        JobPtr = CFE_ES_BackgroundClaimJob(CurrTime, &NextDelay, &OtherDue);
+        if (JobPtr != NULL)
+        {
+            /*
+             * compute the elapsed time (difference) between last
+             * execution of this job and now, in milliseconds.
+             */
+            ElapsedTime = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrTime, JobPtr->LastRunTime));
+        }
+        OS_MutSemGive(CFE_ES_Global.BackgroundTask.JobMutex);
 
-        while (JobTotal > 0)
+        if (JobPtr != NULL)
         {
+            if (OtherDue)
+            {
+                /* let another worker (if any) take the other jobs */
+                OS_BinSemGive(CFE_ES_Global.BackgroundTask.WorkSem);
+            }
+
             /*
              * call the background job -
              * if it returns "true" that means it is active,
              * if it returns "false" that means it is idle
              */
-            if (JobPtr->RunFunc != NULL && JobPtr->RunFunc(ElapsedTime, JobPtr->JobArg))
-            {
-                ++NumJobsRunning;
+            IsActive = JobPtr->RunFunc(ElapsedTime, JobPtr->JobArg);
 
-                if (JobPtr->ActivePeriod != 0 && NextDelay > JobPtr->ActivePeriod)
-                {
-                    /* next delay is based on this active job wait time */
-                    NextDelay = JobPtr->ActivePeriod;
-                }
-            }
-            else if (JobPtr->IdlePeriod != 0 && NextDelay > JobPtr->IdlePeriod)
-            {
-                /* next delay is based on this idle job wait time */
-                NextDelay = JobPtr->IdlePeriod;
-            }
-            --JobTotal;
-            ++JobPtr;
-        }
-
-        CFE_ES_Global.BackgroundTask.NumJobsRunning = NumJobsRunning;
+            CFE_PSP_GetTime(&CurrTime);
 
-        status = OS_BinSemTimedWait(CFE_ES_Global.BackgroundTask.WorkSem, NextDelay);
-        if (status != OS_SUCCESS && status != OS_SEM_TIMEOUT)
+            OS_MutSemTake(CFE_ES_Global.BackgroundTask.JobMutex);
+            CFE_ES_BackgroundJobDone(JobPtr, IsActive, CurrTime);
+            OS_MutSemGive(CFE_ES_Global.BackgroundTask.JobMutex);
+        }
+        else
         {
-            /* should never occur */
-            CFE_ES_WriteToSysLog("CFE_ES: Failed to take background sem: %08lx\n", (unsigned long)status);
-            break;
+            status = OS_BinSemTimedWait(CFE_ES_Global.BackgroundTask.WorkSem, NextDelay);
+            if (status != OS_SUCCESS && status != OS_SEM_TIMEOUT)
+            {
+                /* should never occur */
+                CFE_ES_WriteToSysLog("CFE_ES: Failed to take background sem: %08lx\n", (unsigned long)status);
+                break;
+            }
         }
-
     }
 }
 
@@ -195,29 +421,74 @@ void CFE_ES_BackgroundTask(void)
 int32 CFE_ES_BackgroundInit(void)
 {
     int32 status;
+    uint32 i;
+    OS_time_t CurrTime;
+    char TaskName[OS_MAX_API_NAME];
+    CFE_ES_BackgroundTaskState_t *BgPtr = &CFE_ES_Global.BackgroundTask;
 
-    status = OS_BinSemCreate(&CFE_ES_Global.BackgroundTask.WorkSem, CFE_ES_BACKGROUND_SEM_NAME, 0, 0);
+    status = OS_BinSemCreate(&BgPtr->WorkSem, CFE_ES_BACKGROUND_SEM_NAME, 0, 0);
     if (status != OS_SUCCESS)
     {
         CFE_ES_WriteToSysLog("CFE_ES: Failed to create background sem: %08lx\n", (unsigned long)status);
         return status;
     }
 
-    /* Spawn a task to write the performance data to a file */
-    status = CFE_ES_CreateChildTask(&CFE_ES_Global.BackgroundTask.TaskID,
-            CFE_ES_BACKGROUND_CHILD_NAME,
-            CFE_ES_BackgroundTask,
-            CFE_ES_BACKGROUND_CHILD_STACK_PTR,
-            CFE_ES_BACKGROUND_CHILD_STACK_SIZE,
-            CFE_ES_BACKGROUND_CHILD_PRIORITY,
-            CFE_ES_BACKGROUND_CHILD_FLAGS);
-
+    status = OS_MutSemCreate(&BgPtr->JobMutex, CFE_ES_BACKGROUND_MUTEX_NAME, 0);
     if (status != OS_SUCCESS)
     {
-        CFE_ES_WriteToSysLog("CFE_ES: Failed to create background task: %08lx\n", (unsigned long)status);
+        CFE_ES_WriteToSysLog("CFE_ES: Failed to create background mutex: %08lx\n", (unsigned long)status);
         return status;
     }
 
+    /*
+     * Set up the fixed jobs.  The wakeup count is different from
+     * that of the jobs so all are run once at startup.
+     */
+    CFE_PSP_GetTime(&CurrTime);
+    memset(BgPtr->Jobs, 0, sizeof(BgPtr->Jobs));
+    BgPtr->WakeupCount = 1;
+    BgPtr->RunningGroups = 0;
+    for (i = 0; i < CFE_ES_BACKGROUND_NUM_FIXED_JOBS; ++i)
+    {
+        BgPtr->Jobs[i].RunFunc = CFE_ES_BACKGROUND_JOB_TABLE[i].RunFunc;
+        BgPtr->Jobs[i].JobArg = CFE_ES_BACKGROUND_JOB_TABLE[i].JobArg;
+        BgPtr->Jobs[i].ActivePeriod = CFE_ES_BACKGROUND_JOB_TABLE[i].ActivePeriod;
+        BgPtr->Jobs[i].IdlePeriod = CFE_ES_BACKGROUND_JOB_TABLE[i].IdlePeriod;
+        BgPtr->Jobs[i].Deadline = CFE_ES_BACKGROUND_JOB_TABLE[i].Deadline;
+        BgPtr->Jobs[i].Priority = CFE_ES_BACKGROUND_JOB_TABLE[i].Priority;
+        BgPtr->Jobs[i].Group = CFE_ES_BACKGROUND_JOB_TABLE[i].Group;
+        BgPtr->Jobs[i].OwnerAppId = CFE_ES_APPID_UNDEFINED;
+        BgPtr->Jobs[i].LastRunTime = CurrTime;
+    }
+
+    /* Spawn the tasks to run the background jobs */
+    for (i = 0; i < CFE_PLATFORM_ES_BACKGROUND_WORKERS; ++i)
+    {
+        if (i == 0)
+        {
+            strncpy(TaskName, CFE_ES_BACKGROUND_CHILD_NAME, sizeof(TaskName) - 1);
+            TaskName[sizeof(TaskName) - 1] = 0;
+        }
+        else
+        {
+            snprintf(TaskName, sizeof(TaskName), "%s%u", CFE_ES_BACKGROUND_CHILD_NAME, (unsigned int)i);
+        }
+
+        status = CFE_ES_CreateChildTask(&BgPtr->TaskID[i],
+                TaskName,
+                CFE_ES_BackgroundTask,
+                CFE_ES_BACKGROUND_CHILD_STACK_PTR,
+                CFE_ES_BACKGROUND_CHILD_STACK_SIZE,
+                CFE_ES_BACKGROUND_CHILD_PRIORITY,
+                CFE_ES_BACKGROUND_CHILD_FLAGS);
+
+        if (status != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("CFE_ES: Failed to create background task: %08lx\n", (unsigned long)status);
+            return status;
+        }
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -229,11 +500,18 @@ int32 CFE_ES_BackgroundInit(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CFE_ES_BackgroundCleanup(void)
 {
-    CFE_ES_DeleteChildTask(CFE_ES_Global.BackgroundTask.TaskID);
+    uint32 i;
+
+    for (i = 0; i < CFE_PLATFORM_ES_BACKGROUND_WORKERS; ++i)
+    {
+        CFE_ES_DeleteChildTask(CFE_ES_Global.BackgroundTask.TaskID[i]);
+        CFE_ES_Global.BackgroundTask.TaskID[i] = CFE_ES_TASKID_UNDEFINED;
+    }
     OS_BinSemDelete(CFE_ES_Global.BackgroundTask.WorkSem);
+    OS_MutSemDelete(CFE_ES_Global.BackgroundTask.JobMutex);
 
-    CFE_ES_Global.BackgroundTask.TaskID = CFE_ES_TASKID_UNDEFINED;
     CFE_ES_Global.BackgroundTask.WorkSem = OS_OBJECT_ID_UNDEFINED;
+    CFE_ES_Global.BackgroundTask.JobMutex = OS_OBJECT_ID_UNDEFINED;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -245,6 +523,10 @@ void CFE_ES_BackgroundCleanup(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CFE_ES_BackgroundWakeup(void)
 {
+    /* make every job due, so they all poll for the new work.
+     * Without atomics an increment could be lost, which only delays the poll. */
+    CFE_ES_AtomicAdd32(&CFE_ES_Global.BackgroundTask.WakeupCount, 1);
+
     /* wake up the background task by giving the sem.
      * This is "informational" and not strictly required,
      * but it will make the task immediately wake up and check for new
@@ -252,4 +534,111 @@ void CFE_ES_BackgroundWakeup(void)
     OS_BinSemGive(CFE_ES_Global.BackgroundTask.WorkSem);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_SubmitBackgroundJob                                              */
+/*                                                                               */
+/* Purpose: Adds a job from an application to the background jobs               */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t CFE_ES_SubmitBackgroundJob(CFE_ES_BackgroundJobFunc_t JobFunc, void *JobArg, uint16 Priority,
+        uint32 PeriodMsec, uint32 DeadlineMsec)
+{
+    CFE_Status_t Status;
+    CFE_ES_AppId_t AppId;
+    CFE_ES_BackgroundJobState_t *JobPtr;
+    uint32 i;
+
+    if (JobFunc == NULL || PeriodMsec == 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    Status = CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
+
+    OS_MutSemTake(CFE_ES_Global.BackgroundTask.JobMutex);
+
+    JobPtr = &CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_NUM_FIXED_JOBS];
+    for (i = CFE_ES_BACKGROUND_NUM_FIXED_JOBS; i < CFE_ES_BACKGROUND_MAX_JOBS; ++i)
+    {
+        if (JobPtr->RunFunc == NULL)
+        {
+            /* the first call is due at the next wakeup */
+            JobPtr->RunFunc = JobFunc;
+            JobPtr->JobArg = JobArg;
+            JobPtr->OwnerAppId = AppId;
+            JobPtr->ActivePeriod = PeriodMsec;
+            JobPtr->IdlePeriod = PeriodMsec;
+            JobPtr->Deadline = DeadlineMsec;
+            JobPtr->Priority = Priority;
+            JobPtr->Group = CFE_ES_BACKGROUND_GROUP_NONE;
+            JobPtr->IsSubmitted = true;
+            JobPtr->IsActive = true;
+            JobPtr->IsRunning = false;
+            JobPtr->IsCancelled = false;
+            JobPtr->WakeupCount = CFE_ES_AtomicLoad32(&CFE_ES_Global.BackgroundTask.WakeupCount);
+            CFE_PSP_GetTime(&JobPtr->LastRunTime);
+            Status = CFE_SUCCESS;
+            break;
+        }
+        ++JobPtr;
+    }
+
+    OS_MutSemGive(CFE_ES_Global.BackgroundTask.JobMutex);
+
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_BackgroundWakeup();
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_BackgroundCleanUpApp                                             */
+/*                                                                               */
+/* Purpose: Removes the background jobs submitted by an application              */
+/*                                                                               */
+/* Assumptions and Notes: A job of the app which is being run by a worker        */
+/* cannot be removed yet.  It is cancelled instead, so it is not run again and   */
+/* is removed when the running call returns, and CFE_ES_APP_CLEANUP_ERR is      */
+/* returned.  The app code must not be unloaded until this returns success.     */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_BackgroundCleanUpApp(CFE_ES_AppId_t AppId)
+{
+    CFE_ES_BackgroundJobState_t *JobPtr;
+    int32 Status;
+    uint32 i;
+
+    Status = CFE_SUCCESS;
 
+    OS_MutSemTake(CFE_ES_Global.BackgroundTask.JobMutex);
+
+    JobPtr = &CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_NUM_FIXED_JOBS];
+    for (i = CFE_ES_BACKGROUND_NUM_FIXED_JOBS; i < CFE_ES_BACKGROUND_MAX_JOBS; ++i)
+    {
+        if (JobPtr->RunFunc != NULL && CFE_RESOURCEID_TEST_EQUAL(JobPtr->OwnerAppId, AppId))
+        {
+            if (!JobPtr->IsRunning)
+            {
+                memset(JobPtr, 0, sizeof(*JobPtr));
+            }
+            else
+            {
+                JobPtr->IsCancelled = true;
+                Status = CFE_ES_APP_CLEANUP_ERR;
+            }
+        }
+        ++JobPtr;
+    }
+
+    OS_MutSemGive(CFE_ES_Global.BackgroundTask.JobMutex);
+
+    return Status;
+}
@@ -359,7 +359,7 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
     else
     {
         /* scan for a free slot */
-        PendingBlockId = CFE_ResourceId_FindNext(CDS->LastCDSBlockId, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES, CFE_ES_CheckCDSHandleSlotUsed);
+        PendingBlockId = CFE_ResourceId_FindNextFree(CDS->LastCDSBlockId, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES, CDS->RegistrySlotMap, CFE_ES_CheckCDSHandleSlotUsed);
         RegRecPtr = CFE_ES_LocateCDSBlockRecordByID(CFE_ES_CDSHANDLE_C(PendingBlockId));
 
         if (RegRecPtr != NULL)
@@ -423,13 +423,19 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
             RegRecPtr->Table = CriticalTbl;
 
             /* Save CDS Name in Registry */
-            strncpy(RegRecPtr->Name, Name, sizeof(RegRecPtr->Name)-1);
-            RegRecPtr->Name[sizeof(RegRecPtr->Name)-1] = 0;
+            CFE_ES_CDSBlockRecordSetName(RegRecPtr, Name);
             CFE_ES_CDSBlockRecordSetUsed(RegRecPtr, PendingBlockId);
+            CFE_ResourceId_SlotMapMark(CDS->RegistrySlotMap, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
+                    RegRecPtr - CDS->Registry, true);
         }
 
         if (Status == CFE_SUCCESS && (IsNewOffset || IsNewEntry))
         {
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+            /* Any shadow of the previous block content is no longer valid */
+            CFE_ES_CDSShadowDiscard(RegRecPtr);
+#endif
+
             /* If we succeeded at creating a CDS, save updated registry in the CDS */
             RegUpdateStatus = CFE_ES_UpdateCDSRegistry();
         }
@@ -631,6 +637,8 @@ int32 CFE_ES_InitCDSRegistry(void)
     if (Status == CFE_SUCCESS)
     {
         memset(CDS->Registry, 0, sizeof(CDS->Registry));
+        memset(CDS->RegistryNameIndex, 0, sizeof(CDS->RegistryNameIndex));
+        memset(CDS->RegistrySlotMap, 0, sizeof(CDS->RegistrySlotMap));
 
         Status = CFE_ES_UpdateCDSRegistry();
     }
@@ -751,6 +759,22 @@ int32 CFE_ES_UnlockCDS(void)
 }   /* End of CFE_ES_UnlockCDSRegistry() */
 
 
+/*******************************************************************
+**
+** CFE_ES_CDSBlockRecordNameMatch
+**
+** Local helper to check a CDS Registry Record against a name, for the
+** name index
+********************************************************************/
+
+static bool CFE_ES_CDSBlockRecordNameMatch(uint32 Idx, const char *CDSName)
+{
+    const CFE_ES_CDS_RegRec_t *CDSRegRecPtr = &CFE_ES_Global.CDSVars.Registry[Idx];
+
+    return (CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr) && strcmp(CDSName, CDSRegRecPtr->Name) == 0);
+}
+
+
 /*******************************************************************
 **
 ** CFE_ES_LocateCDSBlockRecordByName
@@ -761,37 +785,38 @@ int32 CFE_ES_UnlockCDS(void)
 CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByName(const char *CDSName)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
-    CFE_ES_CDS_RegRec_t *CDSRegRecPtr;
-    uint32 NumReg;
+    uint32 Idx;
 
-    CDSRegRecPtr = CDS->Registry;
-    NumReg = CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES;
-    while (true)
+    /* Perform a case sensitive name lookup through the name index */
+    if (CFE_ResourceId_NameIndexFind(CDS->RegistryNameIndex, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
+            CDSName, CFE_ES_CDSBlockRecordNameMatch, &Idx) != CFE_SUCCESS)
     {
-        if (NumReg == 0)
-        {
-            CDSRegRecPtr = NULL; /* not found */
-            break;
-        }
-
-        if (CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr))
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(CDSName, CDSRegRecPtr->Name) == 0)
-            {
-                /* If the names match, then stop */
-                break;
-            }
-        }
-
-        ++CDSRegRecPtr;
-        --NumReg;
+        return NULL; /* not found */
     }
 
-    return CDSRegRecPtr;
+    return &CDS->Registry[Idx];
 }   /* End of CFE_ES_LocateCDSBlockRecordByName() */
 
 
+/*******************************************************************
+**
+** CFE_ES_CDSBlockRecordSetName
+**
+** NOTE: For complete prolog information, see 'cfe_es_cds.h'
+********************************************************************/
+
+void CFE_ES_CDSBlockRecordSetName(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, const char *CDSName)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+
+    strncpy(CDSRegRecPtr->Name, CDSName, sizeof(CDSRegRecPtr->Name)-1);
+    CDSRegRecPtr->Name[sizeof(CDSRegRecPtr->Name)-1] = 0;
+
+    CFE_ResourceId_NameIndexAdd(CDS->RegistryNameIndex, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
+            CDSRegRecPtr - CDS->Registry, CDSRegRecPtr->Name);
+}   /* End of CFE_ES_CDSBlockRecordSetName() */
+
+
 /*******************************************************************
 **
 ** CFE_ES_RebuildCDS
@@ -803,6 +828,7 @@ int32 CFE_ES_RebuildCDS(void)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
     int32 Status;
+    uint32 Idx;
     
     /* First, determine if the CDS registry stored in the CDS is smaller or equal */
     /* in size to the CDS registry we are currently configured for                */
@@ -827,6 +853,20 @@ int32 CFE_ES_RebuildCDS(void)
 
     if (Status == CFE_PSP_SUCCESS)
     {
+        /* Index the names and slots of the recovered registry entries */
+        memset(CDS->RegistryNameIndex, 0, sizeof(CDS->RegistryNameIndex));
+        memset(CDS->RegistrySlotMap, 0, sizeof(CDS->RegistrySlotMap));
+        for (Idx = 0; Idx < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES; ++Idx)
+        {
+            if (CFE_ES_CDSBlockRecordIsUsed(&CDS->Registry[Idx]))
+            {
+                CFE_ResourceId_NameIndexAdd(CDS->RegistryNameIndex, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
+                        Idx, CDS->Registry[Idx].Name);
+                CFE_ResourceId_SlotMapMark(CDS->RegistrySlotMap, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
+                        Idx, true);
+            }
+        }
+
         /* Scan the memory pool and identify the created but currently unused memory blocks */
         Status = CFE_ES_RebuildCDSPool(CDS->DataSize, CDS_POOL_OFFSET);
     }
@@ -911,6 +951,11 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
                 {
                     /* Remove entry from the CDS Registry */
                     CFE_ES_CDSBlockRecordSetFree(RegRecPtr);
+                    CFE_ResourceId_SlotMapMark(CDS->RegistrySlotMap, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
+                            RegRecPtr - CDS->Registry, false);
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+                    CFE_ES_CDSShadowDiscard(RegRecPtr);
+#endif
 
                     Status = CFE_ES_UpdateCDSRegistry();
             
@@ -149,6 +149,37 @@ typedef struct CFE_ES_CDS_AccessCache
     int32                        AccessStatus; /**< The PSP status of the last read/write from CDS memory */
 } CFE_ES_CDS_AccessCache_t;
 
+/*
+ * A copy of a region of the CDS, read in one access
+ *
+ * While the memory pool is being rebuilt, block descriptors are taken
+ * from this copy rather than being read from the CDS individually.
+ */
+typedef struct CFE_ES_CDS_ReadAhead
+{
+    bool    Enabled;      /**< Whether descriptors are retrieved through the read-ahead buffer */
+    size_t  Offset;       /**< The offset where Data is copied from */
+    size_t  Size;         /**< The size of valid Data, zero if none */
+    uint8   Data[CFE_PLATFORM_ES_CDS_READAHEAD_SIZE];
+} CFE_ES_CDS_ReadAhead_t;
+
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+/*
+ * State of the RAM shadow of a CDS block
+ *
+ * This is kept in a table parallel to the registry, rather than in the
+ * registry entry itself, because the registry entries are also stored in
+ * the CDS.  The shadow data is held at the same offset as the block in CDS.
+ */
+typedef struct CFE_ES_CDS_ShadowState
+{
+    bool    Loaded;       /**< Whether the shadow holds the content of the block */
+    uint32  Crc;          /**< CRC of the shadow content, as stored in the block header */
+    size_t  DirtyStart;   /**< Start of the user data range not yet written to CDS */
+    size_t  DirtyEnd;     /**< End of the user data range not yet written to CDS, equal to start if none */
+} CFE_ES_CDS_ShadowState_t;
+#endif
+
 /**
  * Instance data associated with a CDS
  *
@@ -175,6 +206,20 @@ typedef struct
     size_t               DataSize;                           /**< \brief Size of actual user data pool */
     CFE_ResourceId_t     LastCDSBlockId;                     /**< \brief Last issued CDS block ID */
     CFE_ES_CDS_RegRec_t  Registry[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES];  /**< \brief CDS Registry (Local Copy) */
+    CFE_ResourceId_NameIndexEntry_t RegistryNameIndex[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES]; /**< \brief Name index of the CDS Registry */
+    uint32               RegistrySlotMap[CFE_RESOURCEID_SLOTMAP_WORDS(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES)]; /**< \brief Used entries of the CDS Registry */
+
+    CFE_ES_CDS_ReadAhead_t ReadAhead;                        /**< \brief Descriptor read-ahead, used while rebuilding */
+
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+    /*
+     * RAM shadow of the CDS content, and the state of each block in it.
+     * Blocks are written from here to the CDS by CFE_ES_CDSShadowFlush().
+     */
+    uint32                   ShadowFlushElapsed;                 /**< \brief Time since the last shadow flush (ms) */
+    CFE_ES_CDS_ShadowState_t Shadow[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES];
+    uint8                    ShadowData[CFE_PLATFORM_ES_CDS_SIZE];
+#endif
 } CFE_ES_CDS_Instance_t;
 
 
@@ -396,7 +441,7 @@ static inline size_t CFE_ES_CDSBlockRecordGetUserSize(const CFE_ES_CDS_RegRec_t
  *
  * Checks if a table slot is available for a potential new ID
  * This is a helper function intended to be used with 
- * CFE_ResourceId_FindNext() for allocating new IDs
+ * CFE_ResourceId_FindNextFree() for allocating new IDs
  * 
  * As this dereferences fields within the record, global data must be
  * locked prior to invoking this function.
@@ -540,6 +585,25 @@ void CFE_ES_FormCDSName(char *FullCDSName, const char *CDSName, CFE_ES_AppId_t T
 ******************************************************************************/
 CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByName(const char *CDSName);
 
+/*****************************************************************************/
+/**
+** \brief Sets the name of a CDS Registry Record
+**
+** \par Description
+**        Copies the name into the Registry Record and adds the record
+**        to the name index used by #CFE_ES_LocateCDSBlockRecordByName.
+**
+** \par Assumptions, External Events, and Notes:
+**          The CDS Registry must be locked by the caller.
+**
+** \param[in]  CDSRegRecPtr - Pointer to the CDS Registry Record
+**
+** \param[in]  CDSName - Pointer to character string containing complete
+**                       CDS Name (of the format "AppName.CDSName").
+**
+******************************************************************************/
+void CFE_ES_CDSBlockRecordSetName(CFE_ES_CDS_RegRec_t *CDSRegRecPtr, const char *CDSName);
+
 /*****************************************************************************/
 /**
 ** \brief Locks access to the CDS
@@ -43,9 +43,17 @@
 #include "cfe_psp.h"
 #include "cfe_es_generic_pool.h"
 #include "cfe_es_cds_mempool.h"
+#include "cfe_es_crc.h"
 #include "cfe_es_global.h"
 #include "cfe_es_log.h"
 
+
+/*
+ * Number of bytes of old content handled at a time when
+ * updating the CRC of a CDS block for a range write
+ */
+#define CFE_ES_CDS_RANGE_CHUNK_SIZE    128
+
 /*****************************************************************************/
 /*
 ** Type Definitions
@@ -94,10 +102,48 @@ int32 CFE_ES_CDS_PoolRetrieve(CFE_ES_GenPoolRecord_t *GenPoolRecPtr,
         CFE_ES_GenPoolBD_t **BdPtr)
 {
     CFE_ES_CDS_Instance_t *CDS = (CFE_ES_CDS_Instance_t *)GenPoolRecPtr;
+    CFE_ES_CDS_ReadAhead_t *ReadAheadPtr = &CDS->ReadAhead;
+    size_t ReadSize;
 
     *BdPtr = &CDS->Cache.Data.Desc;
 
-    return CFE_ES_CDS_CacheFetch(&CDS->Cache, Offset, sizeof(CFE_ES_GenPoolBD_t));
+    if (!ReadAheadPtr->Enabled || Offset >= CDS->TotalSize)
+    {
+        return CFE_ES_CDS_CacheFetch(&CDS->Cache, Offset, sizeof(CFE_ES_GenPoolBD_t));
+    }
+
+    /*
+     * If the descriptor is not within the read-ahead buffer, then refill
+     * the buffer with the region of the CDS starting at the descriptor.
+     */
+    if (Offset < ReadAheadPtr->Offset ||
+            (Offset + sizeof(CFE_ES_GenPoolBD_t)) > (ReadAheadPtr->Offset + ReadAheadPtr->Size))
+    {
+        ReadSize = CDS->TotalSize - Offset;
+        if (ReadSize > sizeof(ReadAheadPtr->Data))
+        {
+            ReadSize = sizeof(ReadAheadPtr->Data);
+        }
+
+        ReadAheadPtr->Size = 0;
+        CDS->Cache.AccessStatus = CFE_PSP_ReadFromCDS(ReadAheadPtr->Data, Offset, ReadSize);
+        if (CDS->Cache.AccessStatus != CFE_PSP_SUCCESS)
+        {
+            return CFE_ES_CDS_ACCESS_ERROR;
+        }
+
+        ReadAheadPtr->Offset = Offset;
+        ReadAheadPtr->Size = ReadSize;
+    }
+
+    /* A descriptor at the very end of the CDS may be cut short */
+    if ((Offset + sizeof(CFE_ES_GenPoolBD_t)) > (ReadAheadPtr->Offset + ReadAheadPtr->Size))
+    {
+        return CFE_ES_CDS_CacheFetch(&CDS->Cache, Offset, sizeof(CFE_ES_GenPoolBD_t));
+    }
+
+    return CFE_ES_CDS_CachePreload(&CDS->Cache, &ReadAheadPtr->Data[Offset - ReadAheadPtr->Offset],
+            Offset, sizeof(CFE_ES_GenPoolBD_t));
 }
 
 /*
@@ -110,9 +156,22 @@ int32 CFE_ES_CDS_PoolCommit(CFE_ES_GenPoolRecord_t *GenPoolRecPtr,
         const CFE_ES_GenPoolBD_t *BdPtr)
 {
     CFE_ES_CDS_Instance_t *CDS = (CFE_ES_CDS_Instance_t *)GenPoolRecPtr;
+    CFE_ES_CDS_ReadAhead_t *ReadAheadPtr = &CDS->ReadAhead;
 
     CFE_ES_CDS_CachePreload(&CDS->Cache, BdPtr, Offset, sizeof(CFE_ES_GenPoolBD_t));
 
+    /* Keep the read-ahead buffer consistent with the CDS */
+    if (Offset >= ReadAheadPtr->Offset &&
+            (Offset + sizeof(CFE_ES_GenPoolBD_t)) <= (ReadAheadPtr->Offset + ReadAheadPtr->Size))
+    {
+        memcpy(&ReadAheadPtr->Data[Offset - ReadAheadPtr->Offset], BdPtr, sizeof(CFE_ES_GenPoolBD_t));
+    }
+    else if (Offset < (ReadAheadPtr->Offset + ReadAheadPtr->Size) &&
+            (Offset + sizeof(CFE_ES_GenPoolBD_t)) > ReadAheadPtr->Offset)
+    {
+        ReadAheadPtr->Size = 0;
+    }
+
     return CFE_ES_CDS_CacheFlush(&CDS->Cache);
 }
 
@@ -181,9 +240,18 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset)
         return Status;
     }
 
-    /* Now walk through the CDS memory and attempt to recover existing CDS blocks */
+    /*
+     * Now walk through the CDS memory and attempt to recover existing CDS blocks.
+     * The descriptors are read a region at a time, through the read-ahead buffer.
+     */
+    CDS->ReadAhead.Size = 0;
+    CDS->ReadAhead.Enabled = true;
+
     Status = CFE_ES_GenPoolRebuild(&CDS->Pool);
 
+    CDS->ReadAhead.Enabled = false;
+    CDS->ReadAhead.Size = 0;
+
     if (Status != CFE_SUCCESS)
     {
         CFE_ES_SysLogWrite_Unsync("CFE_ES:RebuildCDS-Err rebuilding CDS (Stat=0x%08x)\n", (unsigned int)Status);
@@ -196,20 +264,360 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset)
 
 /*
 ** Function:
-**   CFE_ES_CDSBlockWrite
+**   CFE_ES_CDSRangeCrcUpdate
 **
 ** Purpose:
+**   Updates the CRC of a CDS block for a change to a range of its content.
+**
+**   The CRC is linear: the CRC of the new content is the CRC of the old content
+**   XOR the CRC of the difference between them.  The difference is zero outside
+**   the changed range, so only the range needs to be fed through the CRC.
 **
+**   The old content of the range is taken from OldData if it is not NULL,
+**   otherwise it is read from the CDS at OldOffset.
 */
-int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
+static int32 CFE_ES_CDSRangeCrcUpdate(uint32 *CrcPtr, const uint8 *OldData, size_t OldOffset,
+        const uint8 *NewData, size_t Size, size_t TrailingSize)
+{
+    uint8  Delta[CFE_ES_CDS_RANGE_CHUNK_SIZE];
+    uint32 DeltaCrc;
+    size_t ChunkSize;
+    size_t i;
+    int32  Status;
+
+    Status = CFE_PSP_SUCCESS;
+    DeltaCrc = 0;
+    while (Size > 0)
+    {
+        ChunkSize = Size;
+        if (ChunkSize > sizeof(Delta))
+        {
+            ChunkSize = sizeof(Delta);
+        }
+
+        if (OldData != NULL)
+        {
+            memcpy(Delta, OldData, ChunkSize);
+            OldData += ChunkSize;
+        }
+        else
+        {
+            Status = CFE_PSP_ReadFromCDS(Delta, OldOffset, ChunkSize);
+            if (Status != CFE_PSP_SUCCESS)
+            {
+                break;
+            }
+            OldOffset += ChunkSize;
+        }
+
+        for (i = 0; i < ChunkSize; ++i)
+        {
+            Delta[i] ^= NewData[i];
+        }
+
+        DeltaCrc = CFE_ES_CrcRawUpdate(CFE_MISSION_ES_DEFAULT_CRC, DeltaCrc, Delta, ChunkSize);
+        NewData += ChunkSize;
+        Size -= ChunkSize;
+    }
+
+    if (Status == CFE_PSP_SUCCESS)
+    {
+        *CrcPtr = CFE_ES_CrcApplyDelta(CFE_MISSION_ES_DEFAULT_CRC, *CrcPtr, DeltaCrc, TrailingSize);
+    }
+
+    return Status;
+}
+
+/*
+** Function:
+**   CFE_ES_CDSBlockCommit
+**
+** Purpose:
+**   Writes the header of a CDS block, then a range of its user data.
+**   The CDS must be locked by the caller.  Any error is described in LogMessage.
+*/
+static int32 CFE_ES_CDSBlockCommit(CFE_ES_CDS_Instance_t *CDS, size_t BlockOffset, uint32 Crc,
+        const void *Data, size_t DataOffset, size_t DataSize, char *LogMessage, size_t LogMessageSize)
+{
+    int32 Status;
+
+    CDS->Cache.Data.BlockHeader.Crc = Crc;
+    CDS->Cache.Offset = BlockOffset;
+    CDS->Cache.Size = sizeof(CFE_ES_CDS_BlockHeader_t);
+
+    /* Write the new block descriptor for the data coming from the Application */
+    Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_SysLog_snprintf(LogMessage, LogMessageSize,
+                "CFE_ES:CDSBlkWrite-Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                (unsigned int)CDS->Cache.AccessStatus, (unsigned long)BlockOffset);
+    }
+    else
+    {
+        Status = CFE_PSP_WriteToCDS(Data, DataOffset, DataSize);
+        if (Status != CFE_PSP_SUCCESS)
+        {
+            CFE_ES_SysLog_snprintf(LogMessage, LogMessageSize,
+                    "CFE_ES:CDSBlkWrite-Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                    (unsigned int)Status, (unsigned long)DataOffset);
+        }
+    }
+
+    return Status;
+}
+
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+
+/*
+** Function:
+**   CFE_ES_CDSShadowLookup
+**
+** Purpose:
+**   Gets the RAM shadow state of a CDS block, or NULL if the block does
+**   not fit in the shadow, in which case the CDS is accessed directly.
+*/
+static CFE_ES_CDS_ShadowState_t *CFE_ES_CDSShadowLookup(CFE_ES_CDS_Instance_t *CDS,
+        const CFE_ES_CDS_RegRec_t *CDSRegRecPtr)
+{
+    if ((CDSRegRecPtr->BlockOffset + CDSRegRecPtr->BlockSize) > sizeof(CDS->ShadowData))
+    {
+        return NULL;
+    }
+
+    return &CDS->Shadow[CDSRegRecPtr - CDS->Registry];
+}
+
+/*
+** Function:
+**   CFE_ES_CDSShadowLoad
+**
+** Purpose:
+**   Reads a CDS block into the RAM shadow, if it is not already there.
+**   The CDS must be locked by the caller.
+*/
+static int32 CFE_ES_CDSShadowLoad(CFE_ES_CDS_Instance_t *CDS, CFE_ES_CDS_ShadowState_t *ShadowPtr,
+        const CFE_ES_CDS_RegRec_t *CDSRegRecPtr)
+{
+    size_t UserDataOffset;
+    int32  Status;
+
+    if (ShadowPtr->Loaded)
+    {
+        return CFE_SUCCESS;
+    }
+
+    UserDataOffset = CDSRegRecPtr->BlockOffset + sizeof(CFE_ES_CDS_BlockHeader_t);
+
+    Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset,
+            sizeof(CFE_ES_CDS_BlockHeader_t));
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_PSP_ReadFromCDS(&CDS->ShadowData[UserDataOffset], UserDataOffset,
+                CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr));
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        ShadowPtr->Crc = CDS->Cache.Data.BlockHeader.Crc;
+        ShadowPtr->DirtyStart = 0;
+        ShadowPtr->DirtyEnd = 0;
+        ShadowPtr->Loaded = true;
+    }
+
+    return Status;
+}
+
+/*
+** Function:
+**   CFE_ES_CDSShadowWrite
+**
+** Purpose:
+**   Writes a range of a CDS block into the RAM shadow, and marks it
+**   to be written to the CDS at the next flush.
+**   The CDS must be locked by the caller.
+*/
+static int32 CFE_ES_CDSShadowWrite(CFE_ES_CDS_Instance_t *CDS, CFE_ES_CDS_ShadowState_t *ShadowPtr,
+        const CFE_ES_CDS_RegRec_t *CDSRegRecPtr, const void *DataToWrite, size_t Offset, size_t Size,
+        bool IsWholeBlock)
+{
+    uint8  *ShadowData;
+    size_t  UserDataSize;
+    int32   Status;
+
+    ShadowData = &CDS->ShadowData[CDSRegRecPtr->BlockOffset + sizeof(CFE_ES_CDS_BlockHeader_t)];
+    UserDataSize = CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr);
+
+    if (IsWholeBlock)
+    {
+        memcpy(ShadowData, DataToWrite, UserDataSize);
+        ShadowPtr->Crc = CFE_ES_CalculateCRC(ShadowData, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+        ShadowPtr->DirtyStart = 0;
+        ShadowPtr->DirtyEnd = UserDataSize;
+        ShadowPtr->Loaded = true;
+        return CFE_SUCCESS;
+    }
+
+    Status = CFE_ES_CDSShadowLoad(CDS, ShadowPtr, CDSRegRecPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_CDSRangeCrcUpdate(&ShadowPtr->Crc, &ShadowData[Offset], 0,
+                DataToWrite, Size, UserDataSize - Offset - Size);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        memcpy(&ShadowData[Offset], DataToWrite, Size);
+
+        if (ShadowPtr->DirtyEnd == ShadowPtr->DirtyStart)
+        {
+            ShadowPtr->DirtyStart = Offset;
+            ShadowPtr->DirtyEnd = Offset + Size;
+        }
+        else
+        {
+            if (Offset < ShadowPtr->DirtyStart)
+            {
+                ShadowPtr->DirtyStart = Offset;
+            }
+            if ((Offset + Size) > ShadowPtr->DirtyEnd)
+            {
+                ShadowPtr->DirtyEnd = Offset + Size;
+            }
+        }
+    }
+
+    return Status;
+}
+
+/*
+** Function:
+**   CFE_ES_CDSShadowDiscard
+**
+** Purpose:
+**
+*/
+void CFE_ES_CDSShadowDiscard(const CFE_ES_CDS_RegRec_t *CDSRegRecPtr)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+
+    memset(&CDS->Shadow[CDSRegRecPtr - CDS->Registry], 0, sizeof(CFE_ES_CDS_ShadowState_t));
+}
+
+/*
+** Function:
+**   CFE_ES_CDSShadowFlush
+**
+** Purpose:
+**
+*/
+int32 CFE_ES_CDSShadowFlush(void)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+    char  LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32 Status;
+    int32 Result;
+    uint32 i;
+    size_t                    UserDataOffset;
+    CFE_ES_CDS_RegRec_t      *CDSRegRecPtr;
+    CFE_ES_CDS_ShadowState_t *ShadowPtr;
+
+    if (!CFE_ES_Global.CDSIsAvailable)
+    {
+        return CFE_SUCCESS;
+    }
+
+    LogMessage[0] = 0;
+    Status = CFE_SUCCESS;
+
+    CFE_ES_LockCDS();
+
+    CDSRegRecPtr = CDS->Registry;
+    ShadowPtr = CDS->Shadow;
+    for (i = 0; i < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES; ++i)
+    {
+        if (CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr) && ShadowPtr->Loaded &&
+                ShadowPtr->DirtyEnd > ShadowPtr->DirtyStart)
+        {
+            UserDataOffset = CDSRegRecPtr->BlockOffset + sizeof(CFE_ES_CDS_BlockHeader_t);
+
+            Result = CFE_ES_CDSBlockCommit(CDS, CDSRegRecPtr->BlockOffset, ShadowPtr->Crc,
+                    &CDS->ShadowData[UserDataOffset + ShadowPtr->DirtyStart],
+                    UserDataOffset + ShadowPtr->DirtyStart,
+                    ShadowPtr->DirtyEnd - ShadowPtr->DirtyStart,
+                    LogMessage, sizeof(LogMessage));
+            if (Result == CFE_SUCCESS)
+            {
+                ShadowPtr->DirtyStart = 0;
+                ShadowPtr->DirtyEnd = 0;
+            }
+            else
+            {
+                Status = Result;
+            }
+        }
+
+        ++CDSRegRecPtr;
+        ++ShadowPtr;
+    }
+
+    CFE_ES_UnlockCDS();
+
+    /* Do the actual syslog if something went wrong */
+    if (LogMessage[0] != 0)
+    {
+        CFE_ES_SYSLOG_APPEND(LogMessage);
+    }
+
+    return Status;
+}
+
+/*
+** Function:
+**   CFE_ES_RunCDSShadowFlush
+**
+** Purpose:
+**
+*/
+bool CFE_ES_RunCDSShadowFlush(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+
+    CDS->ShadowFlushElapsed += ElapsedTime;
+    if (CDS->ShadowFlushElapsed >= CFE_PLATFORM_ES_CDS_SHADOW_FLUSH_MSEC)
+    {
+        CDS->ShadowFlushElapsed = 0;
+        CFE_ES_CDSShadowFlush();
+    }
+
+    /* The flush is periodic, there is never more work pending */
+    return false;
+}
+
+#endif /* CFE_PLATFORM_ES_CDS_SHADOW */
+
+/*
+** Function:
+**   CFE_ES_CDSBlockWriteImpl
+**
+** Purpose:
+**   Common implementation of the whole block and range writes.
+**   For a whole block write, Offset and Size are ignored.
+*/
+static int32 CFE_ES_CDSBlockWriteImpl(CFE_ES_CDSHandle_t Handle, const void *DataToWrite,
+        size_t Offset, size_t Size, bool IsWholeBlock)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
     char  LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
     int32 Status;
+    uint32 Crc;
     size_t                   BlockSize;
     size_t                   UserDataSize;
     size_t                   UserDataOffset;
     CFE_ES_CDS_RegRec_t     *CDSRegRecPtr;
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+    CFE_ES_CDS_ShadowState_t *ShadowPtr;
+#endif
 
     /* Ensure the the log message is an empty string in case it is never written to */
     LogMessage[0] = 0;
@@ -250,27 +658,63 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
             UserDataOffset = CDSRegRecPtr->BlockOffset;
             UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
 
-            CDS->Cache.Data.BlockHeader.Crc = CFE_ES_CalculateCRC(
-                    DataToWrite, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
-            CDS->Cache.Offset = CDSRegRecPtr->BlockOffset;
-            CDS->Cache.Size = sizeof(CFE_ES_CDS_BlockHeader_t);
+            if (IsWholeBlock)
+            {
+                Offset = 0;
+                Size = UserDataSize;
+            }
 
-            /* Write the new block descriptor for the data coming from the Application */
-            Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
-            if (Status != CFE_SUCCESS)
+            if (Offset > UserDataSize || Size > (UserDataSize - Offset))
             {
                 CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
-                        "CFE_ES:CDSBlkWrite-Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
-                        (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+                        "CFE_ES:CDSBlkWrite-Range %lu+%lu exceeds block size %lu\n",
+                        (unsigned long)Offset, (unsigned long)Size, (unsigned long)UserDataSize);
+                Status = CFE_ES_CDS_INVALID_SIZE;
             }
-            else
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+            else if ((ShadowPtr = CFE_ES_CDSShadowLookup(CDS, CDSRegRecPtr)) != NULL)
             {
-                Status = CFE_PSP_WriteToCDS(DataToWrite, UserDataOffset, UserDataSize);
-                if (Status != CFE_PSP_SUCCESS)
+                Status = CFE_ES_CDSShadowWrite(CDS, ShadowPtr, CDSRegRecPtr, DataToWrite,
+                        Offset, Size, IsWholeBlock);
+                if (Status != CFE_SUCCESS)
                 {
                     CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
-                            "CFE_ES:CDSBlkWrite-Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
-                            (unsigned int)Status, (unsigned long)UserDataOffset);
+                            "CFE_ES:CDSBlkWrite-Err reading data from CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                            (unsigned int)Status, (unsigned long)CDSRegRecPtr->BlockOffset);
+                }
+            }
+#endif
+            else
+            {
+                if (IsWholeBlock)
+                {
+                    Crc = CFE_ES_CalculateCRC(DataToWrite, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+                }
+                else
+                {
+                    /* Update the CRC from the header for the change to the range */
+                    Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset,
+                            sizeof(CFE_ES_CDS_BlockHeader_t));
+                    if (Status == CFE_SUCCESS)
+                    {
+                        Crc = CDS->Cache.Data.BlockHeader.Crc;
+                        Status = CFE_ES_CDSRangeCrcUpdate(&Crc, NULL, UserDataOffset + Offset,
+                                DataToWrite, Size, UserDataSize - Offset - Size);
+                    }
+
+                    if (Status != CFE_SUCCESS)
+                    {
+                        CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                                "CFE_ES:CDSBlkWrite-Err reading data from CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                                (unsigned int)Status, (unsigned long)CDSRegRecPtr->BlockOffset);
+                    }
+                }
+
+                if (Status == CFE_SUCCESS)
+                {
+                    Status = CFE_ES_CDSBlockCommit(CDS, CDSRegRecPtr->BlockOffset, Crc,
+                            DataToWrite, UserDataOffset + Offset, Size,
+                            LogMessage, sizeof(LogMessage));
                 }
             }
         }
@@ -291,6 +735,30 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
     return Status;
 }
 
+/*
+** Function:
+**   CFE_ES_CDSBlockWrite
+**
+** Purpose:
+**
+*/
+int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
+{
+    return CFE_ES_CDSBlockWriteImpl(Handle, DataToWrite, 0, 0, true);
+}
+
+/*
+** Function:
+**   CFE_ES_CDSBlockWriteRange
+**
+** Purpose:
+**
+*/
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSHandle_t Handle, const void *DataToWrite, size_t Offset, size_t Size)
+{
+    return CFE_ES_CDSBlockWriteImpl(Handle, DataToWrite, Offset, Size, false);
+}
+
 
 /*
 ** Function:
@@ -305,10 +773,14 @@ int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
     char   LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
     int32 Status;
     uint32 CrcOfCDSData;
+    uint32 HeaderCrc;
     size_t                   BlockSize;
     size_t                   UserDataSize;
     size_t                   UserDataOffset;
     CFE_ES_CDS_RegRec_t     *CDSRegRecPtr;
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+    CFE_ES_CDS_ShadowState_t *ShadowPtr;
+#endif
 
     /* Validate the handle before doing anything */
     LogMessage[0] = 0;
@@ -344,28 +816,42 @@ int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
                 UserDataOffset = CDSRegRecPtr->BlockOffset;
                 UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
 
-                /* Read the header */
-                Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset,
-                        sizeof(CFE_ES_CDS_BlockHeader_t));
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+                /* Blocks in the RAM shadow are read from there */
+                ShadowPtr = CFE_ES_CDSShadowLookup(CDS, CDSRegRecPtr);
+                if (ShadowPtr != NULL)
+                {
+                    Status = CFE_ES_CDSShadowLoad(CDS, ShadowPtr, CDSRegRecPtr);
+                    if (Status == CFE_SUCCESS)
+                    {
+                        memcpy(DataRead, &CDS->ShadowData[UserDataOffset], UserDataSize);
+                        HeaderCrc = ShadowPtr->Crc;
+                    }
+                }
+                else
+#endif
+                {
+                    /* Read the header */
+                    Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset,
+                            sizeof(CFE_ES_CDS_BlockHeader_t));
+
+                    if (Status == CFE_SUCCESS)
+                    {
+                        /* Read the data block */
+                        HeaderCrc = CDS->Cache.Data.BlockHeader.Crc;
+                        Status = CFE_PSP_ReadFromCDS(DataRead, UserDataOffset, UserDataSize);
+                    }
+                }
 
                 if (Status == CFE_SUCCESS)
                 {
-                    /* Read the data block */
-                    Status = CFE_PSP_ReadFromCDS(DataRead, UserDataOffset, UserDataSize);
-                    if (Status == CFE_PSP_SUCCESS)
+                    /* Compute the CRC for the data read from the CDS and determine if the data is still valid */
+                    CrcOfCDSData = CFE_ES_CalculateCRC(DataRead, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+                    /* If the CRCs do not match, report an error */
+                    if (CrcOfCDSData != HeaderCrc)
                     {
-                        /* Compute the CRC for the data read from the CDS and determine if the data is still valid */
-                        CrcOfCDSData = CFE_ES_CalculateCRC(DataRead, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
-
-                        /* If the CRCs do not match, report an error */
-                        if (CrcOfCDSData != CDS->Cache.Data.BlockHeader.Crc)
-                        {
-                            Status = CFE_ES_CDS_BLOCK_CRC_ERR;
-                        }
-                        else
-                        {
-                            Status = CFE_SUCCESS;
-                        }
+                        Status = CFE_ES_CDS_BLOCK_CRC_ERR;
                     }
                 }
             }
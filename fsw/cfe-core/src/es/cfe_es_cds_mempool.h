@@ -77,6 +77,74 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite);
 
 int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle);
 
+/*****************************************************************************/
+/**
+** \brief Writes a range of a CDS block
+**
+** \par Description
+**        Writes Size bytes at Offset within the user data of a CDS block.
+**        The block CRC is updated from the difference between the old and
+**        new content of the range, so only the range is read and written.
+**
+** \par Assumptions, External Events, and Notes:
+**        The incremental CRC update relies on the linearity of the CRC,
+**        see #CFE_ES_CrcApplyDelta.
+**
+** \return #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \return #CFE_ES_CDS_INVALID_SIZE         \copydoc CFE_ES_CDS_INVALID_SIZE
+** \return #CFE_ES_ERR_RESOURCEID_NOT_VALID \copydoc CFE_ES_ERR_RESOURCEID_NOT_VALID
+**
+******************************************************************************/
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSHandle_t Handle, const void *DataToWrite, size_t Offset, size_t Size);
+
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+/*****************************************************************************/
+/**
+** \brief Discards the RAM shadow of a CDS block
+**
+** \par Description
+**        Called when a registry entry is allocated, reallocated or freed,
+**        so the next access loads the block from the CDS.
+**
+** \par Assumptions, External Events, and Notes:
+**        The CDS must be locked by the caller.
+**
+******************************************************************************/
+void CFE_ES_CDSShadowDiscard(const CFE_ES_CDS_RegRec_t *CDSRegRecPtr);
+
+/*****************************************************************************/
+/**
+** \brief Writes the changed ranges of the RAM shadow to the CDS
+**
+** \par Description
+**        Writes the changed range and the header of every CDS block
+**        which has been written since the last flush.
+**
+** \par Assumptions, External Events, and Notes:
+**        Takes the CDS lock.
+**
+** \return #CFE_SUCCESS          \copydoc CFE_SUCCESS
+** \return Any of the return values from #CFE_ES_CDS_CacheFlush or CFE_PSP_WriteToCDS
+**
+******************************************************************************/
+int32 CFE_ES_CDSShadowFlush(void);
+
+/*****************************************************************************/
+/**
+** \brief Background job to flush the CDS RAM shadow
+**
+** \par Description
+**        Calls #CFE_ES_CDSShadowFlush every #CFE_PLATFORM_ES_CDS_SHADOW_FLUSH_MSEC
+**
+** \par Assumptions, External Events, and Notes:
+**        Called from the ES background task.
+**
+** \return false, as the job never needs a faster wakeup.
+**
+******************************************************************************/
+bool CFE_ES_RunCDSShadowFlush(uint32 ElapsedTime, void *Arg);
+#endif
+
 size_t CFE_ES_CDSReqdMinSize(uint32 MaxNumBlocksToSupport);
 
 #endif  /* _cfe_es_cds_mempool_ */
@@ -0,0 +1,107 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File: cfe_es_cputime.c
+**
+** Purpose: This file contains the functions which read the CPU time used by
+**  each task, for the task CPU utilization telemetry.
+**
+**  OSAL does not provide the CPU time of tasks, so each task gets a PSP
+**  reference to its own CPU time when it starts, and ES reads the CPU time
+**  of all tasks through the PSP from its background task.  If the PSP does
+**  not support this on this system, CFE_ES_NOT_IMPLEMENTED is returned.
+**
+**  This is a separate file so that the ES unit test can replace it with
+**  a stub.
+**
+*/
+
+/*
+** Include Section
+*/
+
+#include "private/cfe_private.h"
+#include "cfe_es.h"
+#include "cfe_es_apps.h"
+#include "cfe_psp.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_GetTaskCpuClock                                                  */
+/*                                                                               */
+/* Purpose: Gets the reference to the CPU time of the calling task               */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_GetTaskCpuClock(CFE_ES_TaskCpuClock_t *ClockPtr)
+{
+    int32 PspStatus;
+
+    ClockPtr->IsValid = false;
+
+    PspStatus = CFE_PSP_GetTaskCpuTimeRef(&ClockPtr->CpuTimeRef);
+    if (PspStatus == CFE_PSP_ERROR_NOT_IMPLEMENTED)
+    {
+        return CFE_ES_NOT_IMPLEMENTED;
+    }
+
+    if (PspStatus != CFE_PSP_SUCCESS)
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    ClockPtr->IsValid = true;
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_ReadTaskCpuTime                                                  */
+/*                                                                               */
+/* Purpose: Reads the CPU time used by a task, in microseconds                   */
+/*                                                                               */
+/* Assumptions and Notes: The reference is only valid while the task exists,    */
+/* so this fails once the task has exited.                                       */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_ReadTaskCpuTime(const CFE_ES_TaskCpuClock_t *ClockPtr, uint64 *CpuTimeUsecPtr)
+{
+    OS_time_t CpuTime;
+    int32     PspStatus;
+
+    if (!ClockPtr->IsValid)
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    PspStatus = CFE_PSP_ReadTaskCpuTime(ClockPtr->CpuTimeRef, &CpuTime);
+    if (PspStatus == CFE_PSP_ERROR_NOT_IMPLEMENTED)
+    {
+        return CFE_ES_NOT_IMPLEMENTED;
+    }
+
+    if (PspStatus != CFE_PSP_SUCCESS)
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    *CpuTimeUsecPtr = (uint64)OS_TimeGetTotalMicroseconds(CpuTime);
+
+    return CFE_SUCCESS;
+}
@@ -0,0 +1,83 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+**  File:
+**  cfe_es_crc.h
+**
+**  Purpose:
+**  This file contains the internal CRC routines used by CFE_ES_CalculateCRC
+**  and by the CDS for incremental CRC updates.
+**
+**  These operate on the raw (reflected) CRC register, without the initial
+**  value or final XOR of the CRC type.  The CRC-16 register is 16 bits, and
+**  the CRC-32 and CRC-32C registers are 32 bits.
+**
+*/
+
+#ifndef cfe_es_crc_h
+#define cfe_es_crc_h
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "cfe_es.h"
+
+/*****************************************************************************/
+/**
+** \brief Updates a raw CRC register with a block of data
+**
+** \par Description
+**        Feeds DataLength bytes through the CRC register of the given type.
+**        CRC-16 and CRC-32 use slicing-by-8 tables.  CRC-32C uses the CPU
+**        CRC32 instructions where available (SSE4.2 or ARMv8), otherwise
+**        slicing-by-8 tables.
+**
+** \par Assumptions, External Events, and Notes:
+**        Unknown CRC types return the register unchanged.
+**
+** \return The updated register
+**
+******************************************************************************/
+uint32 CFE_ES_CrcRawUpdate(uint32 TypeCRC, uint32 Crc, const void *DataPtr, size_t DataLength);
+
+/*****************************************************************************/
+/**
+** \brief Updates a CRC for a change to part of the data
+**
+** \par Description
+**        Given the CRC of some data as returned by #CFE_ES_CalculateCRC
+**        (with an InputCRC of 0), returns the CRC of the data after it is
+**        XORed with a delta.  The delta is described by DeltaCrc, which is
+**        the raw register (starting from 0) of the changed bytes XOR their
+**        old values, and NumZeroBytes, the number of bytes after them.
+**
+** \par Assumptions, External Events, and Notes:
+**        This relies on the CRC being linear in the data, for data of
+**        a fixed length.  It takes time in proportion to the log of
+**        NumZeroBytes.
+**
+** \return The updated CRC, in the format returned by #CFE_ES_CalculateCRC
+**
+******************************************************************************/
+uint32 CFE_ES_CrcApplyDelta(uint32 TypeCRC, uint32 Crc, uint32 DeltaCrc, size_t NumZeroBytes);
+
+#endif  /* cfe_es_crc_h */
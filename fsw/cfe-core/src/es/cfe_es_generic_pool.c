@@ -42,6 +42,7 @@
 #include "osapi.h"
 #include "cfe_es.h"
 #include "cfe_es_generic_pool.h"
+#include "cfe_es_atomic.h"
 #include "cfe_es_global.h"
 #include "cfe_platform_cfg.h"
 
@@ -53,24 +54,108 @@
 
 
 
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolSizeClass
+**
+**   Local Helper function to map a block size to an entry in the size class table.
+**
+**   The class is based on the position of the most significant bit of (Size - 1),
+**   combined with the next CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS bits below it.
+**   This executes in a fixed number of steps regardless of the value.
+**---------------------------------------------------------------------------------------
+*/
+uint16 CFE_ES_GenPoolSizeClass(size_t Size)
+{
+    size_t Value;
+    size_t Remainder;
+    uint16 Shift;
+    uint16 Log2;
+
+    if (Size > 0)
+    {
+        Value = Size - 1;
+    }
+    else
+    {
+        Value = 0;
+    }
+
+    if (Value < (1 << CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS))
+    {
+        /* small sizes map directly */
+        return Value;
+    }
+
+    /* Find the most significant bit using a binary reduction */
+    Remainder = Value;
+    Log2 = 0;
+    Shift = sizeof(size_t) * 4;
+    while (Shift > 0)
+    {
+        if ((Remainder >> Shift) != 0)
+        {
+            Remainder >>= Shift;
+            Log2 += Shift;
+        }
+        Shift >>= 1;
+    }
+
+    /*
+     * Class is the octave number, followed by the subdivision bits
+     * immediately below the MSB.
+     */
+    return ((Log2 - CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS + 1) << CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS) +
+            ((Value >> (Log2 - CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS)) &
+                    ((1 << CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS) - 1));
+}
+
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolSizeClassMinSize
+**
+**   Local Helper function to compute the smallest block size that maps to a given
+**   size class.  This is the inverse of CFE_ES_GenPoolSizeClass().
+**---------------------------------------------------------------------------------------
+*/
+size_t CFE_ES_GenPoolSizeClassMinSize(uint16 SizeClass)
+{
+    uint16 Log2;
+    size_t SubClass;
+
+    if (SizeClass < (1 << CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS))
+    {
+        return (size_t)SizeClass + 1;
+    }
+
+    Log2 = (SizeClass >> CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS) + CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS - 1;
+    SubClass = SizeClass & ((1 << CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS) - 1);
+
+    return (((size_t)1 << Log2) | (SubClass << (Log2 - CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS))) + 1;
+}
+
+
 /*
 **---------------------------------------------------------------------------------------
 **   Name: CFE_ES_GenPoolFindBucket
 **
 **   Local Helper function to find the appropriate bucket given a requested block size
+**
+**   The size class table yields the first bucket that is large enough for the
+**   smallest size in the class.  Only when more than one configured block size
+**   falls within the same class does this need to step forward, so the
+**   lookup is effectively constant time.
 **---------------------------------------------------------------------------------------
 */
 uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize)
 {
     uint16 Index;
 
-    for (Index=0; Index < PoolRecPtr->NumBuckets; ++Index)
+    Index = PoolRecPtr->SizeClassMap[CFE_ES_GenPoolSizeClass(ReqSize)];
+    while (Index < PoolRecPtr->NumBuckets && ReqSize > PoolRecPtr->Buckets[Index].BlockSize)
     {
-        if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
-        {
-            /* it fits - stop here */
-            break;
-        }
+        ++Index;
     }
 
     /*
@@ -102,6 +187,187 @@ CFE_ES_GenPoolBucket_t *CFE_ES_GenPoolGetBucketState(CFE_ES_GenPoolRecord_t *Poo
 }
 
 
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolProfileMax
+**
+**   Local helper function to raise a profile maximum to the given value
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_GenPoolProfileMax(uint32 *MaxPtr, uint32 Value)
+{
+    uint32 Current;
+
+    Current = CFE_ES_AtomicLoad32(MaxPtr);
+    while (Value > Current && !CFE_ES_AtomicCompareExchange32(MaxPtr, &Current, Value))
+    {
+        /* Current was updated by another task, check again */
+    }
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolProfileMaxSize
+**
+**   Local helper function to raise a profile maximum size to the given value
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_GenPoolProfileMaxSize(size_t *MaxPtr, size_t Value)
+{
+    size_t Current;
+
+    Current = CFE_ES_AtomicLoadSize(MaxPtr);
+    while (Value > Current && !CFE_ES_AtomicCompareExchangeSize(MaxPtr, &Current, Value))
+    {
+        /* Current was updated by another task, check again */
+    }
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolProfileGet
+**
+**   Local helper function to record a successful block request in the allocation profile
+**
+**   This may be called without holding a lock in lock-free mode, so all
+**   updates are done with atomic operations.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_GenPoolProfileGet(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t ReqSize)
+{
+#if (CFE_PLATFORM_ES_MEMPOOL_PROFILE == true)
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    uint32 InUse;
+    uint16 SizeClass;
+
+    SizeClass = CFE_ES_GenPoolSizeClass(ReqSize);
+    if (SizeClass >= CFE_ES_GENERIC_POOL_PROFILE_BINS)
+    {
+        SizeClass = CFE_ES_GENERIC_POOL_PROFILE_BINS - 1;
+    }
+
+    CFE_ES_AtomicAdd32(&PoolRecPtr->Profile.SizeCount[SizeClass], 1);
+    CFE_ES_GenPoolProfileMaxSize(&PoolRecPtr->Profile.SizeMax[SizeClass], ReqSize);
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    CFE_ES_AtomicAdd64(&BucketPtr->RequestedBytes, ReqSize);
+
+    InUse = CFE_ES_AtomicLoad32(&BucketPtr->AllocationCount) -
+            CFE_ES_AtomicLoad32(&BucketPtr->ReleaseCount) +
+            CFE_ES_AtomicLoad32(&BucketPtr->RecycleCount);
+    CFE_ES_GenPoolProfileMax(&BucketPtr->PeakInUse, InUse);
+#endif
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolProfilePut
+**
+**   Local helper function to record a returned block in the allocation profile
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_GenPoolProfilePut(CFE_ES_GenPoolBucket_t *BucketPtr, size_t ActualSize)
+{
+#if (CFE_PLATFORM_ES_MEMPOOL_PROFILE == true)
+    CFE_ES_AtomicAdd64(&BucketPtr->RequestedBytes, 0 - (uint64)ActualSize);
+#endif
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolProfileBlockSize
+**
+**   Local helper function to get the smallest aligned block size which would hold
+**   all of the recorded requests in the given size class
+**---------------------------------------------------------------------------------------
+*/
+size_t CFE_ES_GenPoolProfileBlockSize(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 SizeClass)
+{
+    return (PoolRecPtr->Profile.SizeMax[SizeClass] + PoolRecPtr->AlignMask) & ~PoolRecPtr->AlignMask;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolLockFreePop
+**
+**   Local helper function to take the top block off a free stack using atomic operations
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolLockFreePop(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_GenPoolBucket_t *BucketPtr,
+        size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    uint64 Top;
+    uint64 NewTop;
+    size_t BlockOffset;
+    int32 Status;
+
+    Top = CFE_ES_AtomicLoad64(&BucketPtr->LockFreeTop);
+    do
+    {
+        BlockOffset = (size_t)(Top & CFE_ES_GENERIC_POOL_LOCKFREE_OFFSET_MASK);
+        if (BlockOffset == 0)
+        {
+            /* no buffers in pool to recycle */
+            return CFE_ES_BUFFER_NOT_IN_POOL;
+        }
+
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+
+        /*
+         * If another task takes this same block between the load of the
+         * top and the exchange below, the next offset read here may be stale.
+         * The tag will also have changed in that case, so the exchange
+         * fails and this is repeated with the updated top.
+         */
+        NewTop = ((Top & ~CFE_ES_GENERIC_POOL_LOCKFREE_OFFSET_MASK) + CFE_ES_GENERIC_POOL_LOCKFREE_TAG_INCR) |
+                ((uint64)BdPtr->NextOffset & CFE_ES_GENERIC_POOL_LOCKFREE_OFFSET_MASK);
+    }
+    while (!CFE_ES_AtomicCompareExchange64(&BucketPtr->LockFreeTop, &Top, NewTop));
+
+    *BlockOffsetPtr = BlockOffset;
+
+    return CFE_SUCCESS;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolLockFreePush
+**
+**   Local helper function to put a block on top of a free stack using atomic operations
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolLockFreePush(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_GenPoolBucket_t *BucketPtr,
+        size_t BlockOffset, CFE_ES_GenPoolBD_t *BdPtr)
+{
+    uint64 Top;
+    uint64 NewTop;
+    int32 Status;
+
+    Top = CFE_ES_AtomicLoad64(&BucketPtr->LockFreeTop);
+    do
+    {
+        BdPtr->NextOffset = (size_t)(Top & CFE_ES_GENERIC_POOL_LOCKFREE_OFFSET_MASK);
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+
+        NewTop = ((Top & ~CFE_ES_GENERIC_POOL_LOCKFREE_OFFSET_MASK) + CFE_ES_GENERIC_POOL_LOCKFREE_TAG_INCR) |
+                (uint64)BlockOffset;
+    }
+    while (!CFE_ES_AtomicCompareExchange64(&BucketPtr->LockFreeTop, &Top, NewTop));
+
+    return CFE_SUCCESS;
+}
+
+
 /*
 **---------------------------------------------------------------------------------------
 **   Name: CFE_ES_GenPoolRecyclePoolBlock
@@ -121,15 +387,32 @@ int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16
     int32 Status;
 
     BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
-    if (BucketPtr == NULL ||
-            BucketPtr->RecycleCount == BucketPtr->ReleaseCount ||
+    if (BucketPtr == NULL)
+    {
+        /* no buffers in pool to recycle */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    if (PoolRecPtr->LockFree)
+    {
+        /* Block is taken off the stack first, then checked */
+        Status = CFE_ES_GenPoolLockFreePop(PoolRecPtr, BucketPtr, &BlockOffset);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+    }
+    else if (BucketPtr->RecycleCount == BucketPtr->ReleaseCount ||
             BucketPtr->FirstOffset == 0)
     {
         /* no buffers in pool to recycle */
         return CFE_ES_BUFFER_NOT_IN_POOL;
     }
+    else
+    {
+        BlockOffset = BucketPtr->FirstOffset;
+    }
 
-    BlockOffset = BucketPtr->FirstOffset;
     DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
     Status = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
     if (Status == CFE_SUCCESS)
@@ -140,6 +423,18 @@ int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16
         {
             /* sanity check failed - possible pool corruption? */
             Status = CFE_ES_BUFFER_NOT_IN_POOL;
+
+            if (PoolRecPtr->LockFree)
+            {
+                /*
+                 * The block is already off the stack and cannot be trusted
+                 * to go back on it, so it is taken out of use.  Make
+                 * sure this does not go unnoticed.
+                 */
+                CFE_ES_AtomicAdd32(&PoolRecPtr->ValidationErrorCount, 1);
+                CFE_ES_WriteToSysLog("CFE_ES:getPoolBlock err:free block at offset %lu is corrupt, dropped\n",
+                        (unsigned long)BlockOffset);
+            }
         }
         else
         {
@@ -156,8 +451,11 @@ int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16
             if (Status == CFE_SUCCESS)
             {
                 *BlockOffsetPtr = BlockOffset;
-                BucketPtr->FirstOffset = NextOffset;
-                ++BucketPtr->RecycleCount;
+                if (!PoolRecPtr->LockFree)
+                {
+                    BucketPtr->FirstOffset = NextOffset;
+                }
+                CFE_ES_AtomicAdd32(&BucketPtr->RecycleCount, 1);
             }
         }
     }
@@ -244,6 +542,374 @@ int32 CFE_ES_GenPoolCreatePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 B
 
 
 
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolBuddySpan
+**
+**   Local helper function to get the total span of a buddy block in the given bucket,
+**   including the descriptor.  This is always a power of two.
+**---------------------------------------------------------------------------------------
+*/
+size_t CFE_ES_GenPoolBuddySpan(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId)
+{
+    return PoolRecPtr->Buckets[PoolRecPtr->NumBuckets - BucketId].BlockSize + PoolRecPtr->BuddyDescSpace;
+}
+
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolBuddyPush
+**
+**   Local helper function to mark a buddy block as free and put it at the top of
+**   the free list for the given bucket.
+**
+**   Buddy free lists are doubly linked, so any block can be removed in constant time
+**   when it is merged with its buddy.  While a block is free, the ActualSize field of
+**   its descriptor holds the offset of the previous block in the list.
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolBuddyPush(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t BlockOffset)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *BdPtr;
+    size_t HeadOffset;
+    int32 Status;
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    HeadOffset = BucketPtr->FirstOffset;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->CheckBits    = CFE_ES_CHECK_PATTERN;
+        BdPtr->Allocated    = CFE_ES_MEMORY_DEALLOCATED + BucketId;
+        BdPtr->ActualSize   = 0;
+        BdPtr->NextOffset   = HeadOffset;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+    }
+
+    if (Status == CFE_SUCCESS && HeadOffset != 0)
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, HeadOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->ActualSize = BlockOffset;
+            Status = PoolRecPtr->Commit(PoolRecPtr, HeadOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        BucketPtr->FirstOffset = BlockOffset;
+        ++BucketPtr->ReleaseCount;
+    }
+
+    return Status;
+}
+
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolBuddyUnlink
+**
+**   Local helper function to remove a block from the free list of the given bucket,
+**   given the previous and next links that were stored in its descriptor.
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolBuddyUnlink(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId,
+        size_t PrevOffset, size_t NextOffset)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *BdPtr;
+    int32 Status;
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    Status = CFE_SUCCESS;
+
+    if (PrevOffset == 0)
+    {
+        BucketPtr->FirstOffset = NextOffset;
+    }
+    else
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, PrevOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->NextOffset = NextOffset;
+            Status = PoolRecPtr->Commit(PoolRecPtr, PrevOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS && NextOffset != 0)
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, NextOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->ActualSize = PrevOffset;
+            Status = PoolRecPtr->Commit(PoolRecPtr, NextOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        ++BucketPtr->RecycleCount;
+    }
+
+    return Status;
+}
+
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolBuddyGetBlock
+**
+**   Local helper function to get a block in buddy mode.  This takes the smallest free
+**   block that is large enough, or carves a new one from the end of the pool, and then
+**   splits it in half until it matches the requested bucket.
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolBuddyGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId,
+        size_t NewSize, size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *BdPtr;
+    size_t   BlockOffset;
+    size_t   NextOffset;
+    size_t   Span;
+    uint16   SrcBucketId;
+    int32    Status;
+
+    /*
+     * Look for a free block, starting at the requested bucket and moving
+     * to larger sizes.  Note that larger blocks have smaller bucket IDs.
+     */
+    BucketPtr = NULL;
+    SrcBucketId = BucketId;
+    while (SrcBucketId > 0)
+    {
+        BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, SrcBucketId);
+        if (BucketPtr->FirstOffset != 0)
+        {
+            break;
+        }
+        --SrcBucketId;
+    }
+
+    if (SrcBucketId > 0)
+    {
+        BlockOffset = BucketPtr->FirstOffset;
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN ||
+                BdPtr->Allocated != (CFE_ES_MEMORY_DEALLOCATED + SrcBucketId))
+        {
+            /* sanity check failed - possible pool corruption? */
+            ++PoolRecPtr->ValidationErrorCount;
+            return CFE_ES_POOL_BLOCK_INVALID;
+        }
+
+        NextOffset = BdPtr->NextOffset;
+        Status = CFE_ES_GenPoolBuddyUnlink(PoolRecPtr, SrcBucketId, 0, NextOffset);
+    }
+    else
+    {
+        /*
+         * Nothing free - carve the largest possible block from the end of the pool.
+         * Each new block must be aligned to its own span, relative to the base,
+         * so that its buddy address can be computed later.
+         */
+        SrcBucketId = 1;
+        while (SrcBucketId <= BucketId)
+        {
+            Span = CFE_ES_GenPoolBuddySpan(PoolRecPtr, SrcBucketId);
+            if (((PoolRecPtr->TailPosition - PoolRecPtr->BuddyBase) & (Span - 1)) == 0 &&
+                    (PoolRecPtr->TailPosition + Span) <= PoolRecPtr->PoolMaxOffset)
+            {
+                break;
+            }
+            ++SrcBucketId;
+        }
+
+        if (SrcBucketId > BucketId)
+        {
+            /* can't fit in remaining mem */
+            return CFE_ES_ERR_MEM_BLOCK_SIZE;
+        }
+
+        Status = CFE_ES_GenPoolCreatePoolBlock(PoolRecPtr, SrcBucketId, NewSize, &BlockOffset);
+    }
+
+    /*
+     * Split the block in half until it is the requested size.
+     * The upper half of each split goes onto the free list.
+     */
+    while (Status == CFE_SUCCESS && SrcBucketId < BucketId)
+    {
+        --CFE_ES_GenPoolGetBucketState(PoolRecPtr, SrcBucketId)->AllocationCount;
+        ++SrcBucketId;
+        CFE_ES_GenPoolGetBucketState(PoolRecPtr, SrcBucketId)->AllocationCount += 2;
+
+        Span = CFE_ES_GenPoolBuddySpan(PoolRecPtr, SrcBucketId);
+        Status = CFE_ES_GenPoolBuddyPush(PoolRecPtr, SrcBucketId, BlockOffset + Span);
+        ++PoolRecPtr->SplitCount;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->CheckBits    = CFE_ES_CHECK_PATTERN;
+        BdPtr->Allocated    = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+        BdPtr->ActualSize   = NewSize;
+        BdPtr->NextOffset   = 0;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        *BlockOffsetPtr = BlockOffset;
+    }
+
+    return Status;
+}
+
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolBuddyPutBlock
+**
+**   Local helper function to return a block in buddy mode.  The block is merged
+**   with its buddy for as long as the buddy is also free, and the result is put
+**   on the free list.
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolBuddyPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId,
+        size_t BlockOffset)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    size_t   SpanStart;
+    size_t   BuddyStart;
+    size_t   UpperOffset;
+    size_t   Span;
+    size_t   PrevOffset;
+    size_t   NextOffset;
+    int32    Status;
+
+    Status = CFE_SUCCESS;
+    SpanStart = BlockOffset - PoolRecPtr->BuddyDescSpace;
+
+    while (BucketId > 1)
+    {
+        Span = CFE_ES_GenPoolBuddySpan(PoolRecPtr, BucketId);
+        BuddyStart = PoolRecPtr->BuddyBase + ((SpanStart - PoolRecPtr->BuddyBase) ^ Span);
+        if ((BuddyStart + Span) > PoolRecPtr->TailPosition)
+        {
+            /* buddy has not been created */
+            break;
+        }
+
+        Status = PoolRecPtr->Retrieve(PoolRecPtr,
+                BuddyStart + PoolRecPtr->BuddyDescSpace - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            break;
+        }
+
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN ||
+                BdPtr->Allocated != (CFE_ES_MEMORY_DEALLOCATED + BucketId))
+        {
+            /* buddy is in use, or has been split */
+            break;
+        }
+
+        PrevOffset = BdPtr->ActualSize;
+        NextOffset = BdPtr->NextOffset;
+        Status = CFE_ES_GenPoolBuddyUnlink(PoolRecPtr, BucketId, PrevOffset, NextOffset);
+        if (Status != CFE_SUCCESS)
+        {
+            break;
+        }
+
+        /*
+         * The descriptor of the upper half is now inside the merged block,
+         * so clear it to avoid confusion with a real descriptor.
+         */
+        if (BuddyStart > SpanStart)
+        {
+            UpperOffset = BuddyStart + PoolRecPtr->BuddyDescSpace;
+        }
+        else
+        {
+            UpperOffset = SpanStart + PoolRecPtr->BuddyDescSpace;
+            SpanStart = BuddyStart;
+        }
+
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, UpperOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->CheckBits = 0;
+            BdPtr->Allocated = 0;
+            Status = PoolRecPtr->Commit(PoolRecPtr, UpperOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        }
+        if (Status != CFE_SUCCESS)
+        {
+            break;
+        }
+
+        CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId)->AllocationCount -= 2;
+        --BucketId;
+        ++CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId)->AllocationCount;
+        ++PoolRecPtr->MergeCount;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_GenPoolBuddyPush(PoolRecPtr, BucketId, SpanStart + PoolRecPtr->BuddyDescSpace);
+    }
+
+    return Status;
+}
+
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolCalcAlignMask
+**
+**   Local helper function to convert an alignment size to a bit mask.
+**   This sets all LSBs if the passed in value was not actually a power of 2.
+**---------------------------------------------------------------------------------------
+*/
+size_t CFE_ES_GenPoolCalcAlignMask(size_t AlignSize)
+{
+    size_t AlignMask;
+
+    if (AlignSize <= 1)
+    {
+        AlignMask = 0;
+    }
+    else
+    {
+        AlignMask = AlignSize - 1;
+        AlignMask |= AlignMask >> 1;
+        AlignMask |= AlignMask >> 2;
+        AlignMask |= AlignMask >> 4;
+        AlignMask |= AlignMask >> 8;
+        AlignMask |= AlignMask >> 16;
+    }
+
+    return AlignMask;
+}
+
+
 /*
 **---------------------------------------------------------------------------------------
 **   Name: CFE_ES_GenPoolInitialize
@@ -264,6 +930,7 @@ int32 CFE_ES_GenPoolInitialize(
     cpuaddr  AlignMask;
     uint32   i;
     uint32   j;
+    size_t   ClassMinSize;
     CFE_ES_GenPoolBucket_t *BucketPtr;
 
     /*
@@ -274,73 +941,196 @@ int32 CFE_ES_GenPoolInitialize(
     memset(PoolRecPtr, 0, sizeof(*PoolRecPtr));
 
     /*
-     * Convert alignment to a bit mask.
-     * This sets all LSBs if the passed in value was not actually a power of 2.
+     * Convert alignment to a bit mask.
+     */
+    AlignMask = CFE_ES_GenPoolCalcAlignMask(AlignSize);
+
+    /* complete initialization of pool record entry */
+    PoolRecPtr->AlignMask = AlignMask;
+    PoolRecPtr->PoolTotalSize = PoolSize;
+    PoolRecPtr->PoolMaxOffset = PoolSize + StartOffset;
+    PoolRecPtr->NumBuckets = NumBlockSizes;
+    PoolRecPtr->Retrieve = RetrieveFunc;
+    PoolRecPtr->Commit = CommitFunc;
+    PoolRecPtr->TailPosition = StartOffset;
+
+    /* initially copy all block sizes */
+    BucketPtr = PoolRecPtr->Buckets;
+    for (i=0; i < NumBlockSizes; ++i)
+    {
+        BucketPtr->BlockSize = BlockSizeList[i];
+        ++BucketPtr;
+    }
+
+    /* Sort by block size - a simple bubble sort -
+     * this does not run often and the list is relatively small. */
+    do
+    {
+        j = 0;
+        BucketPtr = PoolRecPtr->Buckets;
+        for (i=1; i < NumBlockSizes; ++i)
+        {
+            if (BucketPtr[0].BlockSize > BucketPtr[1].BlockSize)
+            {
+                /* swap */
+                BucketPtr[0].BlockSize ^= BucketPtr[1].BlockSize;
+                BucketPtr[1].BlockSize ^= BucketPtr[0].BlockSize;
+                BucketPtr[0].BlockSize ^= BucketPtr[1].BlockSize;
+                ++j;
+            }
+            ++BucketPtr;
+        }
+    }
+    while (j > 0);
+
+    /*
+     * Additional sanity check - after sorting the list,
+     * confirm that the smallest block size (first entry)
+     * is not zero.
+     */
+    if (PoolRecPtr->Buckets[0].BlockSize == 0)
+    {
+        return CFE_ES_ERR_MEM_BLOCK_SIZE;
+    }
+
+    /*
+     * Merge repeated block sizes into one bucket.  Only the first of
+     * several equal buckets could ever be used, and this allows a fixed
+     * length list (such as the platform configuration) to hold fewer
+     * distinct sizes.
+     */
+    j = 0;
+    for (i=1; i < NumBlockSizes; ++i)
+    {
+        if (PoolRecPtr->Buckets[i].BlockSize != PoolRecPtr->Buckets[j].BlockSize)
+        {
+            ++j;
+            PoolRecPtr->Buckets[j].BlockSize = PoolRecPtr->Buckets[i].BlockSize;
+        }
+    }
+    NumBlockSizes = j + 1;
+    PoolRecPtr->NumBuckets = NumBlockSizes;
+    while (++j < CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+    {
+        PoolRecPtr->Buckets[j].BlockSize = 0;
+    }
+
+    /*
+     * Build the size class lookup table.  Since the bucket list is sorted,
+     * the first fitting bucket index never decreases from one class to the next.
+     */
+    j = 0;
+    for (i=0; i < CFE_ES_GENERIC_POOL_SIZECLASS_COUNT; ++i)
+    {
+        ClassMinSize = CFE_ES_GenPoolSizeClassMinSize(i);
+        while (j < NumBlockSizes && ClassMinSize > PoolRecPtr->Buckets[j].BlockSize)
+        {
+            ++j;
+        }
+        PoolRecPtr->SizeClassMap[i] = j;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolInitializeBuddy
+**
+**   ES Internal API - See Prototype for full API description
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolInitializeBuddy(
+        CFE_ES_GenPoolRecord_t *PoolRecPtr,
+        size_t   StartOffset,
+        size_t   PoolSize,
+        size_t   AlignSize,
+        uint16               NumBlockSizes,
+        const size_t  *BlockSizeList,
+        CFE_ES_PoolRetrieve_Func_t RetrieveFunc,
+        CFE_ES_PoolCommit_Func_t   CommitFunc)
+{
+    size_t   SpanList[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+    size_t   AlignMask;
+    size_t   DescSpace;
+    size_t   MinBlockSize;
+    size_t   MaxBlockSize;
+    size_t   MinSpan;
+    size_t   MaxSpan;
+    uint16   NumSpans;
+    uint16   i;
+    int32    Status;
+
+    if (NumBlockSizes == 0)
+    {
+        return CFE_ES_ERR_MEM_BLOCK_SIZE;
+    }
+
+    MinBlockSize = BlockSizeList[0];
+    MaxBlockSize = BlockSizeList[0];
+    for (i=1; i < NumBlockSizes; ++i)
+    {
+        if (BlockSizeList[i] < MinBlockSize)
+        {
+            MinBlockSize = BlockSizeList[i];
+        }
+        if (BlockSizeList[i] > MaxBlockSize)
+        {
+            MaxBlockSize = BlockSizeList[i];
+        }
+    }
+
+    if (MinBlockSize == 0)
+    {
+        return CFE_ES_ERR_MEM_BLOCK_SIZE;
+    }
+
+    /*
+     * Every block begins with a descriptor, padded such that the user
+     * data that follows it is aligned.  The block spans are powers of two
+     * that are large enough to hold the descriptor plus the configured sizes.
      */
-    if (AlignSize <= 1)
+    AlignMask = CFE_ES_GenPoolCalcAlignMask(AlignSize);
+    DescSpace = (CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE + AlignMask) & ~AlignMask;
+
+    MinSpan = 1;
+    while (MinSpan < (MinBlockSize + DescSpace))
     {
-        AlignMask = 0;
+        MinSpan <<= 1;
     }
-    else
+
+    MaxSpan = MinSpan;
+    NumSpans = 1;
+    while (MaxSpan < (MaxBlockSize + DescSpace))
     {
-        AlignMask = AlignSize - 1;
-        AlignMask |= AlignMask >> 1;
-        AlignMask |= AlignMask >> 2;
-        AlignMask |= AlignMask >> 4;
-        AlignMask |= AlignMask >> 8;
-        AlignMask |= AlignMask >> 16;
+        MaxSpan <<= 1;
+        ++NumSpans;
     }
 
-    /* complete initialization of pool record entry */
-    PoolRecPtr->AlignMask = AlignMask;
-    PoolRecPtr->PoolTotalSize = PoolSize;
-    PoolRecPtr->PoolMaxOffset = PoolSize + StartOffset;
-    PoolRecPtr->NumBuckets = NumBlockSizes;
-    PoolRecPtr->Retrieve = RetrieveFunc;
-    PoolRecPtr->Commit = CommitFunc;
-    PoolRecPtr->TailPosition = StartOffset;
-
-    /* initially copy all block sizes */
-    BucketPtr = PoolRecPtr->Buckets;
-    for (i=0; i < NumBlockSizes; ++i)
+    /* If there are too many spans, raise the minimum so the maximum is still reached */
+    if (NumSpans > CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
     {
-        BucketPtr->BlockSize = BlockSizeList[i];
-        ++BucketPtr;
+        NumSpans = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+        MinSpan = MaxSpan >> (NumSpans - 1);
     }
 
-    /* Sort by block size - a simple bubble sort -
-     * this does not run often and the list is relatively small. */
-    do
+    for (i=0; i < NumSpans; ++i)
     {
-        j = 0;
-        BucketPtr = PoolRecPtr->Buckets;
-        for (i=1; i < NumBlockSizes; ++i)
-        {
-            if (BucketPtr[0].BlockSize > BucketPtr[1].BlockSize)
-            {
-                /* swap */
-                BucketPtr[0].BlockSize ^= BucketPtr[1].BlockSize;
-                BucketPtr[1].BlockSize ^= BucketPtr[0].BlockSize;
-                BucketPtr[0].BlockSize ^= BucketPtr[1].BlockSize;
-                ++j;
-            }
-            ++BucketPtr;
-        }
+        SpanList[i] = (MinSpan << i) - DescSpace;
     }
-    while (j > 0);
 
-    /*
-     * Additional sanity check - after sorting the list,
-     * confirm that the smallest block size (first entry)
-     * is not zero.
-     */
-    if (PoolRecPtr->Buckets[0].BlockSize == 0)
+    Status = CFE_ES_GenPoolInitialize(PoolRecPtr, StartOffset, PoolSize, AlignSize,
+            NumSpans, SpanList, RetrieveFunc, CommitFunc);
+
+    if (Status == CFE_SUCCESS)
     {
-        return CFE_ES_ERR_MEM_BLOCK_SIZE;
+        PoolRecPtr->BuddyMode = true;
+        PoolRecPtr->BuddyDescSpace = DescSpace;
+        PoolRecPtr->BuddyBase = (StartOffset + AlignMask) & ~AlignMask;
+        PoolRecPtr->TailPosition = PoolRecPtr->BuddyBase;
     }
 
-
-    return CFE_SUCCESS;
+    return Status;
 }
 
 /*
@@ -402,17 +1192,93 @@ int32 CFE_ES_GenPoolGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr,
         return(CFE_ES_ERR_MEM_BLOCK_SIZE);
     }
 
-    /* first attempt to recycle any buffers from the same bucket that were freed */
-    Status = CFE_ES_GenPoolRecyclePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
-    if (Status != CFE_SUCCESS)
+    if (PoolRecPtr->BuddyMode)
+    {
+        /* split a larger free block or carve a new one, as needed */
+        Status = CFE_ES_GenPoolBuddyGetBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+    }
+    else
+    {
+        /* first attempt to recycle any buffers from the same bucket that were freed */
+        Status = CFE_ES_GenPoolRecyclePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            /* recycling not available - try making a new one instead */
+            Status = CFE_ES_GenPoolCreatePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
     {
-        /* recycling not available - try making a new one instead */
-        Status = CFE_ES_GenPoolCreatePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+        CFE_ES_GenPoolProfileGet(PoolRecPtr, BucketId, ReqSize);
     }
 
     return(Status);
 }
 
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolEnableLockFree
+**
+**   ES Internal API - See Prototype for full API description
+**---------------------------------------------------------------------------------------
+*/
+bool CFE_ES_GenPoolEnableLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    uint16 i;
+
+    if (!CFE_ES_ATOMIC_AVAILABLE || !CFE_ES_ATOMIC_LOCKFREE_64 ||
+            PoolRecPtr->BuddyMode ||
+            PoolRecPtr->PoolMaxOffset > CFE_ES_GENERIC_POOL_LOCKFREE_OFFSET_MASK)
+    {
+        return false;
+    }
+
+    /* Move any existing free blocks (e.g. from a rebuild) to the lock-free stacks */
+    for (i=0; i < PoolRecPtr->NumBuckets; ++i)
+    {
+        BucketPtr = &PoolRecPtr->Buckets[i];
+        BucketPtr->LockFreeTop = BucketPtr->FirstOffset;
+        BucketPtr->FirstOffset = 0;
+    }
+
+    PoolRecPtr->LockFree = true;
+
+    return true;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolGetFreeBlock
+**
+**   ES Internal API - See Prototype for full API description
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_GenPoolGetFreeBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr,
+        size_t   *BlockOffsetPtr,
+        size_t    ReqSize )
+{
+    int32 Status;
+    uint16 BucketId;
+
+    /* Find the bucket which can accommodate the requested size. */
+    BucketId = CFE_ES_GenPoolFindBucket(PoolRecPtr, ReqSize);
+    if (BucketId == 0 || PoolRecPtr->BuddyMode)
+    {
+        /* no free block available, let the full get request handle it */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    Status = CFE_ES_GenPoolRecyclePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_GenPoolProfileGet(PoolRecPtr, BucketId, ReqSize);
+    }
+
+    return Status;
+}
+
 /*
 **---------------------------------------------------------------------------------------
 **   Name: CFE_ES_GenPoolGetBlockSize
@@ -477,6 +1343,7 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr,
     CFE_ES_GenPoolBucket_t *BucketPtr;
     CFE_ES_GenPoolBD_t *BdPtr;
     int32 Status;
+    uint16 ExpectedState;
     uint16 BucketId;
 
     if (BlockOffset >= PoolRecPtr->TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
@@ -496,12 +1363,52 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr,
         if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN ||
                 BucketPtr == NULL ||
                 BdPtr->ActualSize == 0 ||
-                BucketPtr->BlockSize < BdPtr->ActualSize)
+                BucketPtr->BlockSize < BdPtr->ActualSize ||
+                (PoolRecPtr->BuddyMode &&
+                        ((BlockOffset - PoolRecPtr->BuddyDescSpace - PoolRecPtr->BuddyBase) &
+                                (CFE_ES_GenPoolBuddySpan(PoolRecPtr, BucketId) - 1)) != 0))
         {
             /* This does not appear to be a valid data buffer */
-            ++PoolRecPtr->ValidationErrorCount;
+            CFE_ES_AtomicAdd32(&PoolRecPtr->ValidationErrorCount, 1);
             Status = CFE_ES_POOL_BLOCK_INVALID;
         }
+        else if (PoolRecPtr->BuddyMode)
+        {
+            *BlockSizePtr = BdPtr->ActualSize;
+            Status = CFE_ES_GenPoolBuddyPutBlock(PoolRecPtr, BucketId, BlockOffset);
+        }
+        else if (PoolRecPtr->LockFree)
+        {
+            /*
+             * Claim the block by atomically marking it free.  If the same
+             * block is put twice at once, only one of the puts can succeed
+             * here, so the block never goes on the stack twice.
+             */
+            ExpectedState = CFE_ES_MEMORY_ALLOCATED + BucketId;
+            if (!CFE_ES_AtomicCompareExchange16(&BdPtr->Allocated, &ExpectedState,
+                    CFE_ES_MEMORY_DEALLOCATED + BucketId))
+            {
+                CFE_ES_AtomicAdd32(&PoolRecPtr->ValidationErrorCount, 1);
+                Status = CFE_ES_POOL_BLOCK_INVALID;
+            }
+            else
+            {
+                *BlockSizePtr = BdPtr->ActualSize;
+
+                /*
+                 * Count the release before the block becomes visible on the
+                 * stack, so a concurrent recycle never makes the free count negative.
+                 */
+                CFE_ES_AtomicAdd32(&BucketPtr->ReleaseCount, 1);
+                Status = CFE_ES_GenPoolLockFreePush(PoolRecPtr, BucketPtr, BlockOffset, BdPtr);
+                if (Status != CFE_SUCCESS)
+                {
+                    /* The block was not freed, so the caller still owns it */
+                    CFE_ES_AtomicAdd32(&BucketPtr->ReleaseCount, (uint32)-1);
+                    CFE_ES_AtomicStore16(&BdPtr->Allocated, CFE_ES_MEMORY_ALLOCATED + BucketId);
+                }
+            }
+        }
         else
         {
             BdPtr->Allocated = CFE_ES_MEMORY_DEALLOCATED + BucketId;
@@ -515,6 +1422,11 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr,
                 ++BucketPtr->ReleaseCount;
             }
         }
+
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_ES_GenPoolProfilePut(BucketPtr, *BlockSizePtr);
+        }
     }
 
     return Status;
@@ -598,9 +1510,11 @@ int32 CFE_ES_GenPoolRebuild(CFE_ES_GenPoolRecord_t *PoolRecPtr)
         /*
          * Sanity check that the actual size is less than the bucket size -
          * it always should be, as long as the pool was created with the same
-         * set of bucket sizes.
+         * set of bucket sizes.  (In buddy mode, free blocks use this field
+         * for a list link instead, so it is not checked).
          */
-        if (BucketPtr == NULL || BucketPtr->BlockSize < BdPtr->ActualSize)
+        if (BucketPtr == NULL ||
+                (!(PoolRecPtr->BuddyMode && IsDeallocatedBlock) && BucketPtr->BlockSize < BdPtr->ActualSize))
         {
             /* Not a valid block signature - stop recovery now */
             break;
@@ -612,11 +1526,25 @@ int32 CFE_ES_GenPoolRebuild(CFE_ES_GenPoolRecord_t *PoolRecPtr)
         ++BucketPtr->AllocationCount;
         ++PoolRecPtr->AllocationCount;
 
+        if (!IsDeallocatedBlock)
+        {
+            BucketPtr->RequestedBytes += BdPtr->ActualSize;
+            ++BucketPtr->PeakInUse;
+        }
+
         /*
          * If it was a deallocated block, then add it to the local
          * pool linked list structure and rewrite the descriptor.
          */
-        if (IsDeallocatedBlock)
+        if (IsDeallocatedBlock && PoolRecPtr->BuddyMode)
+        {
+            Status = CFE_ES_GenPoolBuddyPush(PoolRecPtr, BucketId, BlockOffset);
+            if (Status != CFE_SUCCESS)
+            {
+                break;
+            }
+        }
+        else if (IsDeallocatedBlock)
         {
             ++BucketPtr->ReleaseCount;
             BdPtr->NextOffset = BucketPtr->FirstOffset;
@@ -723,3 +1651,235 @@ void CFE_ES_GenPoolGetBucketUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 Buc
     }
 }
 
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolGetBucketProfile
+**
+**   ES Internal API - See Prototype for full API description
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_GenPoolGetBucketProfile(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId,
+        uint32 *PeakInUseBuf,
+        uint64 *RequestedBytesBuf)
+{
+    const CFE_ES_GenPoolBucket_t *BucketPtr;
+    static const CFE_ES_GenPoolBucket_t ZeroBucket = { 0 };
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr == NULL)
+    {
+        /* bucket ID is not valid */
+        BucketPtr = &ZeroBucket;
+    }
+
+    if (PeakInUseBuf != NULL)
+    {
+        *PeakInUseBuf = BucketPtr->PeakInUse;
+    }
+    if (RequestedBytesBuf != NULL)
+    {
+        *RequestedBytesBuf = BucketPtr->RequestedBytes;
+    }
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolGetSizeProfile
+**
+**   ES Internal API - See Prototype for full API description
+**---------------------------------------------------------------------------------------
+*/
+bool CFE_ES_GenPoolGetSizeProfile(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 SizeClass,
+        size_t *MinSizeBuf,
+        size_t *MaxSizeBuf,
+        uint32 *CountBuf)
+{
+    if (SizeClass >= CFE_ES_GENERIC_POOL_PROFILE_BINS)
+    {
+        return false;
+    }
+
+    if (MinSizeBuf != NULL)
+    {
+        *MinSizeBuf = CFE_ES_GenPoolSizeClassMinSize(SizeClass);
+    }
+    if (MaxSizeBuf != NULL)
+    {
+        *MaxSizeBuf = PoolRecPtr->Profile.SizeMax[SizeClass];
+    }
+    if (CountBuf != NULL)
+    {
+        *CountBuf = PoolRecPtr->Profile.SizeCount[SizeClass];
+    }
+
+    return true;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolCalcProfileCost
+**
+**   ES Internal API - See Prototype for full API description
+**
+**   All requests in a size class are assumed to be as large as the largest one,
+**   so this is an upper bound.
+**---------------------------------------------------------------------------------------
+*/
+uint64 CFE_ES_GenPoolCalcProfileCost(CFE_ES_GenPoolRecord_t *PoolRecPtr,
+        uint16 NumBlockSizes,
+        const size_t *BlockSizeList)
+{
+    uint64 Cost;
+    uint16 SizeClass;
+    uint16 Idx;
+
+    Cost = 0;
+    Idx = 0;
+    for (SizeClass = 0; SizeClass < CFE_ES_GENERIC_POOL_PROFILE_BINS; ++SizeClass)
+    {
+        if (PoolRecPtr->Profile.SizeCount[SizeClass] == 0)
+        {
+            continue;
+        }
+
+        /* size classes are in ascending order, so the list only needs one pass */
+        while (Idx < NumBlockSizes && BlockSizeList[Idx] < PoolRecPtr->Profile.SizeMax[SizeClass])
+        {
+            ++Idx;
+        }
+
+        if (Idx >= NumBlockSizes)
+        {
+            break;
+        }
+
+        Cost += (uint64)BlockSizeList[Idx] * PoolRecPtr->Profile.SizeCount[SizeClass];
+    }
+
+    return Cost;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_GenPoolSuggestBlockSizes
+**
+**   ES Internal API - See Prototype for full API description
+**
+**   Candidate block sizes are the (aligned) largest request in each size class
+**   that was used.  The best list is found with a dynamic programming pass
+**   over those classes: for each number of sizes, the lowest cost to serve
+**   the first N classes is stored, along with the first class that is served
+**   by the largest block size in that solution, so the list can be traced back.
+**---------------------------------------------------------------------------------------
+*/
+uint16 CFE_ES_GenPoolSuggestBlockSizes(CFE_ES_GenPoolRecord_t *PoolRecPtr,
+        uint16 MaxBlockSizes,
+        size_t *BlockSizeList)
+{
+    uint64  Cost[CFE_ES_GENERIC_POOL_PROFILE_BINS + 1];
+    uint64  TotalCount[CFE_ES_GENERIC_POOL_PROFILE_BINS + 1];
+    uint8   FirstClass[CFE_PLATFORM_ES_POOL_MAX_BUCKETS][CFE_ES_GENERIC_POOL_PROFILE_BINS + 1];
+    uint8   UsedClass[CFE_ES_GENERIC_POOL_PROFILE_BINS];
+    uint64  TestCost;
+    size_t  BlockSize;
+    size_t  LargestSize;
+    uint16  NumUsed;
+    uint16  NumSizes;
+    uint16  NumOutput;
+    uint16  SizeClass;
+    uint16  Start;
+    uint16  End;
+    uint16  i;
+
+    if (MaxBlockSizes > CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+    {
+        MaxBlockSizes = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    }
+
+    /* Collect the size classes that were actually requested */
+    NumUsed = 0;
+    TotalCount[0] = 0;
+    for (SizeClass = 0; SizeClass < CFE_ES_GENERIC_POOL_PROFILE_BINS; ++SizeClass)
+    {
+        if (PoolRecPtr->Profile.SizeCount[SizeClass] != 0)
+        {
+            UsedClass[NumUsed] = SizeClass;
+            TotalCount[NumUsed + 1] = TotalCount[NumUsed] + PoolRecPtr->Profile.SizeCount[SizeClass];
+            ++NumUsed;
+        }
+    }
+
+    if (NumUsed == 0 || MaxBlockSizes == 0 || PoolRecPtr->NumBuckets == 0)
+    {
+        /* nothing to base a suggestion on */
+        return 0;
+    }
+
+    /*
+     * Keep the current largest size as the last entry, unless the largest
+     * request already needs a block at least that large.
+     */
+    LargestSize = PoolRecPtr->Buckets[PoolRecPtr->NumBuckets - 1].BlockSize;
+    NumSizes = MaxBlockSizes;
+    if (CFE_ES_GenPoolProfileBlockSize(PoolRecPtr, UsedClass[NumUsed - 1]) < LargestSize)
+    {
+        --NumSizes;
+    }
+
+    /*
+     * Each pass adds one more block size.  Cost[End] holds the lowest cost
+     * to serve the first End used classes with the sizes so far.  Updating
+     * from the end backwards means Cost[Start] for Start < End still holds
+     * the value from the previous pass when it is referenced.
+     */
+    Cost[0] = 0;
+    for (i = 0; i < NumSizes; ++i)
+    {
+        for (End = NumUsed; End > 0; --End)
+        {
+            BlockSize = CFE_ES_GenPoolProfileBlockSize(PoolRecPtr, UsedClass[End - 1]);
+
+            /* Option 1: this block size serves all classes up to End */
+            Cost[End] = TotalCount[End] * BlockSize;
+            FirstClass[i][End] = 0;
+
+            /* Option 2: a smaller block size serves the classes before Start */
+            for (Start = 1; i > 0 && Start < End; ++Start)
+            {
+                TestCost = Cost[Start] + ((TotalCount[End] - TotalCount[Start]) * BlockSize);
+                if (TestCost < Cost[End])
+                {
+                    Cost[End] = TestCost;
+                    FirstClass[i][End] = Start;
+                }
+            }
+        }
+    }
+
+    /* Trace the solution back from the largest size, output in ascending order */
+    NumOutput = 0;
+    End = NumUsed;
+    i = NumSizes;
+    while (End > 0 && i > 0)
+    {
+        --i;
+        BlockSizeList[i] = CFE_ES_GenPoolProfileBlockSize(PoolRecPtr, UsedClass[End - 1]);
+        End = FirstClass[i][End];
+        ++NumOutput;
+    }
+
+    /* The solution may use fewer sizes than allowed, if so shift it down */
+    if (i > 0)
+    {
+        memmove(BlockSizeList, &BlockSizeList[i], NumOutput * sizeof(BlockSizeList[0]));
+    }
+
+    if (NumSizes < MaxBlockSizes)
+    {
+        BlockSizeList[NumOutput] = LargestSize;
+        ++NumOutput;
+    }
+
+    return NumOutput;
+}
@@ -54,6 +54,42 @@
 
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE sizeof(CFE_ES_GenPoolBD_t)  /* amount of space to reserve with every allocation */
 
+/*
+ * Size class lookup table geometry
+ *
+ * Requested sizes are mapped to a size class using the position of the
+ * most significant bit (log2) plus the next few bits below it, so each
+ * power-of-two range is subdivided into (1 << SUBDIV_BITS) classes.
+ * The table is built once at pool initialization, and contains the index
+ * of the first bucket that can hold the smallest size in each class.
+ */
+#define CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS   2
+#define CFE_ES_GENERIC_POOL_SIZECLASS_COUNT         \
+    (((sizeof(size_t) * 8) - CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS + 1) << CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS)
+
+/*
+ * Lock-free free stack top encoding
+ *
+ * The block offset is kept in the lower 32 bits and a modification
+ * tag in the upper 32 bits, so both can be swapped with a single 64 bit
+ * compare-exchange.  The tag changes on every update, which prevents a
+ * stale pop from succeeding if the same block was popped and pushed
+ * back in the meantime (the "ABA" problem).
+ */
+#define CFE_ES_GENERIC_POOL_LOCKFREE_OFFSET_MASK    ((uint64)0xFFFFFFFF)
+#define CFE_ES_GENERIC_POOL_LOCKFREE_TAG_INCR       ((uint64)1 << 32)
+
+/*
+ * Allocation profile histogram geometry
+ *
+ * Requested sizes are counted using the same size classes as the lookup
+ * table, for sizes up to 2^CFE_ES_GENERIC_POOL_PROFILE_SIZE_BITS bytes.
+ * Any larger requests are counted in the last class.
+ */
+#define CFE_ES_GENERIC_POOL_PROFILE_SIZE_BITS       24
+#define CFE_ES_GENERIC_POOL_PROFILE_BINS            \
+    ((CFE_ES_GENERIC_POOL_PROFILE_SIZE_BITS - CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS + 1) << CFE_ES_GENERIC_POOL_SIZECLASS_SUBDIV_BITS)
+
 /*
 ** Type Definitions
 */
@@ -62,7 +98,7 @@ typedef struct CFE_ES_GenPoolBD
 {
   uint16    CheckBits;              /**< Set to a fixed bit pattern after init */
   uint16    Allocated;              /**< Set to a bit pattern depending on allocation state */
-  size_t    ActualSize;             /**< The actual requested size of the block */
+  size_t    ActualSize;             /**< The actual requested size of the block (in buddy mode, the offset of the previous free block while on a free list) */
   size_t    NextOffset;             /**< The offset of the next descriptor in the free stack */
 } CFE_ES_GenPoolBD_t;
 
@@ -71,11 +107,27 @@ typedef struct CFE_ES_GenPoolBucket
 {
     size_t  BlockSize;
     size_t  FirstOffset;            /**< Top of the "free stack" of buffers which have been returned */
+    uint64  LockFreeTop;            /**< Top of the "free stack" in lock-free mode, offset and tag (replaces FirstOffset) */
     uint32  AllocationCount;        /**< Total number of buffers of this block size that exist (initial get) */
     uint32  ReleaseCount;           /**< Total number of buffers that have been released (put back) */
     uint32  RecycleCount;           /**< Total number of buffers that have been recycled (get after put) */
+    uint32  PeakInUse;              /**< Highest number of buffers of this block size that were in use at the same time */
+    uint64  RequestedBytes;         /**< Sum of the requested sizes of the buffers currently in use */
 } CFE_ES_GenPoolBucket_t;
 
+/**
+ * \brief Allocation profile
+ *
+ * Distribution of requested sizes, indexed by size class.  This is
+ * used to assess how well the configured block sizes match the actual
+ * requests made to the pool.
+ */
+typedef struct CFE_ES_GenPoolProfile
+{
+    uint32  SizeCount[CFE_ES_GENERIC_POOL_PROFILE_BINS];    /**< Number of successful requests in each size class */
+    size_t  SizeMax[CFE_ES_GENERIC_POOL_PROFILE_BINS];      /**< Largest request in each size class */
+} CFE_ES_GenPoolProfile_t;
+
 /*
  * Forward struct typedef so it can be used in retrieve/commit prototype
  */
@@ -119,8 +171,20 @@ struct CFE_ES_GenPoolRecord
     uint32  AllocationCount;        /**< Total number of block allocations of any size */
     uint32  ValidationErrorCount;   /**< Count of validation errors */
 
+    bool    BuddyMode;              /**< Set if free blocks are split and merged using the buddy scheme */
+    size_t  BuddyBase;              /**< Reference offset for buddy address calculations */
+    size_t  BuddyDescSpace;         /**< Aligned space reserved for the descriptor at the start of each buddy block */
+    uint32  SplitCount;             /**< Total number of buddy block splits */
+    uint32  MergeCount;             /**< Total number of buddy block merges */
+
+    bool    LockFree;               /**< Set if the free stacks are updated with atomic operations rather than under a lock */
+
     uint16                 NumBuckets;   /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    uint16  SizeClassMap[CFE_ES_GENERIC_POOL_SIZECLASS_COUNT]; /**< First bucket index for each size class */
+
+    CFE_ES_GenPoolProfile_t Profile;    /**< Requested size distribution */
 };
 
 /*****************************************************************************/
@@ -132,7 +196,8 @@ struct CFE_ES_GenPoolRecord
  * \brief Initialize a generic pool structure
  *
  * Resets the pool to its initial state, given the size
- * and alignment specifications.
+ * and alignment specifications.  Repeated sizes in the
+ * BlockSizeList are merged into a single bucket.
  *
  * \param[out]  PoolRecPtr    Pointer to pool structure
  * \param[in]   StartOffset   Initial starting location of pool
@@ -154,6 +219,83 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr,
         CFE_ES_PoolRetrieve_Func_t  RetrieveFunc,
         CFE_ES_PoolCommit_Func_t    CommitFunc);
 
+/**
+ * \brief Initialize a generic pool structure in buddy mode
+ *
+ * Resets the pool to its initial state, like CFE_ES_GenPoolInitialize(),
+ * but configures the pool to split larger free blocks to satisfy smaller
+ * requests, and to merge adjacent free blocks when they are returned.
+ * This avoids permanently dedicating pool memory to a single block size.
+ *
+ * In this mode every block, including its descriptor, occupies a power
+ * of two span.  The smallest and largest entries in BlockSizeList determine
+ * the range of spans, and the remaining entries are not used.  Up to
+ * CFE_PLATFORM_ES_POOL_MAX_BUCKETS distinct spans are supported, and the
+ * number of split or merge steps in any single get or put operation is
+ * limited to the number of spans, so the latency remains bounded.
+ *
+ * \param[out]  PoolRecPtr    Pointer to pool structure
+ * \param[in]   StartOffset   Initial starting location of pool
+ * \param[in]   PoolSize      Size of pool (beyond start offset)
+ * \param[in]   AlignSize     Required Alignment of blocks
+ * \param[in]   NumBlockSizes Number of entries in the BlockSizeList
+ * \param[in]   BlockSizeList Size of pool blocks
+ * \param[in]   RetrieveFunc  Function to retrieve buffer descriptors
+ * \param[in]   CommitFunc    Function to commit buffer descriptors
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolInitializeBuddy(CFE_ES_GenPoolRecord_t *PoolRecPtr,
+        size_t                      StartOffset,
+        size_t                      PoolSize,
+        size_t                      AlignSize,
+        uint16                      NumBlockSizes,
+        const size_t               *BlockSizeList,
+        CFE_ES_PoolRetrieve_Func_t  RetrieveFunc,
+        CFE_ES_PoolCommit_Func_t    CommitFunc);
+
+/**
+ * \brief Enable lock-free operation of the pool free stacks
+ *
+ * After this call, returning a block with CFE_ES_GenPoolPutBlock() and
+ * recycling a block with CFE_ES_GenPoolGetFreeBlock() may be done
+ * concurrently from multiple tasks without any lock.  Creating a new
+ * block from the unused area of the pool still updates shared state,
+ * so calls to CFE_ES_GenPoolGetBlock() must remain serialized by the caller.
+ *
+ * This requires that the descriptors are directly accessible in memory,
+ * such that the retrieve function outputs a pointer into the pool storage
+ * and the commit function does not need to write anything back.  It is
+ * also not supported in buddy mode, for pools larger than 4GB, or on
+ * CPUs without lock-free 64 bit atomic operations.  In these cases the
+ * pool is not changed, and the caller must continue to serialize all access.
+ *
+ * This should be called immediately after the pool is initialized,
+ * before any blocks are allocated.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ *
+ * \return true if lock-free operation was enabled, false otherwise
+ */
+bool CFE_ES_GenPoolEnableLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr);
+
+/**
+ * \brief Gets a previously returned block from the pool
+ *
+ * Similar to CFE_ES_GenPoolGetBlock(), but only attempts to recycle a block
+ * from the free stack.  It never creates a new block.  If the pool is in
+ * lock-free mode this does not need to be serialized with other operations.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[out]   BlockOffsetPtr  Location to output new block offset
+ * \param[in]    ReqSize        Size of block requested
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolGetFreeBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr,
+        size_t         *BlockOffsetPtr,
+        size_t          ReqSize);
+
 /**
  * \brief Gets a block from the pool
  *
@@ -280,6 +422,83 @@ void CFE_ES_GenPoolGetCounts(CFE_ES_GenPoolRecord_t *PoolRecPtr,
 void CFE_ES_GenPoolGetBucketUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId,
         CFE_ES_BlockStats_t *BlockStatsBuf);
 
+/**
+ * \brief Get allocation profile of a pool bucket
+ *
+ * Outputs the highest number of blocks of this size that were
+ * in use at the same time, and the total of the sizes requested
+ * for the blocks that are currently in use.
+ *
+ * \param[in]  PoolRecPtr         Pointer to pool structure
+ * \param[in]  BucketId           Bucket number (non-zero)
+ * \param[out] PeakInUseBuf       Buffer to store peak number of blocks in use
+ * \param[out] RequestedBytesBuf  Buffer to store sum of requested sizes
+ */
+void CFE_ES_GenPoolGetBucketProfile(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId,
+        uint32 *PeakInUseBuf,
+        uint64 *RequestedBytesBuf);
+
+/**
+ * \brief Get the allocation profile of a size class
+ *
+ * Outputs the range of sizes that map to the given size class,
+ * along with the number of requests and the largest request
+ * seen within that range.
+ *
+ * \param[in]  PoolRecPtr     Pointer to pool structure
+ * \param[in]  SizeClass      Size class number (zero based)
+ * \param[out] MinSizeBuf     Buffer to store the smallest size in the class
+ * \param[out] MaxSizeBuf     Buffer to store the largest requested size in the class
+ * \param[out] CountBuf       Buffer to store the number of requests in the class
+ *
+ * \return true if the size class is valid, false if beyond the last class
+ */
+bool CFE_ES_GenPoolGetSizeProfile(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 SizeClass,
+        size_t *MinSizeBuf,
+        size_t *MaxSizeBuf,
+        uint32 *CountBuf);
+
+/**
+ * \brief Calculate the cost of a block size list for the recorded profile
+ *
+ * Sums the block size which would be used for each recorded request, had
+ * the pool been configured with the given size list.  Dividing this by the
+ * total number of requests gives the average block size used per request,
+ * and comparing it between lists indicates which wastes less memory.
+ * Requests which do not fit in any of the sizes are not counted.
+ *
+ * \param[in]  PoolRecPtr     Pointer to pool structure
+ * \param[in]  NumBlockSizes  Number of entries in BlockSizeList
+ * \param[in]  BlockSizeList  Size of pool blocks, in ascending order
+ *
+ * \return Total of the block sizes for all recorded requests
+ */
+uint64 CFE_ES_GenPoolCalcProfileCost(CFE_ES_GenPoolRecord_t *PoolRecPtr,
+        uint16 NumBlockSizes,
+        const size_t *BlockSizeList);
+
+/**
+ * \brief Suggest a block size list based on the recorded profile
+ *
+ * Determines the list of up to MaxBlockSizes block sizes that minimizes the
+ * total block size used for the requests recorded so far, as computed by
+ * CFE_ES_GenPoolCalcProfileCost().  The largest entry is always at least the
+ * largest block size currently configured, so requests that succeed with
+ * the current configuration would also succeed with the suggested one.
+ *
+ * Sizes are rounded up to the pool alignment.  If fewer distinct sizes are
+ * useful, fewer than MaxBlockSizes entries are output.
+ *
+ * \param[in]  PoolRecPtr     Pointer to pool structure
+ * \param[in]  MaxBlockSizes  Maximum number of entries to output
+ * \param[out] BlockSizeList  Buffer to store suggested sizes, in ascending order
+ *
+ * \return Number of entries stored in BlockSizeList
+ */
+uint16 CFE_ES_GenPoolSuggestBlockSizes(CFE_ES_GenPoolRecord_t *PoolRecPtr,
+        uint16 MaxBlockSizes,
+        size_t *BlockSizeList);
+
 /**
  * \brief Calculate the pool size required for the specified number of blocks
  *
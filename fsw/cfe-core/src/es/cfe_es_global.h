@@ -66,20 +66,90 @@
 typedef struct
 {
    CFE_ES_CounterId_t CounterId;   /**< The actual counter ID of this entry, or undefined */
-   uint32         Counter;
-   char           CounterName[OS_MAX_API_NAME];   /* Counter Name */
+   CFE_ES_AppId_t OwnerAppId;      /**< The app the counter is registered to, or undefined if not app-specific */
+   uint32         Counter;         /**< Updated atomically, or under the ES lock if atomics are not available */
+   char           CounterName[CFE_MISSION_ES_GEN_COUNTER_MAX_FULL_NAME_LEN];   /* Counter Name */
 } CFE_ES_GenCounterRecord_t;
 
+/*
+ * Number of background jobs which ES defines for itself (CFE_ES_BACKGROUND_JOB_TABLE)
+ */
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true)
+#define CFE_ES_BACKGROUND_NUM_FIXED_JOBS    7
+#else
+#define CFE_ES_BACKGROUND_NUM_FIXED_JOBS    6
+#endif
+
+/*
+ * Total number of background job slots, fixed jobs first, then submitted jobs
+ */
+#define CFE_ES_BACKGROUND_MAX_JOBS          (CFE_ES_BACKGROUND_NUM_FIXED_JOBS + CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS)
+
+/*
+ * The run state of a single background job
+ */
+typedef struct
+{
+    CFE_ES_BackgroundJobFunc_t RunFunc; /**< Job function, or NULL if the slot is free */
+    void *JobArg;               /**< Argument to the job function */
+    CFE_ES_AppId_t OwnerAppId;  /**< App which submitted the job, undefined for fixed jobs */
+    uint32 ActivePeriod;        /**< max wait/delay time between calls when job is active */
+    uint32 IdlePeriod;          /**< max wait/delay time between calls when job is idle */
+    uint32 Deadline;            /**< max time the job may wait once it is due, 0 if none */
+    uint16 Priority;            /**< Lower values are run first */
+    uint8 Group;                /**< Jobs in the same non-zero group are never run at the same time */
+    bool IsSubmitted;           /**< Job is removed once it is idle */
+    bool IsActive;              /**< Result of the last call */
+    bool IsRunning;             /**< Job is currently being run by a worker */
+    bool IsCancelled;           /**< Job of a deleted app, removed when the running call returns */
+    uint32 WakeupCount;         /**< Value of the global wakeup count when the job was last run */
+    OS_time_t LastRunTime;      /**< Time at which the job was last run */
+} CFE_ES_BackgroundJobState_t;
+
 /*
  * Encapsulates the state of the ES background task
  */
 typedef struct
 {
-    CFE_ES_TaskId_t TaskID;     /**< ES ID of the background task */
+    CFE_ES_TaskId_t TaskID[CFE_PLATFORM_ES_BACKGROUND_WORKERS];  /**< ES IDs of the background worker tasks */
     osal_id_t WorkSem;          /**< Semaphore that is given whenever background work is pending */
+    osal_id_t JobMutex;         /**< Mutex protecting the job states */
     uint32 NumJobsRunning;      /**< Current Number of active jobs (updated by background task) */
+    uint32 WakeupCount;         /**< Incremented by each wakeup, so all jobs are polled */
+    uint32 MissedDeadlines;     /**< Number of times a job was run after its deadline */
+    uint32 RunningGroups;       /**< Bit mask of the job groups which have a job running */
+    CFE_ES_BackgroundJobState_t Jobs[CFE_ES_BACKGROUND_MAX_JOBS];
 } CFE_ES_BackgroundTaskState_t;
 
+/*
+ * An app from the startup script whose module is being loaded by the load workers
+ */
+typedef struct
+{
+    CFE_ResourceId_t PendingAppId;  /**< The reserved app table entry */
+    int32 LoadStatus;               /**< Result of CFE_ES_LoadModule(), valid once the job is counted in NumDone */
+} CFE_ES_StartupLoadJob_t;
+
+/*
+ * State shared by the tasks loading app modules while the startup script is processed
+ *
+ * Jobs are only added by the ES startup task.  Each task takes the next job
+ * to load from NextJob, so no two tasks load the same module.
+ */
+typedef struct
+{
+    bool      IsActive;         /**< Whether apps in the startup script are being queued */
+    uint32    IsShutdown;       /**< Set when the workers should exit, updated atomically */
+    uint32    NumWorkers;       /**< Number of worker tasks started */
+    uint32    NumJobs;          /**< Number of jobs queued, updated atomically */
+    uint32    NextJob;          /**< Index of the next job to load, updated atomically */
+    uint32    NumDone;          /**< Number of jobs which have finished loading, updated atomically */
+    osal_id_t WorkSem;          /**< Counting semaphore given for each queued job */
+    osal_id_t DoneSem;          /**< Binary semaphore given whenever a job finishes */
+    osal_id_t ExitSem;          /**< Counting semaphore given by each worker task when it exits */
+    CFE_ES_StartupLoadJob_t Jobs[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+} CFE_ES_StartupLoadState_t;
+
 
 /*
 ** Executive Services Global Memory Data
@@ -102,11 +172,22 @@ typedef struct
    ** Performance Data Mutex
    */
    osal_id_t PerfDataMutex;
+   uint32    PerfActiveWriters;   /**< Lock-free perf log writers adding an entry */
+
+   /*
+   ** Performance Marker Registry
+   */
+   CFE_ES_PerfMarkerRecord_t PerfMarkerTable[CFE_MISSION_ES_PERF_MAX_IDS];
+#if (CFE_PLATFORM_ES_PERF_MARKER_STATS == true)
+   CFE_ES_PerfTaskEntries_t  PerfTaskEntries[OS_MAX_TASKS];
+#endif
 
    /*
    ** Startup Sync
    */
    volatile sig_atomic_t SystemState;
+   osal_id_t             StartupSyncSem;   /**< Flushed when the system state or an app state changes */
+   OS_time_t             StartupProfileBase; /**< PSP time at the entry to CFE_ES_Main, for the startup profile */
 
    /*
    ** ES Task Table
@@ -114,6 +195,14 @@ typedef struct
    uint32              RegisteredTasks;
    CFE_ES_TaskRecord_t TaskTable[OS_MAX_TASKS];
 
+   /*
+   ** Task CPU utilization scan.  The sample times are a ring of
+   ** CFE_PLATFORM_ES_TASK_UTIL_WINDOW entries, shared with the CPU
+   ** time samples in each task record.
+   */
+   uint32              TaskUtilSampleIdx;     /* Index of the latest sample */
+   OS_time_t           TaskUtilSampleTime[CFE_PLATFORM_ES_TASK_UTIL_WINDOW];
+
    /*
    ** ES App Table
    */
@@ -121,6 +210,13 @@ typedef struct
    uint32             RegisteredExternalApps;
    CFE_ResourceId_t   LastAppId;
    CFE_ES_AppRecord_t AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+   CFE_ResourceId_NameIndexEntry_t AppNameIndex[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+   uint32             AppSlotMap[CFE_RESOURCEID_SLOTMAP_WORDS(CFE_PLATFORM_ES_MAX_APPLICATIONS)];
+
+   /*
+   ** Parallel app loading from the startup script
+   */
+   CFE_ES_StartupLoadState_t StartupLoad;
 
    /*
    ** ES Shared Library Table
@@ -128,12 +224,16 @@ typedef struct
    uint32             RegisteredLibs;
    CFE_ResourceId_t   LastLibId;
    CFE_ES_LibRecord_t LibTable[CFE_PLATFORM_ES_MAX_LIBRARIES];
+   CFE_ResourceId_NameIndexEntry_t LibNameIndex[CFE_PLATFORM_ES_MAX_LIBRARIES];
+   uint32             LibSlotMap[CFE_RESOURCEID_SLOTMAP_WORDS(CFE_PLATFORM_ES_MAX_LIBRARIES)];
 
    /*
    ** ES Generic Counters Table
    */
    CFE_ResourceId_t   LastCounterId;
    CFE_ES_GenCounterRecord_t CounterTable[CFE_PLATFORM_ES_MAX_GEN_COUNTERS];
+   CFE_ResourceId_NameIndexEntry_t CounterNameIndex[CFE_PLATFORM_ES_MAX_GEN_COUNTERS];
+   uint32             CounterSlotMap[CFE_RESOURCEID_SLOTMAP_WORDS(CFE_PLATFORM_ES_MAX_GEN_COUNTERS)];
 
    /*
    ** Critical Data Store Management Variables
@@ -152,6 +252,7 @@ typedef struct
    */
    CFE_ResourceId_t       LastMemPoolId;
    CFE_ES_MemPoolRecord_t MemPoolTable[CFE_PLATFORM_ES_MAX_MEMORY_POOLS];
+   uint32                 MemPoolSlotMap[CFE_RESOURCEID_SLOTMAP_WORDS(CFE_PLATFORM_ES_MAX_MEMORY_POOLS)];
 
 } CFE_ES_Global_t;
 
@@ -171,5 +272,11 @@ extern CFE_ES_ResetData_t *CFE_ES_ResetDataPtr;
 extern void  CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber);
 extern void  CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber);
 
+/*
+** Functions used to wait for and notify startup state changes
+*/
+extern void  CFE_ES_StartupSyncNotify(void);
+extern int32 CFE_ES_StartupSyncWait(uint32 *WaitRemainingPtr);
+
 
 #endif
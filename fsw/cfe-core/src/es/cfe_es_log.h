@@ -89,22 +89,16 @@
 
 
 /**
- * \brief Self-synchronized macro to call CFE_ES_SysLogAppend_Unsync
+ * \brief Self-synchronized macro to append to the syslog and the console
  *
- * Calls CFE_ES_SysLogAppend_Unsync() with appropriate synchronization.
- * It will acquire the shared data lock and release it after appending the log.
+ * Calls CFE_ES_SysLogAppend(), which performs the appropriate synchronization,
+ * then outputs the message to the console.
  *
- * This is implemented as a macro such that the "__func__" and "__LINE__" directives
- * will reflect the actual place that the append was done, rather than where this
- * wrapper was defined.
- *
- * \sa CFE_ES_SysLogAppend_Unsync()
+ * \sa CFE_ES_SysLogAppend()
  */
 #define CFE_ES_SYSLOG_APPEND(LogString)                     \
         {                                                   \
-            CFE_ES_LockSharedData(__func__, __LINE__);      \
-            CFE_ES_SysLogAppend_Unsync(LogString);          \
-            CFE_ES_UnlockSharedData(__func__, __LINE__);    \
+            CFE_ES_SysLogAppend(LogString);                 \
             OS_printf("%s", LogString);                     \
         }
 
@@ -217,6 +211,23 @@ int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...);
  */
 int32 CFE_ES_SysLogAppend_Unsync(const char *LogString);
 
+/**
+ * \brief Append a complete pre-formatted string to the ES SysLog, with synchronization
+ *
+ * Identical to CFE_ES_SysLogAppend_Unsync(), but safe to call from any task.
+ *
+ * If the message fits before the end of the buffer, the space for it is
+ * reserved with an atomic update of the write index and the message is
+ * copied in without taking a lock, so concurrent writers do not block
+ * each other.  Otherwise the ES shared data lock is taken and the message
+ * is appended by CFE_ES_SysLogAppend_Unsync().
+ *
+ * \param LogString     Message to append
+ *
+ * \sa CFE_ES_SysLogAppend_Unsync()
+ */
+int32 CFE_ES_SysLogAppend(const char *LogString);
+
 /**
  * \brief Read data from the system log buffer into the local buffer
  *
@@ -223,7 +223,7 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t       *PoolID,
     CFE_ES_LockSharedData(__func__,__LINE__);
 
     /* scan for a free slot */
-    PendingID = CFE_ResourceId_FindNext(CFE_ES_Global.LastMemPoolId, CFE_PLATFORM_ES_MAX_MEMORY_POOLS, CFE_ES_CheckMemPoolSlotUsed);
+    PendingID = CFE_ResourceId_FindNextFree(CFE_ES_Global.LastMemPoolId, CFE_PLATFORM_ES_MAX_MEMORY_POOLS, CFE_ES_Global.MemPoolSlotMap, CFE_ES_CheckMemPoolSlotUsed);
     PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(CFE_ES_MEMHANDLE_C(PendingID));
 
     if (PoolRecPtr == NULL)
@@ -236,6 +236,8 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t       *PoolID,
         /* Fully clear the entry, just in case of stale data */
         memset(PoolRecPtr, 0, sizeof(*PoolRecPtr));
         CFE_ES_MemPoolRecordSetUsed(PoolRecPtr, CFE_RESOURCEID_RESERVED);
+        CFE_ResourceId_SlotMapMark(CFE_ES_Global.MemPoolSlotMap, CFE_PLATFORM_ES_MAX_MEMORY_POOLS,
+                PoolRecPtr - CFE_ES_Global.MemPoolTable, true);
         CFE_ES_Global.LastMemPoolId = PendingID;
         Status = CFE_SUCCESS;
     }
@@ -269,7 +271,11 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t       *PoolID,
      * Most of the work is done by the generic pool implementation.
      * This subsystem works in offsets, not pointers.
      */
+#if (CFE_PLATFORM_ES_MEMPOOL_BUDDY_MODE == true)
+    Status = CFE_ES_GenPoolInitializeBuddy(
+#else
     Status = CFE_ES_GenPoolInitialize(
+#endif
             &PoolRecPtr->Pool,
             0,
             Size,
@@ -279,6 +285,18 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t       *PoolID,
             CFE_ES_MemPoolDirectRetrieve,
             CFE_ES_MemPoolDirectCommit);
 
+#if (CFE_PLATFORM_ES_MEMPOOL_LOCKFREE == true)
+    /*
+     * Shared pools use atomic free stacks where supported, so the
+     * mutex is only needed when creating new blocks.  This is a no-op
+     * if the pool configuration or CPU does not allow it.
+     */
+    if (Status == CFE_SUCCESS && UseMutex == CFE_ES_USE_MUTEX)
+    {
+        CFE_ES_GenPoolEnableLockFree(&PoolRecPtr->Pool);
+    }
+#endif
+
     /*
      * If successful, complete the process.
      */
@@ -327,9 +345,14 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t       *PoolID,
     else
     {
         /*
-         * Free the entry that was reserved earlier
+         * Free the entry that was reserved earlier.  The slot map is
+         * shared with other pools being created, so lock while it is marked.
          */
+        CFE_ES_LockSharedData(__func__,__LINE__);
         CFE_ES_MemPoolRecordSetFree(PoolRecPtr);
+        CFE_ResourceId_SlotMapMark(CFE_ES_Global.MemPoolSlotMap, CFE_PLATFORM_ES_MAX_MEMORY_POOLS,
+                PoolRecPtr - CFE_ES_Global.MemPoolTable, false);
+        CFE_ES_UnlockSharedData(__func__,__LINE__);
         PendingID = CFE_RESOURCEID_UNDEFINED;
 
         if (Status == CFE_ES_POOL_BOUNDS_ERROR)
@@ -363,6 +386,8 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
     {
         MutexId = PoolRecPtr->MutexId; /* snapshot mutex ID, will be freed later */
         CFE_ES_MemPoolRecordSetFree(PoolRecPtr);
+        CFE_ResourceId_SlotMapMark(CFE_ES_Global.MemPoolSlotMap, CFE_PLATFORM_ES_MAX_MEMORY_POOLS,
+                PoolRecPtr - CFE_ES_Global.MemPoolTable, false);
         Status = CFE_SUCCESS;
     }
     else
@@ -424,29 +449,45 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr,
     }
 
     /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
+     * In lock-free mode, first try to recycle a previously returned
+     * block without taking the mutex.
      */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    if (PoolRecPtr->Pool.LockFree)
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        Status = CFE_ES_GenPoolGetFreeBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+    }
+    else
+    {
+        Status = CFE_ES_BUFFER_NOT_IN_POOL;
     }
 
-    /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
-     */
-    Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
-
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    if (Status != CFE_SUCCESS)
     {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemTake(PoolRecPtr->MutexId);
+        }
+
+        /*
+         * Fundamental work is done as a generic routine.
+         *
+         * If successful, this gets an offset, which can then
+         * be translated into a pointer to return to the caller.
+         */
+        Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
     }
 
     /* If not successful, return error now */
@@ -541,8 +582,10 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
     /*
      * Real work begins here.
      * If pool is mutex-protected, take the mutex now.
+     * (Not needed in lock-free mode, as returning a block
+     * never modifies state shared with the block creation)
      */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId) && !PoolRecPtr->Pool.LockFree)
     {
         OS_MutSemTake(PoolRecPtr->MutexId);
     }
@@ -561,7 +604,7 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
      * Real work ends here.
      * If pool is mutex-protected, release the mutex now.
      */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId) && !PoolRecPtr->Pool.LockFree)
     {
         OS_MutSemGive(PoolRecPtr->MutexId);
     }
@@ -664,6 +707,165 @@ int32 CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr,
 }
 
 
+/*
+** Function:
+**   CFE_ES_GetMemPoolProfile
+**
+** Purpose:
+**   ES Internal API - See Prototype for full API description
+*/
+int32 CFE_ES_GetMemPoolProfile(CFE_ES_MemPoolProfile_t *ProfilePtr,
+                               CFE_ES_MemHandle_t  Handle)
+{
+    CFE_ES_MemPoolRecord_t *PoolRecPtr;
+    CFE_ES_BlockStats_t BlockStats;
+    CFE_ES_BlockProfile_t *BlockProfilePtr;
+    size_t BlockSizeList[CFE_MISSION_ES_POOL_MAX_BUCKETS];
+    uint64 RequestedBytes;
+    uint32 Count;
+    uint32 TotalCount;
+    uint32 CheckErrCtr;
+    uint16 NumBuckets;
+    uint16 NumSuggested;
+    uint16 Idx;
+
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+
+    /* basic sanity check */
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+    {
+        return(CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    }
+
+    memset(ProfilePtr, 0, sizeof(*ProfilePtr));
+    ProfilePtr->PoolHandle = Handle;
+
+    /*
+     * If pool is mutex-protected, take the mutex now.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        OS_MutSemTake(PoolRecPtr->MutexId);
+    }
+
+    CFE_ES_GenPoolGetUsage(&PoolRecPtr->Pool,
+            &ProfilePtr->NumFreeBytes,
+            &ProfilePtr->PoolSize);
+
+    CFE_ES_GenPoolGetCounts(&PoolRecPtr->Pool,
+            &NumBuckets,
+            &ProfilePtr->NumBlocksRequested,
+            &CheckErrCtr);
+
+    /*
+     * Report the buckets in ascending size order, which is
+     * descending bucket ID order, as done for the pool stats.
+     */
+    Idx = 0;
+    while (NumBuckets > 0 && Idx < CFE_MISSION_ES_POOL_MAX_BUCKETS)
+    {
+        BlockProfilePtr = &ProfilePtr->BlockProfile[Idx];
+
+        CFE_ES_GenPoolGetBucketUsage(&PoolRecPtr->Pool, NumBuckets, &BlockStats);
+        CFE_ES_GenPoolGetBucketProfile(&PoolRecPtr->Pool, NumBuckets,
+                &BlockProfilePtr->PeakInUse, &RequestedBytes);
+
+        BlockProfilePtr->BlockSize = BlockStats.BlockSize;
+        BlockProfilePtr->NumCreated = BlockStats.NumCreated;
+        BlockProfilePtr->NumFree = BlockStats.NumFree;
+        BlockProfilePtr->RequestedBytes = CFE_ES_MEMOFFSET_C(RequestedBytes);
+        BlockProfilePtr->UnusedBytes = CFE_ES_MEMOFFSET_C(
+                (BlockStats.NumCreated * (uint64)BlockStats.BlockSize) - RequestedBytes);
+
+        BlockSizeList[Idx] = (size_t)BlockStats.BlockSize;
+
+        --NumBuckets;
+        ++Idx;
+    }
+    ProfilePtr->NumBlockSizes = Idx;
+
+    TotalCount = 0;
+    Idx = 0;
+    while (CFE_ES_GenPoolGetSizeProfile(&PoolRecPtr->Pool, Idx, NULL, NULL, &Count))
+    {
+        TotalCount += Count;
+        ++Idx;
+    }
+    ProfilePtr->NumSizeRanges = Idx;
+
+    if (TotalCount > 0)
+    {
+        ProfilePtr->AvgBlockSize = CFE_ES_MEMOFFSET_C(CFE_ES_GenPoolCalcProfileCost(&PoolRecPtr->Pool,
+                ProfilePtr->NumBlockSizes, BlockSizeList) / TotalCount);
+
+        /*
+         * Suggest the same number of sizes as currently configured,
+         * so the result can directly replace the existing list.
+         */
+        NumSuggested = CFE_ES_GenPoolSuggestBlockSizes(&PoolRecPtr->Pool,
+                ProfilePtr->NumBlockSizes, BlockSizeList);
+
+        ProfilePtr->SuggestedAvgBlockSize = CFE_ES_MEMOFFSET_C(CFE_ES_GenPoolCalcProfileCost(&PoolRecPtr->Pool,
+                NumSuggested, BlockSizeList) / TotalCount);
+
+        for (Idx = 0; Idx < NumSuggested; ++Idx)
+        {
+            ProfilePtr->SuggestedBlockSizes[Idx] = CFE_ES_MEMOFFSET_C(BlockSizeList[Idx]);
+        }
+        ProfilePtr->NumSuggestedSizes = NumSuggested;
+    }
+
+    /*
+     * If pool is mutex-protected, release the mutex now.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        OS_MutSemGive(PoolRecPtr->MutexId);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*
+** Function:
+**   CFE_ES_GetMemPoolSizeProfile
+**
+** Purpose:
+**   ES Internal API - See Prototype for full API description
+*/
+int32 CFE_ES_GetMemPoolSizeProfile(CFE_ES_MemPoolSizeProfile_t *SizeProfilePtr,
+                                   CFE_ES_MemHandle_t  Handle,
+                                   uint16 SizeRange)
+{
+    CFE_ES_MemPoolRecord_t *PoolRecPtr;
+    size_t MinSize;
+    size_t MaxSize;
+
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+
+    /* basic sanity check */
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+    {
+        return(CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    }
+
+    /*
+     * The profile counters are only ever updated atomically,
+     * so there is no need to take the pool mutex to read them.
+     */
+    if (!CFE_ES_GenPoolGetSizeProfile(&PoolRecPtr->Pool, SizeRange,
+            &MinSize, &MaxSize, &SizeProfilePtr->Count))
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    SizeProfilePtr->MinSize = CFE_ES_MEMOFFSET_C(MinSize);
+    SizeProfilePtr->MaxSize = CFE_ES_MEMOFFSET_C(MaxSize);
+
+    return CFE_SUCCESS;
+}
+
+
 /*
 ** Function:
 **   CFE_ES_ValidateHandle
@@ -187,7 +187,7 @@ static inline bool CFE_ES_MemPoolRecordIsMatch(const CFE_ES_MemPoolRecord_t *Poo
  *
  * Checks if a table slot is available for a potential new ID
  * This is a helper function intended to be used with 
- * CFE_ResourceId_FindNext() for allocating new IDs
+ * CFE_ResourceId_FindNextFree() for allocating new IDs
  * 
  * As this dereferences fields within the record, global data must be
  * locked prior to invoking this function.
@@ -197,5 +197,40 @@ static inline bool CFE_ES_MemPoolRecordIsMatch(const CFE_ES_MemPoolRecord_t *Poo
  */
 bool CFE_ES_CheckMemPoolSlotUsed(CFE_ResourceId_t CheckId);
 
+/**
+ * @brief Obtain the allocation profile of a memory pool
+ *
+ * Fills in the usage and peak of each block size in the pool, in
+ * ascending size order, along with a suggested list of the same number of
+ * block sizes which would have served the recorded requests with the
+ * least memory.
+ *
+ * @param[out]  ProfilePtr   buffer to store the profile
+ * @param[in]   Handle       the Pool ID
+ *
+ * @return Execution status, see @ref CFEReturnCodes
+ * @retval #CFE_SUCCESS                      @copybrief CFE_SUCCESS
+ * @retval #CFE_ES_ERR_RESOURCEID_NOT_VALID  @copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+ */
+int32 CFE_ES_GetMemPoolProfile(CFE_ES_MemPoolProfile_t *ProfilePtr, CFE_ES_MemHandle_t Handle);
+
+/**
+ * @brief Obtain the number of requests made to a memory pool within a range of sizes
+ *
+ * Ranges are numbered from zero, and the number of ranges is given by the
+ * NumSizeRanges field of the pool profile.
+ *
+ * @param[out]  SizeProfilePtr   buffer to store the size range profile
+ * @param[in]   Handle           the Pool ID
+ * @param[in]   SizeRange        the size range number
+ *
+ * @return Execution status, see @ref CFEReturnCodes
+ * @retval #CFE_SUCCESS                      @copybrief CFE_SUCCESS
+ * @retval #CFE_ES_ERR_RESOURCEID_NOT_VALID  @copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+ * @retval #CFE_ES_BAD_ARGUMENT              @copybrief CFE_ES_BAD_ARGUMENT
+ */
+int32 CFE_ES_GetMemPoolSizeProfile(CFE_ES_MemPoolSizeProfile_t *SizeProfilePtr, CFE_ES_MemHandle_t Handle,
+        uint16 SizeRange);
+
 
 #endif  /* _CFE_ES_MEMPOOL_H_ */
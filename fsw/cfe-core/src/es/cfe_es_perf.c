@@ -38,9 +38,11 @@
 #include "cfe_es_start.h"
 #include "cfe_es_events.h"
 #include "cfe_es_task.h"
+#include "cfe_es_atomic.h"
 #include "cfe_fs.h"
 #include "cfe_psp.h"
 #include <string.h>
+#include <stdio.h>
 
 
 /*
@@ -73,12 +75,31 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
 
 
     uint32      i;
+#if (CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS == true)
+    uint32      TicksPerSecond;
+    uint32      Low32Rollover;
+
+    /*
+    ** This also selects the timestamp source, so it is done on every reset
+    */
+    CFE_ES_PerfGetTimestampInfo(&TicksPerSecond, &Low32Rollover);
+#endif
 
     /*
     ** Set the pointer to the data area
     */
     Perf = (CFE_ES_PerfData_t *)&(CFE_ES_ResetDataPtr->Perf);
 
+#if (CFE_PLATFORM_ES_PERF_MARKER_STATS == true)
+    /*
+    ** The marker statistics are not preserved, so start with no minimum
+    */
+    for (i=0; i < CFE_MISSION_ES_PERF_MAX_IDS; i++)
+    {
+       CFE_ES_Global.PerfMarkerTable[i].MinDuration = 0xFFFFFFFF;
+    }
+#endif
+
     if ( ResetType == CFE_PSP_RST_TYPE_PROCESSOR )
     {
        /*
@@ -90,10 +111,15 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
     else
     {
 
-       Perf->MetaData.Version = 1;
+       Perf->MetaData.Version = CFE_ES_PERF_DATA_VERSION;
        Perf->MetaData.Endian = EndianCheck.Endian;
+#if (CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS == true)
+       Perf->MetaData.TimerTicksPerSecond = TicksPerSecond;
+       Perf->MetaData.TimerLow32Rollover = Low32Rollover;
+#else
        Perf->MetaData.TimerTicksPerSecond = CFE_PSP_GetTimerTicksPerSecond();
        Perf->MetaData.TimerLow32Rollover = CFE_PSP_GetTimerLow32Rollover();
+#endif
 
        /* set data collection state to waiting for command state */
        Perf->MetaData.State = CFE_ES_PERF_IDLE;
@@ -103,6 +129,7 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
        Perf->MetaData.DataEnd = 0;
        Perf->MetaData.DataCount = 0;
        Perf->MetaData.InvalidMarkerReported = false;
+       Perf->SwitchCount = 0;
        Perf->MetaData.FilterTriggerMaskSize = CFE_ES_PERF_32BIT_WORDS_IN_MASK;
 
        for (i=0; i < CFE_ES_PERF_32BIT_WORDS_IN_MASK; i++)
@@ -153,6 +180,44 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_PerfStopWriters()                                          */
+/*                                                                               */
+/*  Purpose:                                                                     */
+/*    Local helper to stop new entries being added to the perf log, and wait for */
+/*    lock-free writers which are still adding an entry to finish.  This is      */
+/*    called with the perf data mutex held, which excludes the other writers,    */
+/*    before the log counters are reset or the log is read.                      */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfStopWriters(void)
+{
+#if (CFE_PLATFORM_ES_PERF_LOCKFREE == true) && CFE_ES_ATOMIC_AVAILABLE
+    uint32 Waited;
+
+    /*
+     * Writers register before they check the state, so after this
+     * each writer is either counted, or will see the idle state
+     */
+    CFE_ES_AtomicStore32((uint32 *)&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+
+    Waited = 0;
+    while (CFE_ES_AtomicLoad32(&CFE_ES_Global.PerfActiveWriters) != 0)
+    {
+        if (Waited >= CFE_ES_PERF_WRITER_WAIT_LIMIT)
+        {
+            CFE_ES_WriteToSysLog("ES PERF:%u writers did not finish, continuing\n",
+                    (unsigned int)CFE_ES_AtomicLoad32(&CFE_ES_Global.PerfActiveWriters));
+            break;
+        }
+        OS_TaskDelay(1);
+        ++Waited;
+    }
+#else
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+#endif
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                               */
 /* CFE_ES_StartPerfDataCmd() --                                                  */
@@ -162,10 +227,13 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
 {
     const CFE_ES_StartPerfCmd_Payload_t *CmdPtr = &data->Payload;
     CFE_ES_PerfDumpGlobal_t *PerfDumpState = &CFE_ES_TaskData.BackgroundPerfDumpState;
+    CFE_ES_PerfStreamGlobal_t *PerfStreamState = &CFE_ES_TaskData.BackgroundPerfStreamState;
 
     /* Ensure there is no file write in progress before proceeding */
     if(PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
-            PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
+            PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE &&
+            PerfStreamState->CurrentState == CFE_ES_PerfStreamState_IDLE &&
+            PerfStreamState->PendingState == CFE_ES_PerfStreamState_IDLE)
     {
         /* Make sure Trigger Mode is valid */
         /* cppcheck-suppress unsignedPositive */
@@ -177,6 +245,7 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             /* Taking lock here as this might be changing states from one active mode to another.
              * In that case, need to make sure that the log is not written to while resetting the counters. */
             OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+            CFE_ES_PerfStopWriters();
             Perf->MetaData.Mode = CmdPtr->TriggerMode;
             Perf->MetaData.TriggerCount = 0;
             Perf->MetaData.DataStart = 0;
@@ -218,12 +287,30 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
 {
     const CFE_ES_StopPerfCmd_Payload_t *CmdPtr = &data->Payload;
     CFE_ES_PerfDumpGlobal_t *PerfDumpState = &CFE_ES_TaskData.BackgroundPerfDumpState;
+    CFE_ES_PerfStreamGlobal_t *PerfStreamState = &CFE_ES_TaskData.BackgroundPerfStreamState;
+
+    if (Perf->MetaData.State == CFE_ES_PERF_STREAMING)
+    {
+        /*
+         * End the stream.  The background task writes out the remaining
+         * entries, there is nothing to dump to a file in this case.
+         */
+        Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        CFE_ES_BackgroundWakeup();
+
+        CFE_ES_TaskData.CommandCounter++;
 
+        CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_EID,CFE_EVS_EventType_DEBUG,
+                "Perf Stop Cmd Rcvd, ending stream to %s",
+                PerfStreamState->StreamName);
+    }
     /* Ensure there is no file write in progress before proceeding */
     /* note - also need to check the PendingState here, in case this command
      * was sent twice in succession and the background task has not awakened yet */
-    if(PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
-            PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
+    else if(PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
+            PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE &&
+            PerfStreamState->CurrentState == CFE_ES_PerfStreamState_IDLE &&
+            PerfStreamState->PendingState == CFE_ES_PerfStreamState_IDLE)
     {
         Perf->MetaData.State = CFE_ES_PERF_IDLE;
 
@@ -232,6 +319,8 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
                 CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME,
                 sizeof(PerfDumpState->DataFileName), sizeof(CmdPtr->DataFileName));
 
+        PerfDumpState->Format = CFE_ES_PerfDumpFormat_BINARY;
+
         PerfDumpState->PendingState = CFE_ES_PerfDumpState_INIT;
         CFE_ES_BackgroundWakeup();
 
@@ -256,6 +345,220 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
 } /* End of CFE_ES_StopPerfDataCmd() */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                               */
+/* CFE_ES_WritePerfTraceCmd() --                                                 */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_WritePerfTraceCmd(const CFE_ES_WritePerfTraceCmd_t *data)
+{
+    const CFE_ES_WritePerfTraceCmd_Payload_t *CmdPtr = &data->Payload;
+    CFE_ES_PerfDumpGlobal_t *PerfDumpState = &CFE_ES_TaskData.BackgroundPerfDumpState;
+    CFE_ES_PerfStreamGlobal_t *PerfStreamState = &CFE_ES_TaskData.BackgroundPerfStreamState;
+
+    /* Ensure there is no file write or stream in progress before proceeding */
+    if(PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
+            PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE &&
+            PerfStreamState->CurrentState == CFE_ES_PerfStreamState_IDLE &&
+            PerfStreamState->PendingState == CFE_ES_PerfStreamState_IDLE)
+    {
+        Perf->MetaData.State = CFE_ES_PERF_IDLE;
+
+        /* Copy out the string, using default if unspecified */
+        CFE_SB_MessageStringGet(PerfDumpState->DataFileName, CmdPtr->FileName,
+                CFE_PLATFORM_ES_DEFAULT_PERF_TRACE_FILENAME,
+                sizeof(PerfDumpState->DataFileName), sizeof(CmdPtr->FileName));
+
+        PerfDumpState->Format = CFE_ES_PerfDumpFormat_TRACE;
+        PerfDumpState->PendingState = CFE_ES_PerfDumpState_INIT;
+        CFE_ES_BackgroundWakeup();
+
+        CFE_ES_TaskData.CommandCounter++;
+
+        CFE_EVS_SendEvent(CFE_ES_PERF_TRACECMD_EID,CFE_EVS_EventType_DEBUG,
+                "Perf Trace Cmd Rcvd, will write %d entries to %s",
+                (int)Perf->MetaData.DataCount,
+                PerfDumpState->DataFileName);
+    }
+    else
+    {
+        CFE_ES_TaskData.CommandErrorCounter++;
+        CFE_EVS_SendEvent(CFE_ES_PERF_TRACECMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                "Perf trace cmd ignored, perf data write in progress");
+    }
+
+    return CFE_SUCCESS;
+} /* End of CFE_ES_WritePerfTraceCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_PerfReadTimer()                                            */
+/*                                                                               */
+/*  Purpose:                                                                     */
+/*    Local helper to store the current time in a perf log entry, from the       */
+/*    high resolution timestamp source if enabled, or the PSP timebase.          */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline void CFE_ES_PerfReadTimer(CFE_ES_PerfDataEntry_t *EntryPtr)
+{
+#if (CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS == true)
+    CFE_ES_PerfGetTimestamp(EntryPtr);
+#else
+    CFE_PSP_Get_Timebase(&EntryPtr->TimerUpper32, &EntryPtr->TimerLower32);
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_PerfEntryTicks()                                           */
+/*                                                                               */
+/*  Purpose:                                                                     */
+/*    Local helper to convert the timestamp of a perf log entry to a single      */
+/*    count of timer ticks.                                                      */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint64 CFE_ES_PerfEntryTicks(const CFE_ES_PerfDataEntry_t *EntryPtr)
+{
+    uint64 Rollover;
+
+    /* a rollover value of zero means that the lower 32 bits roll over at 2^32 */
+    Rollover = Perf->MetaData.TimerLow32Rollover;
+    if (Rollover == 0)
+    {
+        Rollover = 0x100000000ULL;
+    }
+
+    return ((uint64)EntryPtr->TimerUpper32 * Rollover) + EntryPtr->TimerLower32;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_PerfTraceFormatHeader()                                    */
+/*                                                                               */
+/*  Purpose:                                                                     */
+/*    Local helper to format one item of a trace file into the given buffer.     */
+/*    Item 0 is the start of the file, items 1 to CFE_MISSION_ES_PERF_MAX_IDS     */
+/*    name the track of each registered marker.  Returns the length, or 0 if     */
+/*    there is nothing to write for the item.                                    */
+/*                                                                               */
+/*  The trace uses the Chrome trace event JSON format, which can be viewed in    */
+/*  chrome://tracing or the Perfetto UI.  The log entries do not identify the    */
+/*  calling task, so each marker is shown as its own track (thread).             */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static size_t CFE_ES_PerfTraceFormatHeader(CFE_ES_PerfDumpGlobal_t *State, uint32 Item,
+        char *Buffer, size_t BufferSize)
+{
+    const char *Name;
+    int Len;
+
+    if (Item == 0)
+    {
+        Len = snprintf(Buffer, BufferSize, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    }
+    else
+    {
+        /*
+         * Names are normally only registered during app init,
+         * so this reads them without locking.
+         */
+        Name = CFE_ES_Global.PerfMarkerTable[Item - 1].Name;
+        if (Name[0] == 0)
+        {
+            return 0;
+        }
+
+        Len = snprintf(Buffer, BufferSize,
+                "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                (State->TraceEvents == 0) ? "" : ",\n",
+                (unsigned int)CFE_PSP_GetProcessorId(), (unsigned int)(Item - 1), Name);
+    }
+
+    if (Len < 0 || (size_t)Len >= BufferSize)
+    {
+        return 0;
+    }
+
+    /* only events which are written count, the separator depends on it */
+    if (Item != 0)
+    {
+        ++State->TraceEvents;
+    }
+
+    return Len;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_PerfTraceFormatEntry()                                     */
+/*                                                                               */
+/*  Purpose:                                                                     */
+/*    Local helper to format a perf log entry as a trace event, with the         */
+/*    timestamp converted to microseconds.  Returns the length of the event.     */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static size_t CFE_ES_PerfTraceFormatEntry(CFE_ES_PerfDumpGlobal_t *State, const CFE_ES_PerfDataEntry_t *EntryPtr,
+        char *Buffer, size_t BufferSize)
+{
+    uint64 Ticks;
+    uint64 TicksPerSecond;
+    uint64 Seconds;
+    uint64 Nanoseconds;
+    uint32 Marker;
+    const char *Name;
+    char DefaultName[20];
+    int Len;
+
+    Marker = EntryPtr->Data & ~(1U << CFE_MISSION_ES_PERF_EXIT_BIT);
+
+    Name = "";
+    if (Marker < CFE_MISSION_ES_PERF_MAX_IDS)
+    {
+        Name = CFE_ES_Global.PerfMarkerTable[Marker].Name;
+    }
+    if (Name[0] == 0)
+    {
+        snprintf(DefaultName, sizeof(DefaultName), "Marker %u", (unsigned int)Marker);
+        Name = DefaultName;
+    }
+
+    TicksPerSecond = Perf->MetaData.TimerTicksPerSecond;
+    if (TicksPerSecond == 0)
+    {
+        TicksPerSecond = 1;
+    }
+
+    Ticks = CFE_ES_PerfEntryTicks(EntryPtr);
+    Seconds = Ticks / TicksPerSecond;
+    Nanoseconds = ((Ticks % TicksPerSecond) * 1000000000ULL) / TicksPerSecond;
+
+#if (CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS == true)
+    /* the CPU number is shown in the event details */
+    Len = snprintf(Buffer, BufferSize,
+            "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":%u,\"tid\":%u,\"args\":{\"cpu\":%u}}",
+            (State->TraceEvents == 0) ? "" : ",\n", Name,
+            ((EntryPtr->Data >> CFE_MISSION_ES_PERF_EXIT_BIT) & 1) ? 'E' : 'B',
+            (unsigned long long)((Seconds * 1000000) + (Nanoseconds / 1000)),
+            (unsigned int)(Nanoseconds % 1000),
+            (unsigned int)CFE_PSP_GetProcessorId(), (unsigned int)Marker,
+            (unsigned int)EntryPtr->CpuId);
+#else
+    Len = snprintf(Buffer, BufferSize,
+            "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":%u,\"tid\":%u}",
+            (State->TraceEvents == 0) ? "" : ",\n", Name,
+            ((EntryPtr->Data >> CFE_MISSION_ES_PERF_EXIT_BIT) & 1) ? 'E' : 'B',
+            (unsigned long long)((Seconds * 1000000) + (Nanoseconds / 1000)),
+            (unsigned int)(Nanoseconds % 1000),
+            (unsigned int)CFE_PSP_GetProcessorId(), (unsigned int)Marker);
+#endif
+
+    if (Len < 0 || (size_t)Len >= BufferSize)
+    {
+        return 0;
+    }
+
+    ++State->TraceEvents;
+
+    return Len;
+}
+
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*  Function:  CFE_ES_RunPerfLogDump()                                           */
 /*                                                                               */
@@ -275,6 +578,7 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
     int32               Status;
     CFE_FS_Header_t     FileHdr;
     size_t              BlockSize;
+    char                TraceBuffer[160];
 
     /*
      * each time this background job is re-entered after a time delay,
@@ -344,16 +648,44 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
 
             case CFE_ES_PerfDumpState_LOCK_DATA:
                 OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+                CFE_ES_PerfStopWriters();
                 break;
 
             case CFE_ES_PerfDumpState_WRITE_FS_HDR:
+                /* a trace file has no CFE FS header */
+                if (State->Format == CFE_ES_PerfDumpFormat_BINARY)
+                {
+                    State->StateCounter = 1;
+                }
+                break;
+
             case CFE_ES_PerfDumpState_WRITE_PERF_METADATA:
-                State->StateCounter = 1;
+                if (State->Format == CFE_ES_PerfDumpFormat_TRACE)
+                {
+                    /* the start of the file, then the name of each marker */
+                    State->StateCounter = 1 + CFE_MISSION_ES_PERF_MAX_IDS;
+                    State->DataPos = 0;
+                    State->TraceEvents = 0;
+                }
+                else
+                {
+                    State->StateCounter = 1;
+                }
                 break;
 
             case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
-                State->DataPos = Perf->MetaData.DataStart;
+                /*
+                 * Start from the oldest entry, computed from the end and count.
+                 * This is always consistent, whereas DataStart may lag behind
+                 * by an entry if it was updated by concurrent lock-free writers.
+                 */
                 State->StateCounter = Perf->MetaData.DataCount;
+                State->DataPos = Perf->MetaData.DataEnd + CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE -
+                        State->StateCounter;
+                if (State->DataPos >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+                {
+                    State->DataPos -= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+                }
                 break;
 
             case CFE_ES_PerfDumpState_UNLOCK_DATA:
@@ -407,6 +739,20 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                 break;
 
             case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
+                if (State->Format == CFE_ES_PerfDumpFormat_TRACE)
+                {
+                    /* end of the trace events array and the file */
+                    BlockSize = snprintf(TraceBuffer, sizeof(TraceBuffer), "\n]}\n");
+                    Status = OS_write(State->FileDesc, TraceBuffer, BlockSize);
+                    if (Status != BlockSize)
+                    {
+                        CFE_ES_FileWriteByteCntErr(State->DataFileName, BlockSize, Status);
+                        State->PendingState = CFE_ES_PerfDumpState_CLEANUP;
+                        break;
+                    }
+                    State->FileSize += BlockSize;
+                }
+
                 CFE_EVS_SendEvent(CFE_ES_PERF_DATAWRITTEN_EID,CFE_EVS_EventType_DEBUG,
                         "%s written:Size=%lu,EntryCount=%lu",
                         State->DataFileName,
@@ -439,6 +785,18 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                 break;
 
             case CFE_ES_PerfDumpState_WRITE_PERF_METADATA:
+                if (State->Format == CFE_ES_PerfDumpFormat_TRACE)
+                {
+                    BlockSize = CFE_ES_PerfTraceFormatHeader(State, State->DataPos,
+                            TraceBuffer, sizeof(TraceBuffer));
+                    if (BlockSize != 0)
+                    {
+                        Status = OS_write(State->FileDesc, TraceBuffer, BlockSize);
+                    }
+                    ++State->DataPos;
+                    break;
+                }
+
                 /* write the performance metadata to the file */
                 BlockSize = sizeof(CFE_ES_PerfMetaData_t);
                 Status = OS_write(State->FileDesc,
@@ -446,10 +804,19 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                 break;
 
             case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
-                BlockSize = sizeof(CFE_ES_PerfDataEntry_t);
-                Status = OS_write (State->FileDesc,
-                        &Perf->DataBuffer[State->DataPos],
-                        BlockSize);
+                if (State->Format == CFE_ES_PerfDumpFormat_TRACE)
+                {
+                    BlockSize = CFE_ES_PerfTraceFormatEntry(State, &Perf->DataBuffer[State->DataPos],
+                            TraceBuffer, sizeof(TraceBuffer));
+                    Status = OS_write(State->FileDesc, TraceBuffer, BlockSize);
+                }
+                else
+                {
+                    BlockSize = sizeof(CFE_ES_PerfDataEntry_t);
+                    Status = OS_write (State->FileDesc,
+                            &Perf->DataBuffer[State->DataPos],
+                            BlockSize);
+                }
 
                 ++State->DataPos;
                 if (State->DataPos >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
@@ -493,114 +860,911 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                               */
-/* CFE_ES_SetPerfFilterMaskCmd() --                                              */
+/* CFE_ES_StartPerfStreamCmd() --                                                */
 /*                                                                               */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 CFE_ES_SetPerfFilterMaskCmd(const CFE_ES_SetPerfFilterMaskCmd_t *data)
+int32 CFE_ES_StartPerfStreamCmd(const CFE_ES_StartPerfStreamCmd_t *data)
 {
-    const CFE_ES_SetPerfFilterMaskCmd_Payload_t *cmd = &data->Payload;
-
-    if(cmd->FilterMaskNum < CFE_ES_PERF_32BIT_WORDS_IN_MASK ){
-
-        Perf->MetaData.FilterMask[cmd->FilterMaskNum] = cmd->FilterMask;
+    const CFE_ES_StartPerfStreamCmd_Payload_t *CmdPtr = &data->Payload;
+    CFE_ES_PerfDumpGlobal_t *PerfDumpState = &CFE_ES_TaskData.BackgroundPerfDumpState;
+    CFE_ES_PerfStreamGlobal_t *PerfStreamState = &CFE_ES_TaskData.BackgroundPerfStreamState;
 
-        CFE_EVS_SendEvent(CFE_ES_PERF_FILTMSKCMD_EID, CFE_EVS_EventType_DEBUG,
-                "Set Performance Filter Mask Cmd rcvd, num %u, val 0x%08X",
-                (unsigned int)cmd->FilterMaskNum,(unsigned int)cmd->FilterMask);
+    /* Ensure there is no file write or stream in progress before proceeding */
+    if(PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
+            PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE &&
+            PerfStreamState->CurrentState == CFE_ES_PerfStreamState_IDLE &&
+            PerfStreamState->PendingState == CFE_ES_PerfStreamState_IDLE)
+    {
+        /* Copy out the string, using default if unspecified */
+        CFE_SB_MessageStringGet(PerfStreamState->StreamName, CmdPtr->StreamName,
+                CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME,
+                sizeof(PerfStreamState->StreamName), sizeof(CmdPtr->StreamName));
+
+        PerfStreamState->FileDesc = OS_OBJECT_ID_UNDEFINED;
+        PerfStreamState->RollEntries = CmdPtr->RollEntries;
+        PerfStreamState->HalvesWritten = 0;
+        PerfStreamState->HalfPos = 0;
+        PerfStreamState->FileCount = 0;
+        PerfStreamState->FileEntries = 0;
+        PerfStreamState->TotalEntries = 0;
+        PerfStreamState->LostEntries = 0;
+
+        /* Restart the log from the beginning of the first buffer half, as the start command does */
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+        CFE_ES_PerfStopWriters();
+        Perf->MetaData.TriggerCount = 0;
+        Perf->MetaData.DataStart = 0;
+        Perf->MetaData.DataEnd = 0;
+        Perf->MetaData.DataCount = 0;
+        Perf->MetaData.InvalidMarkerReported = false;
+        PerfStreamState->SwitchBase = Perf->SwitchCount;
+        Perf->MetaData.State = CFE_ES_PERF_STREAMING; /* this must be done last */
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+
+        PerfStreamState->PendingState = CFE_ES_PerfStreamState_OPEN_FILE;
+        CFE_ES_BackgroundWakeup();
 
         CFE_ES_TaskData.CommandCounter++;
-    }else{
-        CFE_EVS_SendEvent(CFE_ES_PERF_FILTMSKERR_EID, CFE_EVS_EventType_ERROR,
-                "Performance Filter Mask Cmd Error,Index(%u)out of range(%u)",
-                (unsigned int)cmd->FilterMaskNum,(unsigned int)CFE_ES_PERF_32BIT_WORDS_IN_MASK);
 
+        CFE_EVS_SendEvent(CFE_ES_PERF_STREAMCMD_EID, CFE_EVS_EventType_DEBUG,
+                "Start streaming performance data to %s, roll every %lu entries",
+                PerfStreamState->StreamName, (unsigned long)PerfStreamState->RollEntries);
+    }
+    else
+    {
         CFE_ES_TaskData.CommandErrorCounter++;
-
+        CFE_EVS_SendEvent(CFE_ES_PERF_STREAMCMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                "Cannot start streaming performance data, perf data write in progress");
     }
 
     return CFE_SUCCESS;
-} /* End of CFE_ES_SetPerfFilterMaskCmd() */
+} /* End of CFE_ES_StartPerfStreamCmd() */
+
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_PerfStreamWriteHeaders()                                   */
 /*                                                                               */
-/* CFE_ES_SetPerfTriggerMaskCmd() --                                             */
+/*  Purpose:                                                                     */
+/*    Local helper to write the file and metadata headers of a stream output     */
+/*    file, describing the entries written to the file so far.  This is done    */
+/*    when the file is opened, and again when it is closed if it is one of a     */
+/*    set of rolling files.                                                      */
 /*                                                                               */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
+static int32 CFE_ES_PerfStreamWriteHeaders(CFE_ES_PerfStreamGlobal_t *State)
 {
-    const CFE_ES_SetPerfTrigMaskCmd_Payload_t *cmd = &data->Payload;
-
-    if(cmd->TriggerMaskNum < CFE_ES_PERF_32BIT_WORDS_IN_MASK ){
-
-        Perf->MetaData.TriggerMask[cmd->TriggerMaskNum] = cmd->TriggerMask;
+    CFE_FS_Header_t       FileHdr;
+    CFE_ES_PerfMetaData_t MetaData;
+    int32                 Status;
 
-        CFE_EVS_SendEvent(CFE_ES_PERF_TRIGMSKCMD_EID, CFE_EVS_EventType_DEBUG,
-                "Set Performance Trigger Mask Cmd rcvd,num %u, val 0x%08X",
-                (unsigned int)cmd->TriggerMaskNum,(unsigned int)cmd->TriggerMask);
+    CFE_FS_InitHeader(&FileHdr, CFE_ES_PERF_LOG_DESC, CFE_FS_SubType_ES_PERFDATA);
+    FileHdr.Length = sizeof(CFE_ES_PerfMetaData_t) + (State->FileEntries * sizeof(CFE_ES_PerfDataEntry_t));
 
-        CFE_ES_TaskData.CommandCounter++;
+    /* note this also seeks to the start of the file */
+    Status = CFE_FS_WriteHeader(State->FileDesc, &FileHdr);
+    if (Status != sizeof(CFE_FS_Header_t))
+    {
+        CFE_ES_FileWriteByteCntErr(State->FileName, sizeof(CFE_FS_Header_t), Status);
+        return CFE_ES_FILE_IO_ERR;
+    }
 
-    }else{
-        CFE_EVS_SendEvent(CFE_ES_PERF_TRIGMSKERR_EID, CFE_EVS_EventType_ERROR,
-                "Performance Trigger Mask Cmd Error,Index(%u)out of range(%u)",
-                (unsigned int)cmd->TriggerMaskNum,(unsigned int)CFE_ES_PERF_32BIT_WORDS_IN_MASK);
+    /* the entries in the file are always in order, starting at the first */
+    MetaData = Perf->MetaData;
+    MetaData.DataStart = 0;
+    MetaData.DataEnd = State->FileEntries;
+    MetaData.DataCount = State->FileEntries;
 
-        CFE_ES_TaskData.CommandErrorCounter++;
+    Status = OS_write(State->FileDesc, &MetaData, sizeof(MetaData));
+    if (Status != sizeof(MetaData))
+    {
+        CFE_ES_FileWriteByteCntErr(State->FileName, sizeof(MetaData), Status);
+        return CFE_ES_FILE_IO_ERR;
     }
 
     return CFE_SUCCESS;
-} /* End of CFE_ES_SetPerfTriggerMaskCmd() */
-
+}
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/* Name: CFE_ES_PerfLogAdd                                                       */
-/*                                                                               */
-/* Purpose: This function adds a new entry to the data buffer.                   */
-/*                                                                               */
-/* Assumptions and Notes:                                                        */
-/*                                                                               */
-/*  This function implements a circular buffer using an array.                   */
-/*      DataStart points to first stored entry                                   */
-/*      DataEnd points to next available entry                                   */
-/*      if DataStart == DataEnd then the buffer is either empty or full          */
-/*      depending on the value of the DataCount                                  */
-/*                                                                               */
-/*  Time is stored as 2 32 bit integers, (TimerLower32, TimerUpper32):           */
-/*      TimerLower32 is the curent value of the hardware timer register.         */
-/*      TimerUpper32 is the number of times the timer has rolled over.           */
+/*  Function:  CFE_ES_PerfStreamOpenFile()                                       */
 /*                                                                               */
-/*  Time is stored as a absolute time instead of a relative time between log     */
-/*  entries. This will yield better accuracy since storing relative time between */
-/*  entries will accumulate (rounding/sampling) errors over time.  It also is    */
-/*  faster since the time does not need to be calculated.                        */
+/*  Purpose:                                                                     */
+/*    Local helper to open the next stream output file and write its headers    */
 /*                                                                               */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
+static int32 CFE_ES_PerfStreamOpenFile(CFE_ES_PerfStreamGlobal_t *State)
 {
-    CFE_ES_PerfDataEntry_t EntryData;
-    uint32 DataEnd;
+    int32 Status;
 
-    /*
-     * If the global state is idle, exit immediately without locking or doing anything
-     */
-    if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
+    if (State->RollEntries == 0)
     {
-        return;
+        Status = snprintf(State->FileName, sizeof(State->FileName), "%s", State->StreamName);
+    }
+    else
+    {
+        Status = snprintf(State->FileName, sizeof(State->FileName), "%s.%u", State->StreamName,
+                (unsigned int)(State->FileCount % CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES));
     }
 
-    /* if marker is out of range... */
-    if (Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
+    if (Status < 0 || (size_t)Status >= sizeof(State->FileName))
     {
-        /* if marker has not been reported previously ... */
-        if (Perf->MetaData.InvalidMarkerReported == false)
-        {
-            CFE_ES_WriteToSysLog("ES PERF:Invalid performance marker %d,max is %d\n", (unsigned int)Marker,
-                                 (CFE_MISSION_ES_PERF_MAX_IDS - 1));
-            Perf->MetaData.InvalidMarkerReported = true;
-        } /* end if */
+        Status = OS_FS_ERR_PATH_TOO_LONG;
+    }
+    else
+    {
+        /*
+         * Note that truncation does not apply to a FIFO or device,
+         * so this also works for a stream to another process.
+         */
+        Status = OS_OpenCreate(&State->FileDesc, State->FileName,
+                OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    }
 
-        return;
-    } /* end if */
+    if (Status < 0)
+    {
+        State->FileDesc = OS_OBJECT_ID_UNDEFINED;
+        CFE_EVS_SendEvent(CFE_ES_PERF_LOG_ERR_EID,CFE_EVS_EventType_ERROR,
+                "Error creating file %s, RC = %d",
+                State->FileName, (int)Status);
+        return Status;
+    }
+
+    ++State->FileCount;
+    State->FileEntries = 0;
+
+    Status = CFE_ES_PerfStreamWriteHeaders(State);
+    if (Status != CFE_SUCCESS)
+    {
+        OS_close(State->FileDesc);
+        State->FileDesc = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_PerfStreamCloseFile()                                      */
+/*                                                                               */
+/*  Purpose:                                                                     */
+/*    Local helper to close the current stream output file.  Rolling files are   */
+/*    regular files, so their headers are updated with the final entry count.   */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfStreamCloseFile(CFE_ES_PerfStreamGlobal_t *State)
+{
+    if (OS_ObjectIdDefined(State->FileDesc))
+    {
+        if (State->RollEntries != 0)
+        {
+            CFE_ES_PerfStreamWriteHeaders(State);
+        }
+
+        OS_close(State->FileDesc);
+        State->FileDesc = OS_OBJECT_ID_UNDEFINED;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_RunPerfLogStream()                                         */
+/*                                                                               */
+/*  Purpose:                                                                     */
+/*    Write performance data to a stream while it is being collected             */
+/*    This is implemented as a state machine that is invoked in the background   */
+/*    like CFE_ES_RunPerfLogDump(), but never locks the perf log data.           */
+/*                                                                               */
+/*    The two halves of the data buffer are used as a double buffer: once the    */
+/*    writers have moved on to the other half, the entries of the completed      */
+/*    half are written out while the other half is being filled.  If the         */
+/*    writers complete both halves before this, the oldest entries are           */
+/*    overwritten, and are counted as lost.                                      */
+/*                                                                               */
+/*    Each block of entries is copied to a staging buffer before it is written,  */
+/*    and the copy is only written if the writers had not moved back into the   */
+/*    half when it was complete, as the write to the output may be slow.         */
+/*                                                                               */
+/*  Arguments:                                                                   */
+/*    None                                                                       */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_PerfStreamGlobal_t *State = (CFE_ES_PerfStreamGlobal_t *)Arg;
+    int32               Status;
+    size_t              BlockSize;
+    uint32              Completed;
+    uint32              HalfBase;
+    uint32              HalfSize;
+    uint32              HalfEnd;
+    uint32              DataEnd;
+    uint32              NumEntries;
+
+    if (State->PendingState != CFE_ES_PerfStreamState_IDLE)
+    {
+        State->CurrentState = State->PendingState;
+        State->PendingState = CFE_ES_PerfStreamState_IDLE;
+    }
+
+    /*
+     * Accumulate work credit based on the elapsed time, as the dump does,
+     * where each credit allows one entry to be written.
+     */
+    State->WorkCredit +=
+            (ElapsedTime * CFE_PLATFORM_ES_PERF_STREAM_ENTRIES_BTWN_DLYS) / CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY;
+
+    if (State->WorkCredit > CFE_PLATFORM_ES_PERF_STREAM_ENTRIES_BTWN_DLYS)
+    {
+        State->WorkCredit = CFE_PLATFORM_ES_PERF_STREAM_ENTRIES_BTWN_DLYS;
+    }
+
+    while (State->WorkCredit > 0 && State->CurrentState != CFE_ES_PerfStreamState_IDLE)
+    {
+        --State->WorkCredit;
+
+        switch(State->CurrentState)
+        {
+        case CFE_ES_PerfStreamState_OPEN_FILE:
+            if (CFE_ES_PerfStreamOpenFile(State) == CFE_SUCCESS)
+            {
+                State->CurrentState = CFE_ES_PerfStreamState_WAIT_DATA;
+            }
+            else
+            {
+                /* end the stream, nothing more can be written */
+                Perf->MetaData.State = CFE_ES_PERF_IDLE;
+                State->CurrentState = CFE_ES_PerfStreamState_CLOSE_FILE;
+            }
+            break;
+
+        case CFE_ES_PerfStreamState_WAIT_DATA:
+            /*
+             * Once there is something to write, yield the CPU until the next
+             * iteration before writing, such that any writes to the buffer
+             * which were in progress at this time are finished.
+             */
+            Completed = CFE_ES_AtomicLoad32(&Perf->SwitchCount) - State->SwitchBase;
+            if (Completed != State->HalvesWritten || Perf->MetaData.State != CFE_ES_PERF_STREAMING)
+            {
+                State->CurrentState = CFE_ES_PerfStreamState_WRITE_ENTRIES;
+            }
+            State->WorkCredit = 0;
+            break;
+
+        case CFE_ES_PerfStreamState_WRITE_ENTRIES:
+            Completed = CFE_ES_AtomicLoad32(&Perf->SwitchCount) - State->SwitchBase;
+
+            /*
+             * If the writers have also completed the other half, the half being
+             * written is being overwritten.  Skip ahead to the most recently
+             * completed half, which is still intact.
+             */
+            while ((Completed - State->HalvesWritten) > 1)
+            {
+                if ((State->HalvesWritten & 1) == 0)
+                {
+                    State->LostEntries += CFE_ES_PERF_STREAM_HALF_SIZE - State->HalfPos;
+                }
+                else
+                {
+                    State->LostEntries += CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE -
+                            CFE_ES_PERF_STREAM_HALF_SIZE - State->HalfPos;
+                }
+                State->HalfPos = 0;
+                ++State->HalvesWritten;
+            }
+
+            if ((State->HalvesWritten & 1) == 0)
+            {
+                HalfBase = 0;
+                HalfSize = CFE_ES_PERF_STREAM_HALF_SIZE;
+            }
+            else
+            {
+                HalfBase = CFE_ES_PERF_STREAM_HALF_SIZE;
+                HalfSize = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - CFE_ES_PERF_STREAM_HALF_SIZE;
+            }
+
+            if (Completed != State->HalvesWritten)
+            {
+                HalfEnd = HalfSize;
+            }
+            else if (Perf->MetaData.State != CFE_ES_PERF_STREAMING)
+            {
+                /* Stopping - also write the part of the current half which was filled */
+                DataEnd = CFE_ES_AtomicLoad32(&Perf->MetaData.DataEnd);
+                if (DataEnd >= HalfBase && (DataEnd - HalfBase) < HalfSize)
+                {
+                    HalfEnd = DataEnd - HalfBase;
+                }
+                else
+                {
+                    HalfEnd = 0;
+                }
+            }
+            else
+            {
+                State->CurrentState = CFE_ES_PerfStreamState_WAIT_DATA;
+                break;
+            }
+
+            if (State->HalfPos >= HalfEnd)
+            {
+                if (Completed != State->HalvesWritten)
+                {
+                    /* continue with the other half */
+                    ++State->HalvesWritten;
+                    State->HalfPos = 0;
+                }
+                else
+                {
+                    /* stopping and everything was written */
+                    State->CurrentState = CFE_ES_PerfStreamState_CLOSE_FILE;
+                }
+                break;
+            }
+
+            if (State->RollEntries != 0 && State->FileEntries >= State->RollEntries)
+            {
+                State->CurrentState = CFE_ES_PerfStreamState_ROLL_FILE;
+                break;
+            }
+
+            /* Write as many entries as the credit allows in one block */
+            NumEntries = HalfEnd - State->HalfPos;
+            if (NumEntries > (State->WorkCredit + 1))
+            {
+                NumEntries = State->WorkCredit + 1;
+            }
+            if (State->RollEntries != 0 && NumEntries > (State->RollEntries - State->FileEntries))
+            {
+                NumEntries = State->RollEntries - State->FileEntries;
+            }
+            State->WorkCredit -= NumEntries - 1;
+
+            BlockSize = NumEntries * sizeof(CFE_ES_PerfDataEntry_t);
+            memcpy(State->StagingBuffer, &Perf->DataBuffer[HalfBase + State->HalfPos], BlockSize);
+
+            /*
+             * If a writer reserved an entry in this half while it was being
+             * copied, the copy may be partly overwritten.  Count the rest of
+             * the half as lost and continue with the other half.
+             */
+            if (Completed != State->HalvesWritten)
+            {
+                CFE_ES_AtomicFence();
+                Completed = CFE_ES_AtomicLoad32(&Perf->SwitchCount) - State->SwitchBase;
+                DataEnd = CFE_ES_AtomicLoad32(&Perf->MetaData.DataEnd);
+                if ((Completed - State->HalvesWritten) > 1 ||
+                        (DataEnd >= HalfBase && (DataEnd - HalfBase) < HalfSize))
+                {
+                    State->LostEntries += HalfSize - State->HalfPos;
+                    State->HalfPos = 0;
+                    ++State->HalvesWritten;
+                    break;
+                }
+            }
+
+            Status = OS_write(State->FileDesc, State->StagingBuffer, BlockSize);
+            if (Status != BlockSize)
+            {
+                CFE_ES_FileWriteByteCntErr(State->FileName, BlockSize, Status);
+
+                /* end the stream */
+                Perf->MetaData.State = CFE_ES_PERF_IDLE;
+                State->CurrentState = CFE_ES_PerfStreamState_CLOSE_FILE;
+                break;
+            }
+
+            State->HalfPos += NumEntries;
+            State->FileEntries += NumEntries;
+            State->TotalEntries += NumEntries;
+            break;
+
+        case CFE_ES_PerfStreamState_ROLL_FILE:
+            CFE_ES_PerfStreamCloseFile(State);
+            State->CurrentState = CFE_ES_PerfStreamState_OPEN_FILE;
+            break;
+
+        case CFE_ES_PerfStreamState_CLOSE_FILE:
+            CFE_ES_PerfStreamCloseFile(State);
+            CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_EID,CFE_EVS_EventType_DEBUG,
+                    "Perf stream to %s complete:Files=%lu,EntryCount=%lu,Lost=%lu",
+                    State->StreamName,
+                    (unsigned long)State->FileCount,
+                    (unsigned long)State->TotalEntries,
+                    (unsigned long)State->LostEntries);
+            State->CurrentState = CFE_ES_PerfStreamState_IDLE;
+            break;
+
+        default:
+            State->CurrentState = CFE_ES_PerfStreamState_IDLE;
+            break;
+        }
+    }
+
+    /*
+     * Return "true" if activity is ongoing, or "false" if not active
+     */
+    return (State->CurrentState != CFE_ES_PerfStreamState_IDLE);
+}/* end CFE_ES_RunPerfLogStream */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                               */
+/* CFE_ES_SetPerfFilterMaskCmd() --                                              */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_SetPerfFilterMaskCmd(const CFE_ES_SetPerfFilterMaskCmd_t *data)
+{
+    const CFE_ES_SetPerfFilterMaskCmd_Payload_t *cmd = &data->Payload;
+
+    if(cmd->FilterMaskNum < CFE_ES_PERF_32BIT_WORDS_IN_MASK ){
+
+        Perf->MetaData.FilterMask[cmd->FilterMaskNum] = cmd->FilterMask;
+
+        CFE_EVS_SendEvent(CFE_ES_PERF_FILTMSKCMD_EID, CFE_EVS_EventType_DEBUG,
+                "Set Performance Filter Mask Cmd rcvd, num %u, val 0x%08X",
+                (unsigned int)cmd->FilterMaskNum,(unsigned int)cmd->FilterMask);
+
+        CFE_ES_TaskData.CommandCounter++;
+    }else{
+        CFE_EVS_SendEvent(CFE_ES_PERF_FILTMSKERR_EID, CFE_EVS_EventType_ERROR,
+                "Performance Filter Mask Cmd Error,Index(%u)out of range(%u)",
+                (unsigned int)cmd->FilterMaskNum,(unsigned int)CFE_ES_PERF_32BIT_WORDS_IN_MASK);
+
+        CFE_ES_TaskData.CommandErrorCounter++;
+
+    }
+
+    return CFE_SUCCESS;
+} /* End of CFE_ES_SetPerfFilterMaskCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                               */
+/* CFE_ES_SetPerfTriggerMaskCmd() --                                             */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
+{
+    const CFE_ES_SetPerfTrigMaskCmd_Payload_t *cmd = &data->Payload;
+
+    if(cmd->TriggerMaskNum < CFE_ES_PERF_32BIT_WORDS_IN_MASK ){
+
+        Perf->MetaData.TriggerMask[cmd->TriggerMaskNum] = cmd->TriggerMask;
+
+        CFE_EVS_SendEvent(CFE_ES_PERF_TRIGMSKCMD_EID, CFE_EVS_EventType_DEBUG,
+                "Set Performance Trigger Mask Cmd rcvd,num %u, val 0x%08X",
+                (unsigned int)cmd->TriggerMaskNum,(unsigned int)cmd->TriggerMask);
+
+        CFE_ES_TaskData.CommandCounter++;
+
+    }else{
+        CFE_EVS_SendEvent(CFE_ES_PERF_TRIGMSKERR_EID, CFE_EVS_EventType_ERROR,
+                "Performance Trigger Mask Cmd Error,Index(%u)out of range(%u)",
+                (unsigned int)cmd->TriggerMaskNum,(unsigned int)CFE_ES_PERF_32BIT_WORDS_IN_MASK);
+
+        CFE_ES_TaskData.CommandErrorCounter++;
+    }
+
+    return CFE_SUCCESS;
+} /* End of CFE_ES_SetPerfTriggerMaskCmd() */
+
+
+#if (CFE_PLATFORM_ES_PERF_LOCKFREE == true) && CFE_ES_ATOMIC_AVAILABLE
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfLogAddLockFree                                               */
+/*                                                                               */
+/* Purpose: Local helper to store an entry without taking the perf data mutex    */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  Each writer reserves its slot by atomically advancing DataEnd, so writers    */
+/*  on different tasks or CPUs never wait for each other.  Entries are stored    */
+/*  in reservation order, so entries taken at nearly the same time by different  */
+/*  tasks may appear slightly out of timestamp order.                            */
+/*                                                                               */
+/*  The counters are only updated atomically, and the state transitions use      */
+/*  compare-exchange so a trigger is only acted on once.  The caller counts      */
+/*  itself in PerfActiveWriters while this runs, so that the commands which      */
+/*  reset the counters, and the dump, wait for it to finish.                     */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfLogAddLockFree(uint32 Marker, const CFE_ES_PerfDataEntry_t *EntryPtr)
+{
+    uint32 *StatePtr = (uint32 *)&Perf->MetaData.State;
+    uint32 DataEnd;
+    uint32 NextEnd;
+    uint32 DataCount;
+    uint32 TriggerCount;
+    uint32 ExpectedState;
+
+    /* reserve the next perflog slot */
+    DataEnd = CFE_ES_AtomicLoad32(&Perf->MetaData.DataEnd);
+    do
+    {
+        NextEnd = DataEnd + 1;
+        if (NextEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+        {
+            NextEnd = 0;
+        }
+    }
+    while (!CFE_ES_AtomicCompareExchange32(&Perf->MetaData.DataEnd, &DataEnd, NextEnd));
+
+    Perf->DataBuffer[DataEnd] = *EntryPtr;
+
+    /* let the perf data stream know when a buffer half is complete */
+    if (NextEnd == 0 || NextEnd == CFE_ES_PERF_STREAM_HALF_SIZE)
+    {
+        CFE_ES_AtomicAdd32(&Perf->SwitchCount, 1);
+    }
+
+    /* count the entry, until the buffer is full */
+    DataCount = CFE_ES_AtomicLoad32(&Perf->MetaData.DataCount);
+    while (DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE &&
+            !CFE_ES_AtomicCompareExchange32(&Perf->MetaData.DataCount, &DataCount, DataCount + 1))
+    {
+        /* DataCount was updated by the failed exchange, retry */
+    }
+
+    if (DataCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    {
+        /* overwriting old data, the oldest entry is the one after this one */
+        CFE_ES_AtomicStore32(&Perf->MetaData.DataStart, NextEnd);
+    }
+
+    /* waiting for trigger */
+    if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
+    {
+        ExpectedState = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+        CFE_ES_AtomicCompareExchange32(StatePtr, &ExpectedState, CFE_ES_PERF_TRIGGERED);
+    }
+
+    /* triggered */
+    if (CFE_ES_AtomicLoad32(StatePtr) == CFE_ES_PERF_TRIGGERED)
+    {
+        TriggerCount = CFE_ES_AtomicAdd32(&Perf->MetaData.TriggerCount, 1);
+        if ((Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_START &&
+                TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) ||
+            (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_CENTER &&
+                TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2) ||
+            Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_END)
+        {
+            ExpectedState = CFE_ES_PERF_TRIGGERED;
+            CFE_ES_AtomicCompareExchange32(StatePtr, &ExpectedState, CFE_ES_PERF_IDLE);
+        }
+    }
+}
+#endif
+
+#if (CFE_PLATFORM_ES_PERF_MARKER_STATS == true)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfUpdateMarkerStats                                            */
+/*                                                                               */
+/* Purpose: Local helper to update the statistics of a marker on entry or exit   */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  A duration is measured from an entry to the next exit of the same marker by  */
+/*  the same task, so a marker may be nested, or used by several tasks at the    */
+/*  same time.  Calls from outside of an OSAL task are not measured.             */
+/*                                                                               */
+/*  The statistics of the marker are shared by all tasks, and are updated with   */
+/*  atomic operations.  If the compiler does not provide these, the ES shared    */
+/*  data lock is taken instead.  The count is updated last, so the reader of     */
+/*  the statistics does not report a duration before it is complete.            */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfUpdateMarkerStats(uint32 Marker, uint32 EntryExit, const CFE_ES_PerfDataEntry_t *EntryPtr)
+{
+    CFE_ES_PerfMarkerRecord_t *MarkerRecPtr;
+    CFE_ES_PerfTaskEntries_t *TaskEntriesPtr;
+    osal_id_t TaskId;
+    osal_index_t TaskIndex;
+    uint64 Ticks;
+    uint64 EntryTicks;
+    uint32 Duration;
+    uint32 Current;
+    uint32 Bin;
+    uint32 i;
+
+    TaskId = OS_TaskGetId();
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, TaskId, &TaskIndex) != OS_SUCCESS ||
+            TaskIndex >= OS_MAX_TASKS)
+    {
+        return;
+    }
+
+    TaskEntriesPtr = &CFE_ES_Global.PerfTaskEntries[TaskIndex];
+    if (!OS_ObjectIdEqual(TaskEntriesPtr->TaskId, TaskId))
+    {
+        /* any pending entries were left by a previous task at this index */
+        TaskEntriesPtr->TaskId = TaskId;
+        TaskEntriesPtr->Depth = 0;
+    }
+
+    Ticks = CFE_ES_PerfEntryTicks(EntryPtr);
+
+    if (EntryExit == 0)
+    {
+        if (TaskEntriesPtr->Depth < CFE_ES_PERF_STATS_MAX_NESTING)
+        {
+            TaskEntriesPtr->Marker[TaskEntriesPtr->Depth] = Marker;
+            TaskEntriesPtr->EntryTicks[TaskEntriesPtr->Depth] = Ticks;
+            ++TaskEntriesPtr->Depth;
+        }
+        return;
+    }
+
+    /* find the latest pending entry of the marker, an exit without an entry has no duration */
+    i = TaskEntriesPtr->Depth;
+    while (i > 0 && TaskEntriesPtr->Marker[i - 1] != Marker)
+    {
+        --i;
+    }
+    if (i == 0)
+    {
+        return;
+    }
+    --i;
+    EntryTicks = TaskEntriesPtr->EntryTicks[i];
+
+    /* remove it, keeping any later entries which are still pending */
+    --TaskEntriesPtr->Depth;
+    while (i < TaskEntriesPtr->Depth)
+    {
+        TaskEntriesPtr->Marker[i] = TaskEntriesPtr->Marker[i + 1];
+        TaskEntriesPtr->EntryTicks[i] = TaskEntriesPtr->EntryTicks[i + 1];
+        ++i;
+    }
+
+    if (Ticks <= EntryTicks)
+    {
+        Duration = 0;
+    }
+    else if ((Ticks - EntryTicks) > 0xFFFFFFFF)
+    {
+        Duration = 0xFFFFFFFF;
+    }
+    else
+    {
+        Duration = (uint32)(Ticks - EntryTicks);
+    }
+
+    MarkerRecPtr = &CFE_ES_Global.PerfMarkerTable[Marker];
+
+#if !CFE_ES_ATOMIC_AVAILABLE
+    CFE_ES_LockSharedData(__func__,__LINE__);
+#endif
+
+    Current = CFE_ES_AtomicLoad32(&MarkerRecPtr->MinDuration);
+    while (Duration < Current &&
+            !CFE_ES_AtomicCompareExchange32(&MarkerRecPtr->MinDuration, &Current, Duration))
+    {
+        /* Current was updated by the failed exchange, retry */
+    }
+    Current = CFE_ES_AtomicLoad32(&MarkerRecPtr->MaxDuration);
+    while (Duration > Current &&
+            !CFE_ES_AtomicCompareExchange32(&MarkerRecPtr->MaxDuration, &Current, Duration))
+    {
+        /* Current was updated by the failed exchange, retry */
+    }
+    CFE_ES_AtomicAdd64(&MarkerRecPtr->TotalDuration, Duration);
+
+    /* histogram bin is the position of the highest bit set */
+    Bin = 0;
+    if (Duration >= 0x10000)
+    {
+        Bin += 16;
+        Duration >>= 16;
+    }
+    if (Duration >= 0x100)
+    {
+        Bin += 8;
+        Duration >>= 8;
+    }
+    if (Duration >= 0x10)
+    {
+        Bin += 4;
+        Duration >>= 4;
+    }
+    if (Duration >= 0x4)
+    {
+        Bin += 2;
+        Duration >>= 2;
+    }
+    if (Duration >= 0x2)
+    {
+        Bin += 1;
+    }
+    CFE_ES_AtomicAdd32(&MarkerRecPtr->Histogram[Bin], 1);
+
+    CFE_ES_AtomicAdd32(&MarkerRecPtr->Count, 1);
+
+#if !CFE_ES_ATOMIC_AVAILABLE
+    CFE_ES_UnlockSharedData(__func__,__LINE__);
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_SendPerfStats                                                    */
+/*                                                                               */
+/* Purpose: This function sends the statistics of the next markers which have    */
+/*          any, in the performance marker statistics telemetry packet.          */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  Markers are reported in turn, up to CFE_MISSION_ES_PERF_STATS_MAX_MARKERS    */
+/*  each time.  Nothing is sent if no marker has any statistics.                 */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_SendPerfStats(void)
+{
+    CFE_ES_PerfStatsTlm_Payload_t *PayloadPtr;
+    CFE_ES_PerfMarkerRecord_t *MarkerRecPtr;
+    CFE_ES_PerfMarkerStats_t *StatsPtr;
+    uint32 Marker;
+    uint32 Checked;
+    uint32 Count;
+    uint32 Bin;
+
+    PayloadPtr = &CFE_ES_TaskData.PerfStatsPacket.Payload;
+    memset(PayloadPtr, 0, sizeof(*PayloadPtr));
+    PayloadPtr->TimerTicksPerSecond = Perf->MetaData.TimerTicksPerSecond;
+
+    Marker = CFE_ES_TaskData.PerfStatsNextMarker;
+
+    CFE_ES_LockSharedData(__func__,__LINE__);
+
+    for (Checked = 0; Checked < CFE_MISSION_ES_PERF_MAX_IDS &&
+            PayloadPtr->NumMarkers < CFE_MISSION_ES_PERF_STATS_MAX_MARKERS; ++Checked)
+    {
+        if (Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
+        {
+            Marker = 0;
+        }
+
+        /*
+         * The statistics may be updated while they are read, so the values
+         * can be from slightly different counts, but each value is whole
+         */
+        MarkerRecPtr = &CFE_ES_Global.PerfMarkerTable[Marker];
+        Count = CFE_ES_AtomicLoad32(&MarkerRecPtr->Count);
+        if (Count != 0)
+        {
+            StatsPtr = &PayloadPtr->MarkerStats[PayloadPtr->NumMarkers];
+            ++PayloadPtr->NumMarkers;
+
+            StatsPtr->MarkerId = Marker;
+            strncpy(StatsPtr->Name, MarkerRecPtr->Name, sizeof(StatsPtr->Name) - 1);
+            StatsPtr->Count = Count;
+            StatsPtr->MinDuration = CFE_ES_AtomicLoad32(&MarkerRecPtr->MinDuration);
+            StatsPtr->MaxDuration = CFE_ES_AtomicLoad32(&MarkerRecPtr->MaxDuration);
+            StatsPtr->MeanDuration = (uint32)(CFE_ES_AtomicLoad64(&MarkerRecPtr->TotalDuration) / Count);
+            for (Bin = 0; Bin < CFE_ES_PERF_STATS_HISTOGRAM_BINS; ++Bin)
+            {
+                StatsPtr->Histogram[Bin] = CFE_ES_AtomicLoad32(&MarkerRecPtr->Histogram[Bin]);
+            }
+        }
+
+        ++Marker;
+    }
+
+    CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+    CFE_ES_TaskData.PerfStatsNextMarker = Marker;
+
+    if (PayloadPtr->NumMarkers != 0)
+    {
+        CFE_SB_TimeStampMsg(&CFE_ES_TaskData.PerfStatsPacket.TlmHeader.Msg);
+        CFE_SB_TransmitMsg(&CFE_ES_TaskData.PerfStatsPacket.TlmHeader.Msg, true);
+    }
+} /* end CFE_ES_SendPerfStats */
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfRegisterMarker                                               */
+/*                                                                               */
+/* Purpose: This function registers a name for a performance marker.             */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  The name is used in trace files, so characters that would need escaping      */
+/*  in JSON strings are not accepted.                                            */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_PerfRegisterMarker(uint32 Marker, const char *MarkerName)
+{
+    CFE_ES_PerfMarkerRecord_t *MarkerRecPtr;
+    const char *CharPtr;
+
+    if (Marker >= CFE_MISSION_ES_PERF_MAX_IDS || MarkerName == NULL || MarkerName[0] == 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    MarkerRecPtr = &CFE_ES_Global.PerfMarkerTable[Marker];
+
+    if (strlen(MarkerName) >= sizeof(MarkerRecPtr->Name))
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    for (CharPtr = MarkerName; *CharPtr != 0; ++CharPtr)
+    {
+        if (*CharPtr == '"' || *CharPtr == '\\' || (unsigned char)*CharPtr < ' ')
+        {
+            return CFE_ES_BAD_ARGUMENT;
+        }
+    }
+
+    CFE_ES_LockSharedData(__func__,__LINE__);
+    strncpy(MarkerRecPtr->Name, MarkerName, sizeof(MarkerRecPtr->Name) - 1);
+    MarkerRecPtr->Name[sizeof(MarkerRecPtr->Name) - 1] = '\0';
+    CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+    return CFE_SUCCESS;
+} /* end CFE_ES_PerfRegisterMarker */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfLogAdd                                                       */
+/*                                                                               */
+/* Purpose: This function adds a new entry to the data buffer.                   */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  This function implements a circular buffer using an array.                   */
+/*      DataStart points to first stored entry                                   */
+/*      DataEnd points to next available entry                                   */
+/*      if DataStart == DataEnd then the buffer is either empty or full          */
+/*      depending on the value of the DataCount                                  */
+/*                                                                               */
+/*  Time is stored as 2 32 bit integers, (TimerLower32, TimerUpper32):           */
+/*      TimerLower32 is the curent value of the hardware timer register.         */
+/*      TimerUpper32 is the number of times the timer has rolled over.           */
+/*                                                                               */
+/*  Time is stored as a absolute time instead of a relative time between log     */
+/*  entries. This will yield better accuracy since storing relative time between */
+/*  entries will accumulate (rounding/sampling) errors over time.  It also is    */
+/*  faster since the time does not need to be calculated.                        */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
+{
+    CFE_ES_PerfDataEntry_t EntryData;
+#if (CFE_PLATFORM_ES_PERF_LOCKFREE != true) || !CFE_ES_ATOMIC_AVAILABLE
+    uint32 DataEnd;
+#endif
+
+#if (CFE_PLATFORM_ES_PERF_MARKER_STATS == true)
+    /*
+     * The marker statistics are kept whatever the perf log state and
+     * filter mask are, and the timestamp is also used for the log entry
+     */
+    CFE_ES_PerfReadTimer(&EntryData);
+    if (Marker < CFE_MISSION_ES_PERF_MAX_IDS)
+    {
+        CFE_ES_PerfUpdateMarkerStats(Marker, EntryExit, &EntryData);
+    }
+#endif
+
+    /*
+     * If the global state is idle, exit immediately without locking or doing anything
+     */
+    if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
+    {
+        return;
+    }
+
+    /* if marker is out of range... */
+    if (Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
+    {
+        /* if marker has not been reported previously ... */
+        if (Perf->MetaData.InvalidMarkerReported == false)
+        {
+            CFE_ES_WriteToSysLog("ES PERF:Invalid performance marker %d,max is %d\n", (unsigned int)Marker,
+                                 (CFE_MISSION_ES_PERF_MAX_IDS - 1));
+            Perf->MetaData.InvalidMarkerReported = true;
+        } /* end if */
+
+        return;
+    } /* end if */
 
     /*
      * check if this ID is filtered.
@@ -620,8 +1784,22 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
      * just in case the locking operation incurs a delay
      */
     EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
-    CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
+#if (CFE_PLATFORM_ES_PERF_MARKER_STATS != true)
+    CFE_ES_PerfReadTimer(&EntryData);
+#endif
 
+#if (CFE_PLATFORM_ES_PERF_LOCKFREE == true) && CFE_ES_ATOMIC_AVAILABLE
+    /*
+     * Register as an active writer before confirming that the global is
+     * still non-idle, so a reset of the log waits for this entry
+     */
+    CFE_ES_AtomicAdd32(&CFE_ES_Global.PerfActiveWriters, 1);
+    if (CFE_ES_AtomicLoad32((uint32 *)&Perf->MetaData.State) != CFE_ES_PERF_IDLE)
+    {
+        CFE_ES_PerfLogAddLockFree(Marker, &EntryData);
+    }
+    CFE_ES_AtomicAdd32(&CFE_ES_Global.PerfActiveWriters, (uint32)-1);
+#else
     /*
      * Acquire the perflog mutex before writing into the shared area.
      * Note this lock is held for long periods while a background dump
@@ -647,6 +1825,12 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
         }
         Perf->MetaData.DataEnd = DataEnd;
 
+        /* let the perf data stream know when a buffer half is complete */
+        if (DataEnd == 0 || DataEnd == CFE_ES_PERF_STREAM_HALF_SIZE)
+        {
+            ++Perf->SwitchCount;
+        }
+
         /* we have filled up the buffer */
         if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
         {
@@ -694,6 +1878,7 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     }
 
     OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+#endif
 
 } /* end CFE_ES_PerfLogAdd */
 
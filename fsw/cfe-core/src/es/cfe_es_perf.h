@@ -45,6 +45,7 @@
 #include "cfe_evs.h"
 #include "cfe_perfids.h"
 #include "cfe_psp.h"
+#include "private/cfe_es_perfdata_typedef.h"
 
 /*
 **  Defines
@@ -54,6 +55,7 @@ enum CFE_ES_PerfState_t {
     CFE_ES_PERF_IDLE = 0,
     CFE_ES_PERF_WAITING_FOR_TRIGGER,
     CFE_ES_PERF_TRIGGERED,
+    CFE_ES_PERF_STREAMING,
     CFE_ES_PERF_MAX_STATES
 };
 
@@ -64,6 +66,59 @@ enum CFE_ES_PerfMode_t {
     CFE_ES_PERF_MAX_MODES
 };
 
+/*
+ * Performance marker registry record
+ *
+ * Holds the name registered for a performance marker ID via
+ * CFE_ES_PerfRegisterMarker(), which is used when the performance
+ * log is written as a trace.  An empty name means not registered.
+ *
+ * When CFE_PLATFORM_ES_PERF_MARKER_STATS is enabled, this also holds the
+ * duration statistics of the marker, which are kept for every marker
+ * whether or not a name is registered.  Durations are in timer ticks.
+ * The statistics are updated by any task, with atomic operations.
+ */
+typedef struct
+{
+    char   Name[OS_MAX_API_NAME];
+
+    uint32 Count;                       /* Number of durations measured */
+    uint32 MinDuration;
+    uint32 MaxDuration;
+    uint64 TotalDuration;               /* Sum of all durations, for the mean */
+    uint32 Histogram[CFE_ES_PERF_STATS_HISTOGRAM_BINS];
+} CFE_ES_PerfMarkerRecord_t;
+
+/*
+ * Maximum number of marker entries that one task can have pending, for
+ * the marker statistics.  Entries nested deeper than this are not measured.
+ */
+#define CFE_ES_PERF_STATS_MAX_NESTING   8
+
+/*
+ * Pending marker entries of a task, for the marker statistics
+ *
+ * A duration is measured from an entry to the next exit of the same marker
+ * by the same task.  Each record is indexed by the OSAL task index, and is
+ * only used by that task, so it is not locked.
+ */
+typedef struct
+{
+    osal_id_t TaskId;                                       /* Task the entries belong to */
+    uint32    Depth;                                        /* Number of pending entries */
+    uint32    Marker[CFE_ES_PERF_STATS_MAX_NESTING];        /* Marker of each pending entry */
+    uint64    EntryTicks[CFE_ES_PERF_STATS_MAX_NESTING];    /* Timestamp of each pending entry */
+} CFE_ES_PerfTaskEntries_t;
+
+/*
+ * Perflog Dump output file formats
+ */
+typedef enum
+{
+    CFE_ES_PerfDumpFormat_BINARY,       /* CFE FS header, metadata and raw entries */
+    CFE_ES_PerfDumpFormat_TRACE         /* Chrome trace event JSON */
+} CFE_ES_PerfDumpFormat_t;
+
 /*
  * Perflog Dump Background Job states
  *
@@ -108,6 +163,7 @@ typedef struct
 {
     CFE_ES_PerfDumpState_t  CurrentState;   /* the current state of the job */
     CFE_ES_PerfDumpState_t  PendingState;   /* the pending/next state, if transitioning */
+    CFE_ES_PerfDumpFormat_t Format;         /* the output file format */
 
     char                DataFileName[OS_MAX_PATH_LEN];  /* output file name from dump command */
     osal_id_t           FileDesc;                       /* file descriptor for writing */
@@ -115,8 +171,68 @@ typedef struct
     uint32              StateCounter;                   /* number of blocks/items left in current state */
     uint32              DataPos;                        /* last position within the Perf Log */
     size_t              FileSize;                       /* Total file size, for progress reporing in telemetry */
+    uint32              TraceEvents;                    /* number of events written, in trace format */
 } CFE_ES_PerfDumpGlobal_t;
 
+/*
+ * The maximum time, in milliseconds, to wait for lock-free writers which are
+ * adding an entry to finish, before the perf log is reset or read.  Writers
+ * only take a few instructions, so this is only reached if a writer task was
+ * deleted while adding an entry.
+ */
+#define CFE_ES_PERF_WRITER_WAIT_LIMIT   100
+
+/*
+ * The performance data stream treats the two halves of the perf log
+ * data buffer as a double buffer: it writes out one half while the
+ * other half is being filled, without locking out the writers.
+ */
+#define CFE_ES_PERF_STREAM_HALF_SIZE    (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
+
+/*
+ * Perflog Stream Background Job states
+ */
+typedef enum
+{
+    CFE_ES_PerfStreamState_IDLE,                /* No stream active */
+    CFE_ES_PerfStreamState_OPEN_FILE,           /* Opening of the next output file, and writing its headers */
+    CFE_ES_PerfStreamState_WAIT_DATA,           /* Wait for a buffer half to be filled, or the stream to be stopped */
+    CFE_ES_PerfStreamState_WRITE_ENTRIES,       /* Write the Perf Log entries (throttled) */
+    CFE_ES_PerfStreamState_ROLL_FILE,           /* Closing of an output file which is full */
+    CFE_ES_PerfStreamState_CLOSE_FILE           /* Closing of the last output file */
+} CFE_ES_PerfStreamState_t;
+
+/*
+ * Performance log stream state structure
+ *
+ * The first state transition (IDLE->OPEN_FILE) is triggered via ES command,
+ * where the command processor sets the PendingState.  After this the structure
+ * is owned by the background task until it is back to IDLE.
+ *
+ * The stream is stopped by setting the perf log state to anything other
+ * than CFE_ES_PERF_STREAMING.  The background task then writes out the
+ * remaining entries before closing the output.
+ */
+typedef struct
+{
+    CFE_ES_PerfStreamState_t  CurrentState;     /* the current state of the job */
+    CFE_ES_PerfStreamState_t  PendingState;     /* the requested state, set by command */
+
+    char                StreamName[OS_MAX_PATH_LEN];    /* output name from stream command */
+    char                FileName[OS_MAX_PATH_LEN];      /* name of the current output file */
+    osal_id_t           FileDesc;                       /* file descriptor for writing */
+    uint32              WorkCredit;                     /* accumulator based on the passage of time */
+    uint32              RollEntries;                    /* entries per output file, 0 for a single output */
+    uint32              SwitchBase;                     /* perf log SwitchCount when the stream started */
+    uint32              HalvesWritten;                  /* number of buffer halves completely written */
+    uint32              HalfPos;                        /* entries written from the current buffer half */
+    uint32              FileCount;                      /* number of output files opened */
+    uint32              FileEntries;                    /* entries written to the current output file */
+    uint32              TotalEntries;                   /* entries written to all output files */
+    uint32              LostEntries;                    /* entries overwritten before being written */
+    CFE_ES_PerfDataEntry_t StagingBuffer[CFE_PLATFORM_ES_PERF_STREAM_ENTRIES_BTWN_DLYS]; /* entries being written */
+} CFE_ES_PerfStreamGlobal_t;
+
 /*
  * Helper function to obtain the progress/remaining items from
  * the background task that is writing the performance log data
@@ -137,5 +253,32 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void);
  */
 bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg);
 
+/*
+ * Implementation of the background state machine for streaming
+ * performance log data.
+ */
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg);
+
+#if (CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS == true)
+/*
+ * Reads the high resolution timestamp and the number of the calling CPU
+ * into a perf log entry
+ */
+void CFE_ES_PerfGetTimestamp(CFE_ES_PerfDataEntry_t *EntryPtr);
+
+/*
+ * Selects the source of the high resolution timestamps, and gets their
+ * ticks per second and lower 32 bit rollover value for the perf metadata.
+ * This must be called at startup, before any timestamp is read.
+ */
+void CFE_ES_PerfGetTimestampInfo(uint32 *TicksPerSecondPtr, uint32 *Low32RolloverPtr);
+#endif
+
+/*
+ * Sends the statistics of the next performance markers which have any,
+ * as part of the ES housekeeping telemetry.
+ */
+void CFE_ES_SendPerfStats(void);
+
 #endif /* _cfe_es_perf_ */
 
@@ -0,0 +1,102 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File: cfe_es_perf_timebase.c
+**
+** Purpose: This file contains the high resolution timestamp source for the
+**  performance log entries, used when CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS
+**  is enabled.
+**
+**  The timestamp is read from the PSP high resolution timebase, which counts
+**  nanoseconds from a monotonic clock, and the CPU number is read from the
+**  PSP.  If the PSP does not implement the high resolution timebase, the
+**  regular PSP timebase is used, and if it does not implement the CPU number,
+**  CPU 0 is recorded.
+**
+*/
+
+/*
+** Include Section
+*/
+
+#include "cfe_es_perf.h"
+
+#if (CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS == true)
+
+/*
+** Whether the PSP high resolution timebase is used, selected at startup
+*/
+static bool CFE_ES_PerfUseHighResTimebase;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfGetTimestamp                                                 */
+/*                                                                               */
+/* Purpose: Reads the timestamp and CPU number for a performance log entry       */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_PerfGetTimestamp(CFE_ES_PerfDataEntry_t *EntryPtr)
+{
+    uint32 CpuNumber;
+
+    if (CFE_ES_PerfUseHighResTimebase)
+    {
+        CFE_PSP_GetHighResTimebase(&EntryPtr->TimerUpper32, &EntryPtr->TimerLower32);
+    }
+    else
+    {
+        CFE_PSP_Get_Timebase(&EntryPtr->TimerUpper32, &EntryPtr->TimerLower32);
+    }
+
+    if (CFE_PSP_GetCpuNumber(&CpuNumber) != CFE_PSP_SUCCESS)
+    {
+        CpuNumber = 0;
+    }
+    EntryPtr->CpuId = CpuNumber;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfGetTimestampInfo                                             */
+/*                                                                               */
+/* Purpose: Selects the timestamp source, and gets its resolution for the perf   */
+/*          metadata.  The lower 32 bits of the high resolution timebase roll    */
+/*          over into the upper 32 bits at 2^32 (0).                             */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_PerfGetTimestampInfo(uint32 *TicksPerSecondPtr, uint32 *Low32RolloverPtr)
+{
+    uint32 Upper32;
+    uint32 Lower32;
+
+    CFE_ES_PerfUseHighResTimebase = (CFE_PSP_GetHighResTimebase(&Upper32, &Lower32) == CFE_PSP_SUCCESS);
+
+    if (CFE_ES_PerfUseHighResTimebase)
+    {
+        *TicksPerSecondPtr = 1000000000;
+        *Low32RolloverPtr = 0;
+    }
+    else
+    {
+        *TicksPerSecondPtr = CFE_PSP_GetTimerTicksPerSecond();
+        *Low32RolloverPtr = CFE_PSP_GetTimerLow32Rollover();
+    }
+}
+
+#endif /* CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS */
@@ -76,6 +76,48 @@ CFE_ES_TaskId_t CFE_ES_TaskId_FromOSAL(osal_id_t id)
     return CFE_ES_TASKID_C(Result);
 }
 
+/*********************************************************************/
+/*
+ * CFE_ES_AppRecordNameMatch
+ *
+ * Local helper to check an app table entry against a name, for the name index
+ */
+static bool CFE_ES_AppRecordNameMatch(uint32 Idx, const char *Name)
+{
+    const CFE_ES_AppRecord_t *AppRecPtr = &CFE_ES_Global.AppTable[Idx];
+
+    return (CFE_ES_AppRecordIsUsed(AppRecPtr) &&
+            strcmp(Name, CFE_ES_AppRecordGetName(AppRecPtr)) == 0);
+}
+
+/*********************************************************************/
+/*
+ * CFE_ES_LibRecordNameMatch
+ *
+ * Local helper to check a library table entry against a name, for the name index
+ */
+static bool CFE_ES_LibRecordNameMatch(uint32 Idx, const char *Name)
+{
+    const CFE_ES_LibRecord_t *LibRecPtr = &CFE_ES_Global.LibTable[Idx];
+
+    return (CFE_ES_LibRecordIsUsed(LibRecPtr) &&
+            strcmp(Name, CFE_ES_LibRecordGetName(LibRecPtr)) == 0);
+}
+
+/*********************************************************************/
+/*
+ * CFE_ES_CounterRecordNameMatch
+ *
+ * Local helper to check a counter table entry against a name, for the name index
+ */
+static bool CFE_ES_CounterRecordNameMatch(uint32 Idx, const char *Name)
+{
+    const CFE_ES_GenCounterRecord_t *CounterRecPtr = &CFE_ES_Global.CounterTable[Idx];
+
+    return (CFE_ES_CounterRecordIsUsed(CounterRecPtr) &&
+            strcmp(Name, CFE_ES_CounterRecordGetName(CounterRecPtr)) == 0);
+}
+
 /*********************************************************************/
 /*
  * CFE_ES_LocateAppRecordByName
@@ -84,32 +126,18 @@ CFE_ES_TaskId_t CFE_ES_TaskId_FromOSAL(osal_id_t id)
  */
 CFE_ES_AppRecord_t *CFE_ES_LocateAppRecordByName(const char *Name)
 {
-   CFE_ES_AppRecord_t *AppRecPtr;
-   uint32 Count;
+   uint32 Idx;
 
    /*
-   ** Search the Application table for an app with a matching name.
+   ** Search the name index of the Application table for an app with a matching name.
    */
-   AppRecPtr = CFE_ES_Global.AppTable;
-   Count = CFE_PLATFORM_ES_MAX_APPLICATIONS;
-   while ( true )
+   if (CFE_ResourceId_NameIndexFind(CFE_ES_Global.AppNameIndex, CFE_PLATFORM_ES_MAX_APPLICATIONS,
+           Name, CFE_ES_AppRecordNameMatch, &Idx) != CFE_SUCCESS)
    {
-       if ( Count == 0 )
-       {
-           AppRecPtr = NULL;
-           break;
-       }
-       if ( CFE_ES_AppRecordIsUsed(AppRecPtr) &&
-               strcmp(Name, CFE_ES_AppRecordGetName(AppRecPtr)) == 0 )
-       {
-           break;
-       }
-
-      ++AppRecPtr;
-      --Count;
+       return NULL;
    }
 
-   return AppRecPtr;
+   return &CFE_ES_Global.AppTable[Idx];
 
 } /* End of CFE_ES_LocateAppRecordByName() */
 
@@ -121,32 +149,18 @@ CFE_ES_AppRecord_t *CFE_ES_LocateAppRecordByName(const char *Name)
  */
 CFE_ES_LibRecord_t *CFE_ES_LocateLibRecordByName(const char *Name)
 {
-   CFE_ES_LibRecord_t *LibRecPtr;
-   uint32 Count;
+   uint32 Idx;
 
    /*
-   ** Search the Library table for a library with a matching name.
+   ** Search the name index of the Library table for a library with a matching name.
    */
-   LibRecPtr = CFE_ES_Global.LibTable;
-   Count = CFE_PLATFORM_ES_MAX_LIBRARIES;
-   while ( true )
+   if (CFE_ResourceId_NameIndexFind(CFE_ES_Global.LibNameIndex, CFE_PLATFORM_ES_MAX_LIBRARIES,
+           Name, CFE_ES_LibRecordNameMatch, &Idx) != CFE_SUCCESS)
    {
-       if ( Count == 0 )
-       {
-           LibRecPtr = NULL;
-           break;
-       }
-       if ( CFE_ES_LibRecordIsUsed(LibRecPtr) &&
-               strcmp(Name, CFE_ES_LibRecordGetName(LibRecPtr)) == 0 )
-       {
-           break;
-       }
-
-      ++LibRecPtr;
-      --Count;
+       return NULL;
    }
 
-   return LibRecPtr;
+   return &CFE_ES_Global.LibTable[Idx];
 
 } /* End of CFE_ES_LocateLibRecordByName() */
 
@@ -159,32 +173,64 @@ CFE_ES_LibRecord_t *CFE_ES_LocateLibRecordByName(const char *Name)
  */
 CFE_ES_GenCounterRecord_t *CFE_ES_LocateCounterRecordByName(const char *Name)
 {
-    CFE_ES_GenCounterRecord_t *CounterRecPtr;
-    uint32 Count;
+    uint32 Idx;
 
     /*
-    ** Search the Counter table for a matching name.
+    ** Search the name index of the Counter table for a matching name.
     */
-    CounterRecPtr = CFE_ES_Global.CounterTable;
-    Count = CFE_PLATFORM_ES_MAX_GEN_COUNTERS;
-    while ( true )
+    if (CFE_ResourceId_NameIndexFind(CFE_ES_Global.CounterNameIndex, CFE_PLATFORM_ES_MAX_GEN_COUNTERS,
+            Name, CFE_ES_CounterRecordNameMatch, &Idx) != CFE_SUCCESS)
     {
-        if ( Count == 0 )
-        {
-            CounterRecPtr = NULL;
-            break;
-        }
-        if ( CFE_ES_CounterRecordIsUsed(CounterRecPtr) &&
-                strcmp(Name, CFE_ES_CounterRecordGetName(CounterRecPtr)) == 0 )
-        {
-            break;
-        }
-
-       ++CounterRecPtr;
-       --Count;
+        return NULL;
     }
 
-    return CounterRecPtr;
+    return &CFE_ES_Global.CounterTable[Idx];
+}
+
+/*********************************************************************/
+/*
+ * CFE_ES_AppRecordSetName
+ *
+ * For complete API information, see prototype in header
+ */
+void CFE_ES_AppRecordSetName(CFE_ES_AppRecord_t *AppRecPtr, const char *Name)
+{
+    strncpy(AppRecPtr->StartParams.BasicInfo.Name, Name,
+            sizeof(AppRecPtr->StartParams.BasicInfo.Name)-1);
+    AppRecPtr->StartParams.BasicInfo.Name[sizeof(AppRecPtr->StartParams.BasicInfo.Name)-1] = '\0';
+
+    CFE_ResourceId_NameIndexAdd(CFE_ES_Global.AppNameIndex, CFE_PLATFORM_ES_MAX_APPLICATIONS,
+            AppRecPtr - CFE_ES_Global.AppTable, AppRecPtr->StartParams.BasicInfo.Name);
+}
+
+/*********************************************************************/
+/*
+ * CFE_ES_LibRecordSetName
+ *
+ * For complete API information, see prototype in header
+ */
+void CFE_ES_LibRecordSetName(CFE_ES_LibRecord_t *LibRecPtr, const char *Name)
+{
+    strncpy(LibRecPtr->BasicInfo.Name, Name, sizeof(LibRecPtr->BasicInfo.Name)-1);
+    LibRecPtr->BasicInfo.Name[sizeof(LibRecPtr->BasicInfo.Name)-1] = '\0';
+
+    CFE_ResourceId_NameIndexAdd(CFE_ES_Global.LibNameIndex, CFE_PLATFORM_ES_MAX_LIBRARIES,
+            LibRecPtr - CFE_ES_Global.LibTable, LibRecPtr->BasicInfo.Name);
+}
+
+/*********************************************************************/
+/*
+ * CFE_ES_CounterRecordSetName
+ *
+ * For complete API information, see prototype in header
+ */
+void CFE_ES_CounterRecordSetName(CFE_ES_GenCounterRecord_t *CounterRecPtr, const char *Name)
+{
+    strncpy(CounterRecPtr->CounterName, Name, sizeof(CounterRecPtr->CounterName)-1);
+    CounterRecPtr->CounterName[sizeof(CounterRecPtr->CounterName)-1] = '\0';
+
+    CFE_ResourceId_NameIndexAdd(CFE_ES_Global.CounterNameIndex, CFE_PLATFORM_ES_MAX_GEN_COUNTERS,
+            CounterRecPtr - CFE_ES_Global.CounterTable, CounterRecPtr->CounterName);
 }
 
 
@@ -314,6 +360,51 @@ CFE_ES_TaskRecord_t *CFE_ES_GetTaskRecordByContext(void)
     return TaskRecPtr;
 }
 
+/*********************************************************************/
+/*
+ * CFE_ES_GetTaskContextLockFree
+ *
+ * For complete API information, see prototype in header
+ *
+ * The record is read as a sequence lock: the generation count is odd
+ * while the task ID is being changed, and changes whenever it is changed.
+ */
+bool CFE_ES_GetTaskContextLockFree(CFE_ES_TaskId_t *TaskIdPtr, CFE_ES_AppId_t *AppIdPtr)
+{
+#if (CFE_PLATFORM_ES_TASK_CONTEXT_LOCKFREE == true) && CFE_ES_ATOMIC_AVAILABLE
+    CFE_ES_TaskRecord_t *TaskRecPtr;
+    CFE_ES_TaskId_t TaskID;
+    CFE_ES_AppId_t AppID;
+    uint32 Generation;
+    bool IsMatch;
+
+    TaskID = CFE_ES_TaskId_FromOSAL(OS_TaskGetId());
+    TaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskID);
+    if (TaskRecPtr == NULL)
+    {
+        return false;
+    }
+
+    Generation = CFE_ES_AtomicLoad32(&TaskRecPtr->Generation);
+    IsMatch = CFE_ES_TaskRecordIsMatch(TaskRecPtr, TaskID);
+    AppID = TaskRecPtr->AppId;
+    CFE_ES_AtomicFence();
+
+    if ((Generation & 1) != 0 ||
+            Generation != CFE_ES_AtomicLoad32(&TaskRecPtr->Generation) ||
+            !IsMatch || !CFE_RESOURCEID_TEST_DEFINED(AppID))
+    {
+        return false;
+    }
+
+    *TaskIdPtr = TaskID;
+    *AppIdPtr = AppID;
+    return true;
+#else
+    return false;
+#endif
+}
+
 /*********************************************************************/
 /*
  * CFE_ES_GetAppRecordByContext
@@ -37,6 +37,7 @@
 #include "cfe_resourceid_api.h"
 #include "private/cfe_core_resourceid_basevalues.h"
 #include "cfe_es_global.h"
+#include "cfe_es_atomic.h"
 
 
 /**
@@ -127,6 +128,7 @@ static inline CFE_ES_AppId_t CFE_ES_AppRecordGetID(const CFE_ES_AppRecord_t *App
 static inline void CFE_ES_AppRecordSetUsed(CFE_ES_AppRecord_t *AppRecPtr, CFE_ResourceId_t PendingId)
 {
     AppRecPtr->AppId = CFE_ES_APPID_C(PendingId);
+    CFE_ResourceId_SlotMapMark(CFE_ES_Global.AppSlotMap, CFE_PLATFORM_ES_MAX_APPLICATIONS, AppRecPtr - CFE_ES_Global.AppTable, true);
 }
 
 /**
@@ -143,6 +145,7 @@ static inline void CFE_ES_AppRecordSetUsed(CFE_ES_AppRecord_t *AppRecPtr, CFE_Re
 static inline void CFE_ES_AppRecordSetFree(CFE_ES_AppRecord_t *AppRecPtr)
 {
     AppRecPtr->AppId = CFE_ES_APPID_UNDEFINED;
+    CFE_ResourceId_SlotMapMark(CFE_ES_Global.AppSlotMap, CFE_PLATFORM_ES_MAX_APPLICATIONS, AppRecPtr - CFE_ES_Global.AppTable, false);
 }
 
 /**
@@ -223,6 +226,7 @@ static inline CFE_ES_LibId_t CFE_ES_LibRecordGetID(const CFE_ES_LibRecord_t *Lib
 static inline void CFE_ES_LibRecordSetUsed(CFE_ES_LibRecord_t *LibRecPtr, CFE_ResourceId_t PendingId)
 {
     LibRecPtr->LibId = CFE_ES_LIBID_C(PendingId);
+    CFE_ResourceId_SlotMapMark(CFE_ES_Global.LibSlotMap, CFE_PLATFORM_ES_MAX_LIBRARIES, LibRecPtr - CFE_ES_Global.LibTable, true);
 }
 
 /**
@@ -236,6 +240,7 @@ static inline void CFE_ES_LibRecordSetUsed(CFE_ES_LibRecord_t *LibRecPtr, CFE_Re
 static inline void CFE_ES_LibRecordSetFree(CFE_ES_LibRecord_t *LibRecPtr)
 {
     LibRecPtr->LibId = CFE_ES_LIBID_UNDEFINED;
+    CFE_ResourceId_SlotMapMark(CFE_ES_Global.LibSlotMap, CFE_PLATFORM_ES_MAX_LIBRARIES, LibRecPtr - CFE_ES_Global.LibTable, false);
 }
 
 /**
@@ -309,6 +314,10 @@ static inline bool CFE_ES_TaskRecordIsUsed(const CFE_ES_TaskRecord_t *TaskRecPtr
  * This sets the internal field(s) within this entry, and marks
  * it as being associated with the given Task ID.
  *
+ * The generation count is odd while the ID is changed, so that
+ * CFE_ES_GetTaskContextLockFree() can detect the change.  Other fields
+ * should be set before the entry is marked as used.
+ *
  * As this dereferences fields within the record, global data must be
  * locked prior to invoking this function.
  *
@@ -317,13 +326,16 @@ static inline bool CFE_ES_TaskRecordIsUsed(const CFE_ES_TaskRecord_t *TaskRecPtr
  */
 static inline void CFE_ES_TaskRecordSetUsed(CFE_ES_TaskRecord_t *TaskRecPtr, CFE_ResourceId_t PendingId)
 {
+    CFE_ES_AtomicAdd32(&TaskRecPtr->Generation, 1);
     TaskRecPtr->TaskId = CFE_ES_TASKID_C(PendingId);
+    CFE_ES_AtomicAdd32(&TaskRecPtr->Generation, 1);
 }
 
 /**
  * @brief Set a Task record table entry free
  *
  * This allows the table entry to be re-used by another Task.
+ * The generation count is updated as in CFE_ES_TaskRecordSetUsed().
  *
  * As this dereferences fields within the record, global data must be
  * locked prior to invoking this function.
@@ -333,7 +345,9 @@ static inline void CFE_ES_TaskRecordSetUsed(CFE_ES_TaskRecord_t *TaskRecPtr, CFE
  */
 static inline void CFE_ES_TaskRecordSetFree(CFE_ES_TaskRecord_t *TaskRecPtr)
 {
+    CFE_ES_AtomicAdd32(&TaskRecPtr->Generation, 1);
     TaskRecPtr->TaskId = CFE_ES_TASKID_UNDEFINED;
+    CFE_ES_AtomicAdd32(&TaskRecPtr->Generation, 1);
 }
 
 /**
@@ -413,6 +427,7 @@ static inline CFE_ES_CounterId_t CFE_ES_CounterRecordGetID(const CFE_ES_GenCount
 static inline void CFE_ES_CounterRecordSetUsed(CFE_ES_GenCounterRecord_t *CounterRecPtr, CFE_ResourceId_t PendingId)
 {
     CounterRecPtr->CounterId = CFE_ES_COUNTERID_C(PendingId);
+    CFE_ResourceId_SlotMapMark(CFE_ES_Global.CounterSlotMap, CFE_PLATFORM_ES_MAX_GEN_COUNTERS, CounterRecPtr - CFE_ES_Global.CounterTable, true);
 }
 
 /**
@@ -429,6 +444,7 @@ static inline void CFE_ES_CounterRecordSetUsed(CFE_ES_GenCounterRecord_t *Counte
 static inline void CFE_ES_CounterRecordSetFree(CFE_ES_GenCounterRecord_t *CounterRecPtr)
 {
     CounterRecPtr->CounterId = CFE_ES_COUNTERID_UNDEFINED;
+    CFE_ResourceId_SlotMapMark(CFE_ES_Global.CounterSlotMap, CFE_PLATFORM_ES_MAX_GEN_COUNTERS, CounterRecPtr - CFE_ES_Global.CounterTable, false);
 }
 
 /**
@@ -487,6 +503,22 @@ extern CFE_ES_AppRecord_t* CFE_ES_GetAppRecordByContext(void);
  */
 extern CFE_ES_TaskRecord_t* CFE_ES_GetTaskRecordByContext(void);
 
+/**
+ * Get the task and app IDs of the calling context without locking.
+ *
+ * Reads the ES TaskTable entry corresponding to the caller, and uses the
+ * generation count of the entry to confirm that it did not change while it
+ * was read.  Returns false if the entry is changing or does not match, or if
+ * lock-free lookups are not enabled, in which case the caller should lock
+ * the global data and use CFE_ES_GetTaskRecordByContext().
+ *
+ * The app record is not checked.  An app's task records are always marked
+ * for removal before the app record is freed.
+ *
+ * This function may be called without the global data lock.
+ */
+extern bool CFE_ES_GetTaskContextLockFree(CFE_ES_TaskId_t *TaskIdPtr, CFE_ES_AppId_t *AppIdPtr);
+
 /*
  * OSAL <-> CFE task ID conversion
  * 
@@ -551,7 +583,21 @@ CFE_ES_LibRecord_t *CFE_ES_LocateLibRecordByName(const char *Name);
 CFE_ES_TaskRecord_t *CFE_ES_LocateTaskRecordByName(const char *Name);
 CFE_ES_GenCounterRecord_t *CFE_ES_LocateCounterRecordByName(const char *Name);
 
-/* Availability check functions used in conjunction with CFE_ResourceId_FindNext() */
+/*
+ * Internal functions to set the name of a table entry
+ *
+ * These also add the entry to the name index of its table, which is used by
+ * the name based lookups above.  The name of an app, library or counter
+ * table entry must only be set through these functions.
+ *
+ * These functions do not lock, they must only be used internally by ES when
+ * the lock is already held.
+ */
+void CFE_ES_AppRecordSetName(CFE_ES_AppRecord_t *AppRecPtr, const char *Name);
+void CFE_ES_LibRecordSetName(CFE_ES_LibRecord_t *LibRecPtr, const char *Name);
+void CFE_ES_CounterRecordSetName(CFE_ES_GenCounterRecord_t *CounterRecPtr, const char *Name);
+
+/* Availability check functions used in conjunction with CFE_ResourceId_FindNextFree() */
 bool CFE_ES_CheckAppIdSlotUsed(CFE_ResourceId_t CheckId);
 bool CFE_ES_CheckLibIdSlotUsed(CFE_ResourceId_t CheckId);
 bool CFE_ES_CheckCounterIdSlotUsed(CFE_ResourceId_t CheckId);
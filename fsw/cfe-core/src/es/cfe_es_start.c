@@ -85,6 +85,12 @@ CFE_ES_ResetData_t  *CFE_ES_ResetDataPtr;
 void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const char *StartFilePath )
 {
    int32 ReturnCode;
+   OS_time_t MainEntryTime;
+
+   /*
+   ** Get the time of the entry, which is the start of the startup profile
+   */
+   CFE_PSP_GetTime(&MainEntryTime);
 
    /*
     * Clear the entire global data structure.
@@ -92,6 +98,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     * to be "undefined" (not in use).
     */
    memset(&CFE_ES_Global, 0, sizeof(CFE_ES_Global));
+   CFE_ES_Global.StartupProfileBase = MainEntryTime;
 
    /*
    ** Indicate that the CFE is the earliest initialization state
@@ -138,6 +145,12 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    */
    CFE_ES_SetupPerfVariables(StartType);
 
+   /*
+   ** Start the startup profile, which is also in the ES Reset area
+   */
+   CFE_ES_StartupProfileInit(StartType);
+   CFE_ES_StartupProfileMarkPhase(CFE_ES_STARTUP_PHASE_RESET_AREA);
+
    /*
    ** Also Create the ES Performance Data Mutex
    ** This is to separately protect against concurrent writes to the global performance log data
@@ -164,6 +177,17 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
        return;
    }
 
+   /*
+   ** Create the semaphore used to notify tasks of startup state changes.
+   ** This is not fatal, as the waiting tasks fall back to polling without it.
+   */
+   ReturnCode = OS_BinSemCreate(&CFE_ES_Global.StartupSyncSem, "ES_STARTUP_SYNC", 0, 0);
+   if (ReturnCode != OS_SUCCESS)
+   {
+       CFE_ES_SysLogWrite_Unsync("ES Startup: Error: ES Startup Sync Semaphore could not be created. RC=0x%08X\n",
+               (unsigned int)ReturnCode);
+   }
+
    /*
    ** Announce the startup
    */
@@ -173,6 +197,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    ** Create and Mount the filesystems needed
    */
    CFE_ES_InitializeFileSystems(StartType);
+   CFE_ES_StartupProfileMarkPhase(CFE_ES_STARTUP_PHASE_FILE_SYSTEMS);
    
    /*
    ** Install exception Handlers ( Placeholder )
@@ -190,8 +215,10 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    /*
    ** Indicate that the CFE core is now starting up / going multi-threaded
    */
+   CFE_ES_StartupProfileMarkPhase(CFE_ES_STARTUP_PHASE_CORE_STARTUP);
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering CORE_STARTUP state\n");
    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_STARTUP;
+   CFE_ES_StartupSyncNotify();
 
    /*
    ** Create the tasks, OS objects, and initialize hardware
@@ -201,8 +228,10 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    /*
    ** Indicate that the CFE core is ready
    */
+   CFE_ES_StartupProfileMarkPhase(CFE_ES_STARTUP_PHASE_CORE_READY);
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering CORE_READY state\n");
    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+   CFE_ES_StartupSyncNotify();
 
    /*
    ** Start the cFE Applications from the disk using the file
@@ -210,6 +239,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    ** ( defined in the cfe_platform_cfg.h file )
    */   
    CFE_ES_StartApplications(StartType, StartFilePath );
+   CFE_ES_StartupProfileMarkPhase(CFE_ES_STARTUP_PHASE_APPS_LOADED);
 
    /*
     * Wait for applications to be in at least "LATE_INIT"
@@ -224,8 +254,10 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
        CFE_ES_WriteToSysLog("ES Startup: Startup Sync failed - Applications may not have all initialized\n");
    }
 
+   CFE_ES_StartupProfileMarkPhase(CFE_ES_STARTUP_PHASE_APPS_INIT);
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering APPS_INIT state\n");
    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+   CFE_ES_StartupSyncNotify();
 
    /*
     * Wait for applications to be "RUNNING" before moving to operational system state.
@@ -243,8 +275,10 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    /*
    ** Startup is fully complete
    */
+   CFE_ES_StartupProfileMarkPhase(CFE_ES_STARTUP_PHASE_OPERATIONAL);
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering OPERATIONAL state\n");
    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+   CFE_ES_StartupSyncNotify();
 }
 
 /*
@@ -759,7 +793,7 @@ void  CFE_ES_CreateObjects(void)
             */
             CFE_ES_LockSharedData(__func__,__LINE__);
 
-            PendingAppId = CFE_ResourceId_FindNext(CFE_ES_Global.LastAppId, CFE_PLATFORM_ES_MAX_APPLICATIONS, CFE_ES_CheckAppIdSlotUsed);
+            PendingAppId = CFE_ResourceId_FindNextFree(CFE_ES_Global.LastAppId, CFE_PLATFORM_ES_MAX_APPLICATIONS, CFE_ES_Global.AppSlotMap, CFE_ES_CheckAppIdSlotUsed);
             AppRecPtr = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(PendingAppId));
             if (AppRecPtr != NULL)
             {
@@ -767,14 +801,13 @@ void  CFE_ES_CreateObjects(void)
                 ** Fill out the parameters in the AppStartParams sub-structure
                 */
                 AppRecPtr->Type = CFE_ES_AppType_CORE;
-                strncpy(AppRecPtr->StartParams.BasicInfo.Name, CFE_ES_ObjectTable[i].ObjectName,
-                        sizeof(AppRecPtr->StartParams.BasicInfo.Name)-1);
-                AppRecPtr->StartParams.BasicInfo.Name[sizeof(AppRecPtr->StartParams.BasicInfo.Name)-1] = '\0';
+                CFE_ES_AppRecordSetName(AppRecPtr, CFE_ES_ObjectTable[i].ObjectName);
 
                 /* FileName and EntryPoint is not valid for core apps */
                 AppRecPtr->StartParams.StackSize = CFE_ES_ObjectTable[i].ObjectSize;
                 AppRecPtr->StartParams.ExceptionAction = CFE_ES_ExceptionAction_PROC_RESTART;
                 AppRecPtr->StartParams.Priority = CFE_ES_ObjectTable[i].ObjectPriority;
+                AppRecPtr->StartParams.CpuAffinity = CFE_PLATFORM_ES_CORE_APP_CPU_AFFINITY;
                 AppRecPtr->ModuleInfo.EntryAddress = (cpuaddr)CFE_ES_ObjectTable[i].FuncPtrUnion.VoidPtr;
 
                 /*
@@ -785,6 +818,9 @@ void  CFE_ES_CreateObjects(void)
 
                 CFE_ES_AppRecordSetUsed(AppRecPtr, CFE_RESOURCEID_RESERVED);
                 CFE_ES_Global.LastAppId = PendingAppId;
+
+                CFE_ES_StartupProfileStartModule(PendingAppId, AppRecPtr->StartParams.BasicInfo.Name,
+                        CFE_ES_AppType_CORE);
             }
 
             CFE_ES_UnlockSharedData(__func__,__LINE__);
@@ -798,6 +834,8 @@ void  CFE_ES_CreateObjects(void)
                 ** Start the core app main task
                 ** (core apps are already in memory - no loading needed)
                 */
+                CFE_ES_StartupProfileMarkModule(PendingAppId, CFE_ES_STARTUP_PROFILE_LOAD_START);
+                CFE_ES_StartupProfileMarkModule(PendingAppId, CFE_ES_STARTUP_PROFILE_LOAD_END);
                 ReturnCode = CFE_ES_StartAppTask(&AppRecPtr->StartParams, CFE_ES_APPID_C(PendingAppId), &PendingTaskId);
 
                 /*
@@ -816,6 +854,7 @@ void  CFE_ES_CreateObjects(void)
                     ** Increment the Core App counter.
                     */
                     CFE_ES_Global.RegisteredCoreApps++;
+                    CFE_ES_StartupProfileMarkModule(PendingAppId, CFE_ES_STARTUP_PROFILE_REGISTERED);
                     ReturnCode = CFE_SUCCESS;
                 }
                 else
@@ -827,6 +866,9 @@ void  CFE_ES_CreateObjects(void)
                 }
 
                 CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+                /* the new app task may now get its entry point */
+                CFE_ES_StartupSyncNotify();
             }
             else
             {
@@ -909,14 +951,14 @@ void  CFE_ES_CreateObjects(void)
 ** Function: CFE_ES_MainTaskSyncDelay
 **
 ** Purpose:  Waits for all of the applications that CFE has started thus far to
-**           reach the indicated state, by polling the app counters in a delay loop.
+**           reach the indicated state.  The app table is checked again each time
+**           an app notifies a state change.
 **
 */
 int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
 {
     int32 Status;
     uint32 i;
-    uint32 WaitTime;
     uint32 WaitRemaining;
     uint32 AppNotReadyCounter;
     CFE_ES_AppRecord_t *AppRecPtr;
@@ -951,24 +993,201 @@ int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
         }
 
         /*
-         * Must delay and check again
+         * Must wait and check again
          */
-        if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
-        {
-            WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
-        }
-        else if (WaitRemaining > 0)
-        {
-            WaitTime = WaitRemaining;
-        }
-        else
+        Status = CFE_ES_StartupSyncWait(&WaitRemaining);
+        if (Status != CFE_SUCCESS)
         {
             break;
         }
-
-        OS_TaskDelay(WaitTime);
-        WaitRemaining -= WaitTime;
     }
 
     return Status;
 }
+
+/*-------------------------------------------------------------------------
+**
+**                  Functional Prolog
+**
+**   Name: CFE_ES_StartupProfileInit
+**
+**   Purpose: This function starts the startup profile of this boot in the
+**            reset area.  On a processor reset, the profile of the previous
+**            boot is kept as the previous profile, otherwise that is cleared.
+**            It must be called after CFE_ES_SetupResetVariables, and the
+**            time of the entry to CFE_ES_Main must already be stored.
+**----------------------------------------------------------------------------
+*/
+void CFE_ES_StartupProfileInit(uint32 StartType)
+{
+    CFE_ES_StartupProfileSummary_t *SummaryPtr;
+
+    if (StartType == CFE_PSP_RST_TYPE_PROCESSOR)
+    {
+        memcpy(&CFE_ES_ResetDataPtr->PrevStartupProfile, &CFE_ES_ResetDataPtr->StartupProfile,
+                sizeof(CFE_ES_ResetDataPtr->PrevStartupProfile));
+    }
+    else
+    {
+        memset(&CFE_ES_ResetDataPtr->PrevStartupProfile, 0, sizeof(CFE_ES_ResetDataPtr->PrevStartupProfile));
+    }
+
+    memset(&CFE_ES_ResetDataPtr->StartupProfile, 0, sizeof(CFE_ES_ResetDataPtr->StartupProfile));
+
+    SummaryPtr = &CFE_ES_ResetDataPtr->StartupProfile.Summary;
+    SummaryPtr->ResetType = CFE_ES_ResetDataPtr->ResetVars.ResetType;
+    SummaryPtr->ResetSubtype = CFE_ES_ResetDataPtr->ResetVars.ResetSubtype;
+    SummaryPtr->MainEntryTime = (uint32)OS_TimeGetTotalMicroseconds(CFE_ES_Global.StartupProfileBase);
+}
+
+/*
+** Name: CFE_ES_StartupProfileGetTime
+**
+** Purpose:  Gets the time since the entry to CFE_ES_Main in microseconds
+*/
+static uint32 CFE_ES_StartupProfileGetTime(void)
+{
+    OS_time_t Now;
+
+    CFE_PSP_GetTime(&Now);
+
+    return (uint32)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, CFE_ES_Global.StartupProfileBase));
+}
+
+/*
+** Name: CFE_ES_StartupProfileGetEntry
+**
+** Purpose:  Gets the startup profile entry of an app or library, or NULL if
+**           the system is already OPERATIONAL.
+*/
+static CFE_ES_StartupProfileEntry_t *CFE_ES_StartupProfileGetEntry(CFE_ResourceId_t ResourceId)
+{
+    uint32 Idx;
+    int32 Status;
+
+    if (CFE_ES_Global.SystemState >= CFE_ES_SystemState_OPERATIONAL)
+    {
+        return NULL;
+    }
+
+    switch (CFE_ResourceId_GetBase(ResourceId))
+    {
+    case CFE_ES_APPID_BASE:
+        Status = CFE_ES_AppID_ToIndex(CFE_ES_APPID_C(ResourceId), &Idx);
+        break;
+    case CFE_ES_LIBID_BASE:
+        Status = CFE_ES_LibID_ToIndex(CFE_ES_LIBID_C(ResourceId), &Idx);
+        Idx += CFE_PLATFORM_ES_MAX_APPLICATIONS;
+        break;
+    default:
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+        break;
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        return NULL;
+    }
+
+    return &CFE_ES_ResetDataPtr->StartupProfile.Entries[Idx];
+}
+
+/*
+** Name: CFE_ES_StartupProfileMarkPhase
+**
+** Purpose:  Records the end of a startup phase, see CFE_ES_STARTUP_PHASE_RESET_AREA
+*/
+void CFE_ES_StartupProfileMarkPhase(uint32 Phase)
+{
+    if (Phase < CFE_ES_STARTUP_PHASES)
+    {
+        CFE_ES_ResetDataPtr->StartupProfile.Summary.PhaseEndTime[Phase] = CFE_ES_StartupProfileGetTime();
+    }
+}
+
+/*
+** Name: CFE_ES_StartupProfileStartModule
+**
+** Purpose:  Starts the startup profile entry of an app or library when its
+**           table entry is reserved.  This must be called with the ES shared
+**           data locked.
+*/
+void CFE_ES_StartupProfileStartModule(CFE_ResourceId_t ResourceId, const char *Name, uint32 Type)
+{
+    CFE_ES_StartupProfileEntry_t *EntryPtr;
+
+    EntryPtr = CFE_ES_StartupProfileGetEntry(ResourceId);
+    if (EntryPtr == NULL)
+    {
+        return;
+    }
+
+    /* an entry is only reused if an app or library is deleted during startup */
+    if (EntryPtr->Name[0] == 0)
+    {
+        ++CFE_ES_ResetDataPtr->StartupProfile.Summary.NumEntries;
+    }
+
+    memset(EntryPtr, 0, sizeof(*EntryPtr));
+    strncpy(EntryPtr->Name, Name, sizeof(EntryPtr->Name) - 1);
+    EntryPtr->Type = Type;
+}
+
+/*
+** Name: CFE_ES_StartupProfileMarkModule
+**
+** Purpose:  Records a point in the startup of an app or library, such as
+**           CFE_ES_STARTUP_PROFILE_LOAD_START.  Different points of the same
+**           entry may be recorded by different tasks at the same time.
+*/
+void CFE_ES_StartupProfileMarkModule(CFE_ResourceId_t ResourceId, uint32 Point)
+{
+    CFE_ES_StartupProfileEntry_t *EntryPtr;
+    uint32 Time;
+
+    EntryPtr = CFE_ES_StartupProfileGetEntry(ResourceId);
+    if (EntryPtr == NULL || EntryPtr->Name[0] == 0)
+    {
+        return;
+    }
+
+    Time = CFE_ES_StartupProfileGetTime();
+
+    switch (Point)
+    {
+    case CFE_ES_STARTUP_PROFILE_LOAD_START:
+        EntryPtr->LoadStartTime = Time;
+        break;
+    case CFE_ES_STARTUP_PROFILE_LOAD_END:
+        EntryPtr->LoadEndTime = Time;
+        break;
+    case CFE_ES_STARTUP_PROFILE_REGISTERED:
+        EntryPtr->RegisteredTime = Time;
+        break;
+    case CFE_ES_STARTUP_PROFILE_LATE_INIT:
+        EntryPtr->LateInitTime = Time;
+        break;
+    case CFE_ES_STARTUP_PROFILE_RUNNING:
+        EntryPtr->RunningTime = Time;
+        break;
+    default:
+        break;
+    }
+}
+
+/*
+** Name: CFE_ES_StartupProfileMarkAppState
+**
+** Purpose:  Records that an app reached the LATE_INIT or RUNNING state
+*/
+void CFE_ES_StartupProfileMarkAppState(CFE_ES_AppId_t AppId, uint32 AppState)
+{
+    if (AppState == CFE_ES_AppState_LATE_INIT)
+    {
+        CFE_ES_StartupProfileMarkModule(CFE_RESOURCEID_UNWRAP(AppId), CFE_ES_STARTUP_PROFILE_LATE_INIT);
+    }
+    else if (AppState == CFE_ES_AppState_RUNNING)
+    {
+        CFE_ES_StartupProfileMarkModule(CFE_RESOURCEID_UNWRAP(AppId), CFE_ES_STARTUP_PROFILE_RUNNING);
+    }
+}
@@ -57,6 +57,15 @@
 #define CFE_ES_FUNCTION_CALL 0x04
 #define CFE_ES_MUTEX_SEM     0x05
 
+/*
+** points recorded in the startup profile entry of an app or library
+*/
+#define CFE_ES_STARTUP_PROFILE_LOAD_START  0
+#define CFE_ES_STARTUP_PROFILE_LOAD_END    1
+#define CFE_ES_STARTUP_PROFILE_REGISTERED  2
+#define CFE_ES_STARTUP_PROFILE_LATE_INIT   3
+#define CFE_ES_STARTUP_PROFILE_RUNNING     4
+
 /*
 ** Type Definitions
 */
@@ -95,5 +104,15 @@ extern void  CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, u
 extern void  CFE_ES_InitializeFileSystems(uint32 StartType);
 extern void CFE_ES_SetupPerfVariables(uint32 ResetType);
 
+/*
+** Startup profile functions
+** These only record anything before the system is OPERATIONAL.
+*/
+extern void  CFE_ES_StartupProfileInit(uint32 StartType);
+extern void  CFE_ES_StartupProfileMarkPhase(uint32 Phase);
+extern void  CFE_ES_StartupProfileStartModule(CFE_ResourceId_t ResourceId, const char *Name, uint32 Type);
+extern void  CFE_ES_StartupProfileMarkModule(CFE_ResourceId_t ResourceId, uint32 Point);
+extern void  CFE_ES_StartupProfileMarkAppState(CFE_ES_AppId_t AppId, uint32 AppState);
+
 
 #endif  /* _cfe_es_start_ */
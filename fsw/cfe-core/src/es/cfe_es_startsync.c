@@ -0,0 +1,114 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File: cfe_es_startsync.c
+**
+** Purpose: This file contains the functions through which tasks wait for
+**  startup state changes, and ES notifies them of those changes.
+**
+**  These only depend on the OSAL semaphore and the PSP time API, so they
+**  are kept apart from the rest of the ES API.  This allows the startup
+**  sync benchmark in the unit test directory to build them on their own.
+**
+*/
+
+/*
+** Include Section
+*/
+
+#include "private/cfe_private.h"
+#include "cfe_es.h"
+#include "cfe_es_global.h"
+#include "cfe_psp.h"
+
+/*
+** Function: CFE_ES_StartupSyncNotify
+**
+** Purpose:  Wakes up all tasks waiting in CFE_ES_StartupSyncWait(), after the
+**           system state or the state of an app has changed.
+*/
+void CFE_ES_StartupSyncNotify(void)
+{
+    /*
+     * The flush wakes all tasks which are pending on the semaphore.  The give
+     * leaves it available for a task which has checked its condition but is
+     * not pending yet, so that task does not miss this change either.
+     */
+    OS_BinSemFlush(CFE_ES_Global.StartupSyncSem);
+    OS_BinSemGive(CFE_ES_Global.StartupSyncSem);
+}
+
+/*
+** Function: CFE_ES_StartupSyncWait
+**
+** Purpose:  Waits until a state change is notified, or for at most
+**           CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC, and deducts the time waited
+**           from the remaining time.  Returns CFE_ES_OPERATION_TIMED_OUT if
+**           there is no time remaining.
+*/
+int32 CFE_ES_StartupSyncWait(uint32 *WaitRemainingPtr)
+{
+    int32 Status;
+    uint32 WaitTime;
+    int64 Elapsed;
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+
+    if (*WaitRemainingPtr == 0)
+    {
+        return CFE_ES_OPERATION_TIMED_OUT;
+    }
+
+    WaitTime = *WaitRemainingPtr;
+    if (CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC > 0 && WaitTime > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
+    {
+        WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+    }
+
+    CFE_PSP_GetTime(&StartTime);
+    Status = OS_BinSemTimedWait(CFE_ES_Global.StartupSyncSem, WaitTime);
+    if (Status == OS_SUCCESS)
+    {
+        /*
+         * Woken up by a notification, so only deduct the time
+         * actually waited, but at least 1ms so this always ends.
+         */
+        CFE_PSP_GetTime(&EndTime);
+        Elapsed = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(EndTime, StartTime));
+        if (Elapsed < 1)
+        {
+            Elapsed = 1;
+        }
+        if (Elapsed < WaitTime)
+        {
+            WaitTime = Elapsed;
+        }
+    }
+    else if (Status != OS_SEM_TIMEOUT)
+    {
+        /* semaphore not available, fall back to polling */
+        OS_TaskDelay(WaitTime);
+    }
+
+    *WaitRemainingPtr -= WaitTime;
+
+    return CFE_SUCCESS;
+}
@@ -46,6 +46,10 @@
 **     The expectation is that the required level of synchronization can be achieved
 **     using the existing ES shared data lock.  However, if it becomes necessary, this
 **     could be replaced with a finer grained syslog-specific lock.
+**
+**     The exception is CFE_ES_SysLogAppend(), which appends a message without
+**     the lock when it fits before the end of the buffer.  Therefore a reader
+**     holding the lock may see the newest message partially written.
 */
 
 /*
@@ -56,12 +60,18 @@
 #include "cfe_es_global.h"
 #include "cfe_es_task.h"
 #include "cfe_es_log.h"
+#include "cfe_es_atomic.h"
 
 #include <string.h>
 #include <stdio.h>
 #include <stdarg.h>
 #include <ctype.h>
 
+/*
+ * Value of the write index while the buffer is closed to lock-free writers.
+ * This is past the end of the buffer, so no message can be reserved there.
+ */
+#define CFE_ES_SYSLOG_CLOSED_IDX    (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE + 1)
 
 
 
@@ -92,9 +102,9 @@ void CFE_ES_SysLogClear_Unsync(void)
      * by simply zeroing out the indices will cover it.
      */
 
-    CFE_ES_ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_ResetDataPtr->SystemLogEndIdx = 0;
-    CFE_ES_ResetDataPtr->SystemLogEntryNum = 0;
+    CFE_ES_AtomicStoreSize(&CFE_ES_ResetDataPtr->SystemLogWriteIdx, 0);
+    CFE_ES_AtomicStoreSize(&CFE_ES_ResetDataPtr->SystemLogEndIdx, 0);
+    CFE_ES_AtomicStore32(&CFE_ES_ResetDataPtr->SystemLogEntryNum, 0);
 
 } /* End of CFE_ES_SysLogClear_Unsync() */
 
@@ -134,6 +144,50 @@ void CFE_ES_SysLogReadStart_Unsync(CFE_ES_SysLogReadBuffer_t *Buffer)
     Buffer->BlockSize = 0;
 } /* End of CFE_ES_SysLogReadStart_Unsync() */
 
+/*
+ * -----------------------------------------------------------------
+ * CFE_ES_SysLogCommit --
+ * Copy a message into space reserved in the syslog, and account for it
+ *
+ * The space from WriteIdx to WriteIdx + MessageLen must already be reserved
+ * by advancing SystemLogWriteIdx, so no other writer will use it.
+ * This may run concurrently with other writers, so the shared
+ * values are only updated atomically.
+ * -----------------------------------------------------------------
+ */
+static void CFE_ES_SysLogCommit(size_t WriteIdx, const char *LogString, size_t MessageLen)
+{
+    size_t EndIdx;
+
+    /*
+     * Copy the message in, EXCEPT for the last char which is probably a newline
+     */
+    memcpy(&CFE_ES_ResetDataPtr->SystemLog[WriteIdx], LogString, MessageLen - 1);
+    WriteIdx += MessageLen;
+
+    /*
+     * Ensure the that last-written character is a newline.
+     * This would have been enforced already except in cases where
+     * the message got truncated.
+     */
+    CFE_ES_ResetDataPtr->SystemLog[WriteIdx - 1] = '\n';
+
+    /*
+     * Keep track of the buffer endpoint for future reference.
+     * Another writer may be moving it at the same time, so only
+     * replace it if it is still below the end of this message.
+     */
+    EndIdx = CFE_ES_AtomicLoadSize(&CFE_ES_ResetDataPtr->SystemLogEndIdx);
+    while (WriteIdx > EndIdx &&
+            !CFE_ES_AtomicCompareExchangeSize(&CFE_ES_ResetDataPtr->SystemLogEndIdx, &EndIdx, WriteIdx))
+    {
+        /* EndIdx was updated with the current value, try again */
+    }
+
+    CFE_ES_AtomicAdd32(&CFE_ES_ResetDataPtr->SystemLogEntryNum, 1);
+
+} /* End of CFE_ES_SysLogCommit() */
+
 /*
  * -----------------------------------------------------------------
  * CFE_ES_SysLogAppend_Unsync() --
@@ -145,7 +199,7 @@ int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
     int32 ReturnCode;
     size_t MessageLen;
     size_t WriteIdx;
-    size_t EndIdx;
+    size_t NextWriteIdx;
 
     /*
      * Sanity check - Make sure the message length is actually reasonable
@@ -173,18 +227,30 @@ int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
 
     /*
      * Real work begins --
-     * Take a local snapshot of the head & tail index values
+     * Take the write index, and close the buffer to lock-free writers
+     * (see CFE_ES_SysLogAppend) by setting it past the end of the buffer,
+     * until the new value is stored below.  Lock-free writers which
+     * already reserved their space may still be copying into it.
      *
      * WriteIdx -> indicates 1 byte past the end of the newest message
      *      (this is the place where new messages will be added)
      *
-     * EndIdx -> indicates the entire size of the buffer
-     *
-     * Keeping them in local stack variables allows more efficient modification,
+     * Keeping it in a local stack variable allows more efficient modification,
      * since CFE_ES_ResetDataPtr may point directly into a slower NVRAM space.
      */
-    WriteIdx = CFE_ES_ResetDataPtr->SystemLogWriteIdx;
-    EndIdx = CFE_ES_ResetDataPtr->SystemLogEndIdx;
+    WriteIdx = CFE_ES_AtomicLoadSize(&CFE_ES_ResetDataPtr->SystemLogWriteIdx);
+    while (!CFE_ES_AtomicCompareExchangeSize(&CFE_ES_ResetDataPtr->SystemLogWriteIdx,
+            &WriteIdx, CFE_ES_SYSLOG_CLOSED_IDX))
+    {
+        /* WriteIdx was updated with the current value, try again */
+    }
+
+    /* The buffer may have been left closed by a reset during an append */
+    if (WriteIdx > CFE_PLATFORM_ES_SYSTEM_LOG_SIZE)
+    {
+        WriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE;
+    }
+    NextWriteIdx = WriteIdx;
 
     /*
      * Check if the log message plus will fit between
@@ -199,8 +265,12 @@ int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
     {
         if ( CFE_ES_ResetDataPtr->SystemLogMode == CFE_ES_LogMode_OVERWRITE )
         {
-            /* In "overwrite" mode, start back at the beginning of the buffer */
-            EndIdx = WriteIdx;
+            /*
+             * In "overwrite" mode, start back at the beginning of the buffer.
+             * Lock-free writers still copying end before WriteIdx, so they
+             * will not move the end point past this.
+             */
+            CFE_ES_AtomicStoreSize(&CFE_ES_ResetDataPtr->SystemLogEndIdx, WriteIdx);
             WriteIdx = 0;
         }
         else if (WriteIdx < (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE))
@@ -224,35 +294,16 @@ int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
     }
     else
     {
-        /*
-         * Copy the message in, EXCEPT for the last char which is probably a newline
-         */
-        memcpy(&CFE_ES_ResetDataPtr->SystemLog[WriteIdx], LogString, MessageLen - 1);
-        WriteIdx += MessageLen;
-
-        /*
-         * Ensure the that last-written character is a newline.
-         * This would have been enforced already except in cases where
-         * the message got truncated.
-         */
-        CFE_ES_ResetDataPtr->SystemLog[WriteIdx - 1] = '\n';
-
-        /*
-         * Keep track of the buffer endpoint for future reference
-         */
-        if (WriteIdx > EndIdx)
-        {
-            EndIdx = WriteIdx;
-        }
-
-        /*
-         * Export updated index values to the reset area for next time.
-         */
-        CFE_ES_ResetDataPtr->SystemLogWriteIdx = WriteIdx;
-        CFE_ES_ResetDataPtr->SystemLogEndIdx = EndIdx;
-        ++CFE_ES_ResetDataPtr->SystemLogEntryNum;
+        CFE_ES_SysLogCommit(WriteIdx, LogString, MessageLen);
+        NextWriteIdx = WriteIdx + MessageLen;
     }
 
+    /*
+     * Export updated index value to the reset area for next time.
+     * This opens the buffer to lock-free writers again.
+     */
+    CFE_ES_AtomicStoreSize(&CFE_ES_ResetDataPtr->SystemLogWriteIdx, NextWriteIdx);
+
     return (ReturnCode);
 } /* End of CFE_ES_SysLogAppend_Unsync() */
 
@@ -293,6 +344,50 @@ int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...)
  *******************************************************************/
 
 
+/*
+ * -----------------------------------------------------------------
+ * CFE_ES_SysLogAppend() --
+ * Append a preformatted string to the syslog, with synchronization
+ *
+ * In the common case, where the message fits before the end of the
+ * buffer, space is reserved by advancing the write index atomically,
+ * and the message is copied in without holding any lock.  Otherwise
+ * the ES shared data lock is taken, and the message is appended by
+ * CFE_ES_SysLogAppend_Unsync(), which deals with the end of the buffer.
+ * -----------------------------------------------------------------
+ */
+int32 CFE_ES_SysLogAppend(const char *LogString)
+{
+    int32 ReturnCode;
+#if CFE_ES_ATOMIC_AVAILABLE
+    size_t MessageLen;
+    size_t WriteIdx;
+
+    MessageLen = strlen(LogString);
+    if (MessageLen > 0 && MessageLen <= (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2))
+    {
+        WriteIdx = CFE_ES_AtomicLoadSize(&CFE_ES_ResetDataPtr->SystemLogWriteIdx);
+        while ((WriteIdx + MessageLen) <= CFE_PLATFORM_ES_SYSTEM_LOG_SIZE)
+        {
+            if (CFE_ES_AtomicCompareExchangeSize(&CFE_ES_ResetDataPtr->SystemLogWriteIdx,
+                    &WriteIdx, WriteIdx + MessageLen))
+            {
+                CFE_ES_SysLogCommit(WriteIdx, LogString, MessageLen);
+                return CFE_SUCCESS;
+            }
+
+            /* Another writer got there first, WriteIdx was updated with the current value */
+        }
+    }
+#endif
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    ReturnCode = CFE_ES_SysLogAppend_Unsync(LogString);
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    return ReturnCode;
+} /* End of CFE_ES_SysLogAppend() */
+
 /*
  * -----------------------------------------------------------------
  * CFE_ES_SysLogReadData --
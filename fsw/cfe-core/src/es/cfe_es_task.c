@@ -66,6 +66,23 @@
 */
 #define OS_MAX_PRIORITY 255
 
+/*
+** The memory pool profile file is also read by cmake/pool_blocksizes.cmake,
+** which has the sizes and offsets below built in.  If any of these fail,
+** the POOL_PROFILE_xx values in that tool must be updated to match.
+*/
+CompileTimeAssert(sizeof(CFE_FS_Header_t) == 64, PoolProfileFsHeaderSize);
+CompileTimeAssert(CFE_FS_SubType_ES_POOL_PROFILE == 24, PoolProfileFsSubType);
+CompileTimeAssert(offsetof(CFE_ES_MemPoolProfile_t, NumBlockSizes) == 16, PoolProfileNumBlockSizesOffset);
+CompileTimeAssert(offsetof(CFE_ES_MemPoolProfile_t, NumSizeRanges) == 24, PoolProfileNumRangesOffset);
+CompileTimeAssert(offsetof(CFE_ES_MemPoolProfile_t, BlockProfile) == 36, PoolProfileFixedSize);
+CompileTimeAssert(sizeof(CFE_ES_BlockProfile_t) == 24, PoolProfileBlockSize);
+CompileTimeAssert(offsetof(CFE_ES_BlockProfile_t, BlockSize) == 0, PoolProfileBlockSizeOffset);
+CompileTimeAssert(sizeof(CFE_ES_MemPoolProfile_t) == 36 + (CFE_MISSION_ES_POOL_MAX_BUCKETS * (24 + 4)), PoolProfileBucketSize);
+CompileTimeAssert(sizeof(CFE_ES_MemPoolSizeProfile_t) == 12, PoolProfileRangeSize);
+CompileTimeAssert(offsetof(CFE_ES_MemPoolSizeProfile_t, MaxSize) == 4, PoolProfileRangeMaxSizeOffset);
+CompileTimeAssert(offsetof(CFE_ES_MemPoolSizeProfile_t, Count) == 8, PoolProfileRangeCountOffset);
+
 /*
 ** Executive Services (ES) task global data.
 */
@@ -210,6 +227,11 @@ int32 CFE_ES_TaskInit(void)
         return(Status);
     }
 
+    /*
+    ** Name the performance markers used by ES
+    */
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_ES_MAIN_PERF_ID, "ES_MAIN");
+
     /*
     ** Initialize task command execution counters
     */
@@ -259,6 +281,34 @@ int32 CFE_ES_TaskInit(void)
                  CFE_SB_ValueToMsgId(CFE_ES_MEMSTATS_TLM_MID),
                  sizeof(CFE_ES_TaskData.MemStatsPacket));
 
+    /*
+    ** Initialize performance marker statistics telemetry packet
+    */
+    CFE_MSG_Init(&CFE_ES_TaskData.PerfStatsPacket.TlmHeader.Msg,
+                 CFE_SB_ValueToMsgId(CFE_ES_PERF_STATS_TLM_MID),
+                 sizeof(CFE_ES_TaskData.PerfStatsPacket));
+
+    /*
+    ** Initialize startup profile telemetry packet
+    */
+    CFE_MSG_Init(&CFE_ES_TaskData.StartupProfilePacket.TlmHeader.Msg,
+                 CFE_SB_ValueToMsgId(CFE_ES_STARTUP_PROFILE_TLM_MID),
+                 sizeof(CFE_ES_TaskData.StartupProfilePacket));
+
+    /*
+    ** Initialize task CPU utilization telemetry packet
+    */
+    CFE_MSG_Init(&CFE_ES_TaskData.TaskUtilPacket.TlmHeader.Msg,
+                 CFE_SB_ValueToMsgId(CFE_ES_TASK_UTIL_TLM_MID),
+                 sizeof(CFE_ES_TaskData.TaskUtilPacket));
+
+    /*
+    ** Initialize generic counter snapshot telemetry packet
+    */
+    CFE_MSG_Init(&CFE_ES_TaskData.GenCounterPacket.TlmHeader.Msg,
+                 CFE_SB_ValueToMsgId(CFE_ES_GEN_COUNTER_TLM_MID),
+                 sizeof(CFE_ES_TaskData.GenCounterPacket));
+
     /*
     ** Create Software Bus message pipe
     */
@@ -612,6 +662,41 @@ void CFE_ES_TaskPipe(CFE_SB_Buffer_t *SBBufPtr)
                     }
                     break;
 
+                case CFE_ES_WRITE_MEM_POOL_PROFILE_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteMemPoolProfileCmd_t)))
+                    {
+                        CFE_ES_WriteMemPoolProfileCmd((CFE_ES_WriteMemPoolProfileCmd_t*)SBBufPtr);
+                    }
+                    break;
+
+                case CFE_ES_START_PERF_STREAM_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StartPerfStreamCmd_t)))
+                    {
+                        CFE_ES_StartPerfStreamCmd((CFE_ES_StartPerfStreamCmd_t*)SBBufPtr);
+                    }
+                    break;
+
+                case CFE_ES_WRITE_PERF_TRACE_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WritePerfTraceCmd_t)))
+                    {
+                        CFE_ES_WritePerfTraceCmd((CFE_ES_WritePerfTraceCmd_t*)SBBufPtr);
+                    }
+                    break;
+
+                case CFE_ES_SEND_STARTUP_PROFILE_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SendStartupProfileCmd_t)))
+                    {
+                        CFE_ES_SendStartupProfileCmd((CFE_ES_SendStartupProfileCmd_t*)SBBufPtr);
+                    }
+                    break;
+
+                case CFE_ES_WRITE_STARTUP_PROFILE_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteStartupProfileCmd_t)))
+                    {
+                        CFE_ES_WriteStartupProfileCmd((CFE_ES_WriteStartupProfileCmd_t*)SBBufPtr);
+                    }
+                    break;
+
                 default:
                     CFE_EVS_SendEvent(CFE_ES_CC1_ERR_EID, CFE_EVS_EventType_ERROR,
                      "Invalid ground command code: ID = 0x%X, CC = %d",
@@ -736,6 +821,23 @@ int32 CFE_ES_HousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
     CFE_SB_TimeStampMsg(&CFE_ES_TaskData.HkPacket.TlmHeader.Msg);
     CFE_SB_TransmitMsg(&CFE_ES_TaskData.HkPacket.TlmHeader.Msg, true);
 
+#if (CFE_PLATFORM_ES_PERF_MARKER_STATS == true)
+    /*
+    ** Send the statistics of the next performance markers
+    */
+    CFE_ES_SendPerfStats();
+#endif
+
+    /*
+    ** Send the CPU time and utilization of the next tasks
+    */
+    CFE_ES_SendTaskUtil();
+
+    /*
+    ** Send a snapshot of the generic counters
+    */
+    CFE_ES_SendGenCounterSnapshot();
+
     /*
     ** This command does not affect the command execution counter.
     */
@@ -743,6 +845,84 @@ int32 CFE_ES_HousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
     return CFE_SUCCESS;
 } /* End of CFE_ES_HousekeepingCmd() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_ES_SendGenCounterSnapshot() -- Send the value of all        */
+/*                                    registered generic counters  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_SendGenCounterSnapshot(void)
+{
+    CFE_ES_GenCounterTlm_Payload_t *PayloadPtr;
+    CFE_ES_GenCounterRecord_t      *CountRecPtr;
+    CFE_ES_GenCounterValue_t       *ValuePtr;
+    uint32                          CounterIdx;
+    uint16                          PacketNumber;
+
+    PayloadPtr = &CFE_ES_TaskData.GenCounterPacket.Payload;
+    CounterIdx = 0;
+    PacketNumber = 0;
+    ++CFE_ES_TaskData.GenCounterSequence;
+
+    do
+    {
+        memset(PayloadPtr, 0, sizeof(*PayloadPtr));
+        PayloadPtr->Sequence = CFE_ES_TaskData.GenCounterSequence;
+        PayloadPtr->PacketNumber = PacketNumber;
+
+        /*
+        ** The lock is only held while filling in each packet, the counts
+        ** themselves are updated without it.
+        */
+        CFE_ES_LockSharedData(__func__,__LINE__);
+
+        while (CounterIdx < CFE_PLATFORM_ES_MAX_GEN_COUNTERS &&
+                PayloadPtr->NumCounters < CFE_MISSION_ES_GEN_COUNTER_SNAPSHOT_MAX_COUNTERS)
+        {
+            CountRecPtr = &CFE_ES_Global.CounterTable[CounterIdx];
+            if (CFE_ES_CounterRecordIsUsed(CountRecPtr))
+            {
+                ValuePtr = &PayloadPtr->Counters[PayloadPtr->NumCounters];
+                ++PayloadPtr->NumCounters;
+
+                ValuePtr->CounterId = CFE_ES_CounterRecordGetID(CountRecPtr);
+                ValuePtr->Count = CFE_ES_AtomicLoad32(&CountRecPtr->Counter);
+                strncpy(ValuePtr->CounterName, CFE_ES_CounterRecordGetName(CountRecPtr),
+                        sizeof(ValuePtr->CounterName) - 1);
+            }
+
+            ++CounterIdx;
+        }
+
+        /*
+        ** Skip the free slots, so the last packet of the snapshot is marked
+        ** as such even when it is full.
+        */
+        while (CounterIdx < CFE_PLATFORM_ES_MAX_GEN_COUNTERS &&
+                !CFE_ES_CounterRecordIsUsed(&CFE_ES_Global.CounterTable[CounterIdx]))
+        {
+            ++CounterIdx;
+        }
+
+        CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+        if (PacketNumber == 0 && PayloadPtr->NumCounters == 0)
+        {
+            /* No generic counters are registered */
+            break;
+        }
+
+        PayloadPtr->LastPacket = (CounterIdx >= CFE_PLATFORM_ES_MAX_GEN_COUNTERS);
+
+        CFE_SB_TimeStampMsg(&CFE_ES_TaskData.GenCounterPacket.TlmHeader.Msg);
+        CFE_SB_TransmitMsg(&CFE_ES_TaskData.GenCounterPacket.TlmHeader.Msg, true);
+
+        ++PacketNumber;
+    }
+    while (CounterIdx < CFE_PLATFORM_ES_MAX_GEN_COUNTERS);
+
+} /* End of CFE_ES_SendGenCounterSnapshot() */
+
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -921,7 +1101,8 @@ int32 CFE_ES_StartAppCmd(const CFE_ES_StartAppCmd_t *data)
                    LocalAppName,
                    cmd->Priority,
                    AppStackSize,
-                   cmd->ExceptionAction);
+                   cmd->ExceptionAction,
+                   0);
 
         /*
         ** Send appropriate event message
@@ -1950,6 +2131,321 @@ int32 CFE_ES_DumpCDSRegistryCmd(const CFE_ES_DumpCDSRegistryCmd_t *data)
     return CFE_SUCCESS;
 } /* End of CFE_ES_DumpCDSRegistryCmd() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_ES_WriteMemPoolProfileCmd() -- Write memory pool profile    */
+/*                                    to a file                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 CFE_ES_WriteMemPoolProfileCmd(const CFE_ES_WriteMemPoolProfileCmd_t *data)
+{
+    CFE_FS_Header_t               StdFileHeader;
+    osal_id_t                     FileDescriptor;
+    int32                         Status;
+    uint16                        SizeRange;
+    const CFE_ES_WriteMemPoolProfileCmd_Payload_t *CmdPtr = &data->Payload;
+    char                          ProfileFilename[OS_MAX_PATH_LEN];
+    CFE_ES_MemPoolProfile_t       Profile;
+    CFE_ES_MemPoolSizeProfile_t   SizeProfile;
+    int32                         FileSize=0;
+
+    /* Copy the commanded filename into local buffer to ensure size limitation and to allow for modification */
+    CFE_SB_MessageStringGet(ProfileFilename, CmdPtr->FileName, CFE_PLATFORM_ES_DEFAULT_POOL_PROFILE_FILE,
+            sizeof(ProfileFilename), sizeof(CmdPtr->FileName));
+
+    /* Verify the handle and collect the profile before creating the file */
+    if (!CFE_ES_ValidateHandle(CmdPtr->PoolHandle))
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+    else
+    {
+        Status = CFE_ES_GetMemPoolProfile(&Profile, CmdPtr->PoolHandle);
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CFE_ES_POOL_PROFILE_ERR_EID,
+                CFE_EVS_EventType_ERROR,
+                "Cannot write memory pool profile. Illegal Handle (0x%08lX)",
+                CFE_RESOURCEID_TO_ULONG(CmdPtr->PoolHandle));
+
+        /* Increment Command Error Counter */
+        CFE_ES_TaskData.CommandErrorCounter++;
+        return CFE_SUCCESS;
+    }
+
+    /* Create a new profile file, overwriting anything that may have existed previously */
+    Status = OS_OpenCreate(&FileDescriptor, ProfileFilename,
+            OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+
+    if (Status < OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CFE_ES_POOL_PROFILE_ERR_EID,
+                CFE_EVS_EventType_ERROR,
+                "Error creating memory pool profile file '%s', Status=0x%08X",
+                ProfileFilename, (unsigned int)Status);
+
+        /* Increment Command Error Counter */
+        CFE_ES_TaskData.CommandErrorCounter++;
+        return CFE_SUCCESS;
+    }
+
+    /* Initialize the standard cFE File Header for the Profile File */
+    CFE_FS_InitHeader(&StdFileHeader, "ES Memory Pool Profile", CFE_FS_SubType_ES_POOL_PROFILE);
+
+    /* Output the Standard cFE File Header to the Profile File */
+    Status = CFE_FS_WriteHeader(FileDescriptor, &StdFileHeader);
+
+    if (Status == sizeof(CFE_FS_Header_t))
+    {
+        FileSize += Status;
+        Status = OS_write(FileDescriptor, &Profile, sizeof(Profile));
+
+        if (Status == sizeof(Profile))
+        {
+            FileSize += Status;
+
+            /* Followed by one record per size range */
+            for (SizeRange = 0; SizeRange < Profile.NumSizeRanges; ++SizeRange)
+            {
+                CFE_ES_GetMemPoolSizeProfile(&SizeProfile, CmdPtr->PoolHandle, SizeRange);
+
+                Status = OS_write(FileDescriptor, &SizeProfile, sizeof(SizeProfile));
+                if (Status != sizeof(SizeProfile))
+                {
+                    break;
+                }
+
+                FileSize += Status;
+            }
+        }
+    }
+
+    /* We are done outputting data to the profile file.  Close it. */
+    OS_close(FileDescriptor);
+
+    if (Status >= 0 && FileSize == (sizeof(CFE_FS_Header_t) + sizeof(Profile) +
+            (Profile.NumSizeRanges * sizeof(SizeProfile))))
+    {
+        CFE_EVS_SendEvent(CFE_ES_POOL_PROFILE_INF_EID,
+                CFE_EVS_EventType_DEBUG,
+                "Memory pool profile written to '%s', Size=%d",
+                ProfileFilename, (int)FileSize);
+
+        /* Increment Successful Command Counter */
+        CFE_ES_TaskData.CommandCounter++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CFE_ES_POOL_PROFILE_ERR_EID,
+                CFE_EVS_EventType_ERROR,
+                "Error writing memory pool profile to '%s', Status=0x%08X",
+                ProfileFilename, (unsigned int)Status);
+
+        /* Increment Command Error Counter */
+        CFE_ES_TaskData.CommandErrorCounter++;
+    }
+
+    return CFE_SUCCESS;
+} /* End of CFE_ES_WriteMemPoolProfileCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_ES_GetStartupProfile() -- Get the startup profile selected  */
+/*                               in a command, or NULL if invalid  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static const CFE_ES_StartupProfile_t *CFE_ES_GetStartupProfile(uint32 Profile)
+{
+    const CFE_ES_StartupProfile_t *ProfilePtr;
+
+    if (Profile == CFE_ES_STARTUP_PROFILE_CURRENT)
+    {
+        ProfilePtr = &CFE_ES_ResetDataPtr->StartupProfile;
+    }
+    else if (Profile == CFE_ES_STARTUP_PROFILE_PREVIOUS)
+    {
+        ProfilePtr = &CFE_ES_ResetDataPtr->PrevStartupProfile;
+    }
+    else
+    {
+        ProfilePtr = NULL;
+    }
+
+    return ProfilePtr;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_ES_SendStartupProfileCmd() -- Telemeter startup profile     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_SendStartupProfileCmd(const CFE_ES_SendStartupProfileCmd_t *data)
+{
+    const CFE_ES_SendStartupProfileCmd_Payload_t *CmdPtr = &data->Payload;
+    CFE_ES_StartupProfileTlm_Payload_t *PayloadPtr = &CFE_ES_TaskData.StartupProfilePacket.Payload;
+    const CFE_ES_StartupProfile_t *ProfilePtr;
+
+    ProfilePtr = CFE_ES_GetStartupProfile(CmdPtr->Profile);
+    if (ProfilePtr == NULL)
+    {
+        CFE_EVS_SendEvent(CFE_ES_STARTUP_PROFILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                "Cannot telemeter startup profile. Illegal Profile (%lu)",
+                (unsigned long)CmdPtr->Profile);
+
+        /* Increment Command Error Counter */
+        CFE_ES_TaskData.CommandErrorCounter++;
+        return CFE_SUCCESS;
+    }
+
+    PayloadPtr->Profile = CmdPtr->Profile;
+
+    /* The profile is still updated by other tasks during startup */
+    CFE_ES_LockSharedData(__func__,__LINE__);
+    memcpy(&PayloadPtr->Summary, &ProfilePtr->Summary, sizeof(PayloadPtr->Summary));
+    CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+    /*
+    ** Send startup profile telemetry packet.
+    */
+    CFE_SB_TimeStampMsg(&CFE_ES_TaskData.StartupProfilePacket.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&CFE_ES_TaskData.StartupProfilePacket.TlmHeader.Msg, true);
+
+    CFE_ES_TaskData.CommandCounter++;
+    CFE_EVS_SendEvent(CFE_ES_STARTUP_PROFILE_INF_EID, CFE_EVS_EventType_DEBUG,
+            "Startup profile %lu sent, %lu entries",
+            (unsigned long)PayloadPtr->Profile, (unsigned long)PayloadPtr->Summary.NumEntries);
+
+    return CFE_SUCCESS;
+} /* End of CFE_ES_SendStartupProfileCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_ES_WriteStartupProfileCmd() -- Write startup profile to file*/
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_WriteStartupProfileCmd(const CFE_ES_WriteStartupProfileCmd_t *data)
+{
+    CFE_FS_Header_t               StdFileHeader;
+    osal_id_t                     FileDescriptor;
+    int32                         Status;
+    uint32                        i;
+    uint32                        NumWritten;
+    const CFE_ES_WriteStartupProfileCmd_Payload_t *CmdPtr = &data->Payload;
+    char                          ProfileFilename[OS_MAX_PATH_LEN];
+    const CFE_ES_StartupProfile_t *ProfilePtr;
+    CFE_ES_StartupProfileSummary_t Summary;
+    CFE_ES_StartupProfileEntry_t  Entry;
+    int32                         FileSize=0;
+
+    /* Copy the commanded filename into local buffer to ensure size limitation and to allow for modification */
+    CFE_SB_MessageStringGet(ProfileFilename, CmdPtr->FileName, CFE_PLATFORM_ES_DEFAULT_STARTUP_PROFILE_FILE,
+            sizeof(ProfileFilename), sizeof(CmdPtr->FileName));
+
+    ProfilePtr = CFE_ES_GetStartupProfile(CmdPtr->Profile);
+    if (ProfilePtr == NULL)
+    {
+        CFE_EVS_SendEvent(CFE_ES_STARTUP_PROFILE_ERR_EID,
+                CFE_EVS_EventType_ERROR,
+                "Cannot write startup profile. Illegal Profile (%lu)",
+                (unsigned long)CmdPtr->Profile);
+
+        /* Increment Command Error Counter */
+        CFE_ES_TaskData.CommandErrorCounter++;
+        return CFE_SUCCESS;
+    }
+
+    /* The profile is still updated by other tasks during startup */
+    CFE_ES_LockSharedData(__func__,__LINE__);
+    memcpy(&Summary, &ProfilePtr->Summary, sizeof(Summary));
+    CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+    /* Create a new profile file, overwriting anything that may have existed previously */
+    Status = OS_OpenCreate(&FileDescriptor, ProfileFilename,
+            OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+
+    if (Status < OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CFE_ES_STARTUP_PROFILE_ERR_EID,
+                CFE_EVS_EventType_ERROR,
+                "Error creating startup profile file '%s', Status=0x%08X",
+                ProfileFilename, (unsigned int)Status);
+
+        /* Increment Command Error Counter */
+        CFE_ES_TaskData.CommandErrorCounter++;
+        return CFE_SUCCESS;
+    }
+
+    /* Initialize the standard cFE File Header for the Profile File */
+    CFE_FS_InitHeader(&StdFileHeader, "ES Startup Profile", CFE_FS_SubType_ES_STARTUP_PROFILE);
+
+    /* Output the Standard cFE File Header to the Profile File */
+    Status = CFE_FS_WriteHeader(FileDescriptor, &StdFileHeader);
+
+    if (Status == sizeof(CFE_FS_Header_t))
+    {
+        FileSize += Status;
+        Status = OS_write(FileDescriptor, &Summary, sizeof(Summary));
+
+        if (Status == sizeof(Summary))
+        {
+            FileSize += Status;
+
+            /* Followed by one record per app or library, skipping the unused entries */
+            NumWritten = 0;
+            for (i = 0; i < CFE_ES_STARTUP_PROFILE_ENTRIES && NumWritten < Summary.NumEntries; ++i)
+            {
+                CFE_ES_LockSharedData(__func__,__LINE__);
+                memcpy(&Entry, &ProfilePtr->Entries[i], sizeof(Entry));
+                CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+                if (Entry.Name[0] == 0)
+                {
+                    continue;
+                }
+
+                Status = OS_write(FileDescriptor, &Entry, sizeof(Entry));
+                if (Status != sizeof(Entry))
+                {
+                    break;
+                }
+
+                FileSize += Status;
+                ++NumWritten;
+            }
+        }
+    }
+
+    /* We are done outputting data to the profile file.  Close it. */
+    OS_close(FileDescriptor);
+
+    if (Status >= 0 && FileSize == (sizeof(CFE_FS_Header_t) + sizeof(Summary) +
+            (Summary.NumEntries * sizeof(Entry))))
+    {
+        CFE_EVS_SendEvent(CFE_ES_STARTUP_PROFILE_INF_EID,
+                CFE_EVS_EventType_DEBUG,
+                "Startup profile %lu written to '%s', Size=%d",
+                (unsigned long)CmdPtr->Profile, ProfileFilename, (int)FileSize);
+
+        /* Increment Successful Command Counter */
+        CFE_ES_TaskData.CommandCounter++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CFE_ES_STARTUP_PROFILE_ERR_EID,
+                CFE_EVS_EventType_ERROR,
+                "Error writing startup profile to '%s', Status=0x%08X",
+                ProfileFilename, (unsigned int)Status);
+
+        /* Increment Command Error Counter */
+        CFE_ES_TaskData.CommandErrorCounter++;
+    }
+
+    return CFE_SUCCESS;
+} /* End of CFE_ES_WriteStartupProfileCmd() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CFE_ES_FileWriteByteCntErr() -- Send event to inform ground that*/
@@ -120,6 +120,29 @@ typedef struct
   */
   CFE_ES_MemStatsTlm_t MemStatsPacket;
 
+  /*
+  ** Performance marker statistics telemetry
+  */
+  CFE_ES_PerfStatsTlm_t PerfStatsPacket;
+  uint32                PerfStatsNextMarker;
+
+  /*
+  ** Startup profile telemetry
+  */
+  CFE_ES_StartupProfileTlm_t StartupProfilePacket;
+
+  /*
+  ** Task CPU utilization telemetry
+  */
+  CFE_ES_TaskUtilTlm_t  TaskUtilPacket;
+  uint32                TaskUtilNextTask;
+
+  /*
+  ** Generic counter snapshot telemetry
+  */
+  CFE_ES_GenCounterTlm_t GenCounterPacket;
+  uint32                GenCounterSequence;
+
   /*
   ** ES Task operational data (not reported in housekeeping)
   */
@@ -135,6 +158,11 @@ typedef struct
    */
   CFE_ES_PerfDumpGlobal_t    BackgroundPerfDumpState;
 
+  /*
+   * Persistent state data associated with performance log data streaming
+   */
+  CFE_ES_PerfStreamGlobal_t  BackgroundPerfStreamState;
+
   /*
    * Persistent state data associated with background app table scans
    */
@@ -166,6 +194,7 @@ int32 CFE_ES_BackgroundInit(void);
 void  CFE_ES_BackgroundTask(void);
 void  CFE_ES_BackgroundWakeup(void);
 void  CFE_ES_BackgroundCleanup(void);
+int32 CFE_ES_BackgroundCleanUpApp(CFE_ES_AppId_t AppId);
 
 /*
 ** ES Task message dispatch functions
@@ -195,6 +224,11 @@ int32 CFE_ES_SetPerfFilterMaskCmd(const CFE_ES_SetPerfFilterMaskCmd_t *data);
 int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data);
 int32 CFE_ES_SendMemPoolStatsCmd(const CFE_ES_SendMemPoolStatsCmd_t *data);
 int32 CFE_ES_DumpCDSRegistryCmd(const CFE_ES_DumpCDSRegistryCmd_t *data);
+int32 CFE_ES_WriteMemPoolProfileCmd(const CFE_ES_WriteMemPoolProfileCmd_t *data);
+int32 CFE_ES_StartPerfStreamCmd(const CFE_ES_StartPerfStreamCmd_t *data);
+int32 CFE_ES_WritePerfTraceCmd(const CFE_ES_WritePerfTraceCmd_t *data);
+int32 CFE_ES_SendStartupProfileCmd(const CFE_ES_SendStartupProfileCmd_t *data);
+int32 CFE_ES_WriteStartupProfileCmd(const CFE_ES_WriteStartupProfileCmd_t *data);
 
 /*
 ** Message Handler Helper Functions
@@ -202,6 +236,7 @@ int32 CFE_ES_DumpCDSRegistryCmd(const CFE_ES_DumpCDSRegistryCmd_t *data);
 bool CFE_ES_ValidateHandle(CFE_ES_MemHandle_t  Handle);
 bool CFE_ES_VerifyCmdLength(CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength);
 void CFE_ES_FileWriteByteCntErr(const char *Filename,size_t Requested,size_t Actual);
+void CFE_ES_SendGenCounterSnapshot(void);
 
 /*************************************************************************/
 
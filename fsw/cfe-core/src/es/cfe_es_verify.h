@@ -76,6 +76,33 @@
     #error CFE_PLATFORM_ES_APP_SCAN_RATE cannot be greater than 20 seconds!
 #endif
 
+/*
+** ES Task CPU Utilization Sampling
+*/
+#if CFE_PLATFORM_ES_TASK_UTIL_SAMPLE_MSEC  <  100
+    #error CFE_PLATFORM_ES_TASK_UTIL_SAMPLE_MSEC cannot be less than 100 milliseconds!
+#elif CFE_PLATFORM_ES_TASK_UTIL_SAMPLE_MSEC  >  20000
+    #error CFE_PLATFORM_ES_TASK_UTIL_SAMPLE_MSEC cannot be greater than 20 seconds!
+#endif
+
+#if CFE_PLATFORM_ES_TASK_UTIL_WINDOW  <  2
+    #error CFE_PLATFORM_ES_TASK_UTIL_WINDOW cannot be less than 2!
+#elif CFE_PLATFORM_ES_TASK_UTIL_WINDOW  >  100
+    #error CFE_PLATFORM_ES_TASK_UTIL_WINDOW cannot be greater than 100!
+#endif
+
+#if CFE_PLATFORM_ES_BACKGROUND_WORKERS  <  1
+    #error CFE_PLATFORM_ES_BACKGROUND_WORKERS cannot be less than 1!
+#elif CFE_PLATFORM_ES_BACKGROUND_WORKERS  >  8
+    #error CFE_PLATFORM_ES_BACKGROUND_WORKERS cannot be greater than 8!
+#endif
+
+#if CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS  <  1
+    #error CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS cannot be less than 1!
+#elif CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS  >  64
+    #error CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS cannot be greater than 64!
+#endif
+
 /*
 ** ES Application Kill Timeout 
 */
@@ -174,6 +201,35 @@
     #error CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES cannot be less than 8!
 #endif
 
+/*
+** Default CRC type, used for tables and the CDS
+*/
+#if (CFE_MISSION_ES_DEFAULT_CRC != CFE_MISSION_ES_CRC_16) && \
+    (CFE_MISSION_ES_DEFAULT_CRC != CFE_MISSION_ES_CRC_32) && \
+    (CFE_MISSION_ES_DEFAULT_CRC != CFE_MISSION_ES_CRC_32C)
+    #error CFE_MISSION_ES_DEFAULT_CRC must be CFE_MISSION_ES_CRC_16, CFE_MISSION_ES_CRC_32 or CFE_MISSION_ES_CRC_32C!
+#endif
+
+/*
+** CDS RAM shadow flush period
+*/
+#if (CFE_PLATFORM_ES_CDS_SHADOW == true) && (CFE_PLATFORM_ES_CDS_SHADOW_FLUSH_MSEC < 1)
+    #error CFE_PLATFORM_ES_CDS_SHADOW_FLUSH_MSEC cannot be less than 1!
+#endif
+
+/*
+** CDS rebuild read-ahead and validation workers
+*/
+#if CFE_PLATFORM_ES_CDS_READAHEAD_SIZE < 64
+    #error CFE_PLATFORM_ES_CDS_READAHEAD_SIZE cannot be less than 64!
+#endif
+
+#if CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS < 0
+    #error CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS cannot be less than 0!
+#elif CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS > 16
+    #error CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS cannot be greater than 16!
+#endif
+
 /* 
 ** Maximum number of processor resets before a power-on
 */
@@ -365,6 +421,9 @@
 #if ((CFE_MISSION_ES_CDS_MAX_FULL_NAME_LEN % 4) != 0)
     #error CFE_MISSION_ES_CDS_MAX_FULL_NAME_LEN must be a multiple of 4
 #endif
+#if ((CFE_MISSION_ES_GEN_COUNTER_MAX_FULL_NAME_LEN % 4) != 0)
+    #error CFE_MISSION_ES_GEN_COUNTER_MAX_FULL_NAME_LEN must be a multiple of 4
+#endif
 
 
 #endif /* _cfe_es_verify_ */
@@ -282,6 +282,9 @@ int32 CFE_EVS_TaskInit ( void )
       return Status;
    }
 
+   /* Name the performance markers used by EVS */
+   CFE_ES_PerfRegisterMarker(CFE_MISSION_EVS_MAIN_PERF_ID, "EVS_MAIN");
+
    /* Query and verify the AppID */
    Status = CFE_ES_GetAppID(&AppID);
    if (Status != CFE_SUCCESS)
@@ -131,6 +131,13 @@
 #define CFE_ES_TASK_STACK_ALLOCATE  NULL /* aka OS_TASK_STACK_ALLOCATE in proposed OSAL change */
 /** \} */
 
+/** \name Background Job Priorities */
+/** \{ */
+#define CFE_ES_BACKGROUND_PRIORITY_HIGH     0   /**< \brief Background job which should run before others, such as a health check */
+#define CFE_ES_BACKGROUND_PRIORITY_NORMAL   8   /**< \brief Default priority for background jobs */
+#define CFE_ES_BACKGROUND_PRIORITY_LOW      15  /**< \brief Background job which may wait for others, such as writing a large file */
+/** \} */
+
 
 
 
@@ -145,6 +152,15 @@
 typedef void (*CFE_ES_ChildTaskMainFuncPtr_t)(void); /**< \brief Required Prototype of Child Task Main Functions */
 typedef int32 (*CFE_ES_LibraryEntryFuncPtr_t)(CFE_ES_LibId_t LibId); /**< \brief Required Prototype of Library Initialization Functions */
 
+/**
+ * \brief Required Prototype of Background Job Functions
+ *
+ * The ElapsedTime is the number of milliseconds since the job was last called.
+ * The function should do a limited amount of work, and return true if it has
+ * more to do, or false if it is finished (idle).
+ */
+typedef bool (*CFE_ES_BackgroundJobFunc_t)(uint32 ElapsedTime, void *Arg);
+
 /**
  * @brief Type for the stack pointer of tasks.
  *
@@ -992,7 +1008,7 @@ CFE_Status_t  CFE_ES_RegisterChildTask(void);
 ** \retval #CFE_SUCCESS                  \copybrief CFE_SUCCESS
 ** \retval #CFE_ES_ERR_CHILD_TASK_CREATE \copybrief CFE_ES_ERR_CHILD_TASK_CREATE
 **
-** \sa #CFE_ES_RegisterChildTask, #CFE_ES_DeleteChildTask, #CFE_ES_ExitChildTask
+** \sa #CFE_ES_CreateChildTaskWithAffinity, #CFE_ES_RegisterChildTask, #CFE_ES_DeleteChildTask, #CFE_ES_ExitChildTask
 **
 ******************************************************************************/
 CFE_Status_t  CFE_ES_CreateChildTask(CFE_ES_TaskId_t                 *TaskIdPtr,
@@ -1003,6 +1019,52 @@ CFE_Status_t  CFE_ES_CreateChildTask(CFE_ES_TaskId_t                 *TaskIdPtr,
                                      CFE_ES_TaskPriority_Atom_t       Priority,
                                      uint32                           Flags);
 
+/*****************************************************************************/
+/**
+** \brief Creates a new task under an existing Application, on a set of CPUs
+**
+** \par Description
+**        This routine creates a new task owned by the calling Application, in the
+**        same way as #CFE_ES_CreateChildTask, and restricts it to the given CPUs.
+**
+** \par Assumptions, External Events, and Notes:
+**        The CPU affinity is applied through the PSP by the new task, before the
+**        function at FunctionPtr is called.  If the PSP cannot apply it, for example
+**        because the operating system does not support CPU affinity, the task still
+**        runs, on any CPU, and this is reported in the system log.
+**
+** \param[in, out]   TaskIdPtr     A pointer to a variable that will be filled in with the new task's ID. *TaskIdPtr is the Task ID of the newly created child task.
+**
+** \param[in]   TaskName      A pointer to a string containing the desired name of the new task.
+**                            This can be up to #OS_MAX_API_NAME characters, including the trailing null.
+**
+** \param[in]   FunctionPtr   A pointer to the function that will be spawned as a new task.
+**
+** \param[in]   StackPtr      A pointer to the location where the child task's stack pointer should start,
+**                            or CFE_ES_TASK_STACK_ALLOCATE.
+**
+** \param[in]   StackSize     The number of bytes to allocate for the new task's stack.
+**
+** \param[in]   Priority      The priority for the new task.  Lower numbers are higher priority.
+**
+** \param[in]   CpuAffinity   The CPUs that the new task may run on, as a mask with one bit per CPU
+**                            (bit 0 is CPU 0), or 0 to let the OS place the task on any CPU.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                  \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_CHILD_TASK_CREATE \copybrief CFE_ES_ERR_CHILD_TASK_CREATE
+**
+** \sa #CFE_ES_CreateChildTask, #CFE_ES_RegisterChildTask, #CFE_ES_DeleteChildTask, #CFE_ES_ExitChildTask
+**
+******************************************************************************/
+CFE_Status_t  CFE_ES_CreateChildTaskWithAffinity(CFE_ES_TaskId_t                 *TaskIdPtr,
+                                     const char                      *TaskName,
+                                     CFE_ES_ChildTaskMainFuncPtr_t    FunctionPtr,
+                                     CFE_ES_StackPointer_t            StackPtr,
+                                     size_t                           StackSize,
+                                     CFE_ES_TaskPriority_Atom_t       Priority,
+                                     uint32                           CpuAffinity);
+
 /*****************************************************************************/
 /**
 ** \brief Get a Task ID associated with a specified Task name
@@ -1101,6 +1163,65 @@ CFE_Status_t CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId);
 void CFE_ES_ExitChildTask(void);
 /**@}*/
 
+/** @defgroup CFEAPIESBackground cFE Background Job APIs
+ * @{
+ */
+
+/*****************************************************************************/
+/**
+** \brief Submits a job to be run by the ES background tasks
+**
+** \par Description
+**        This routine queues a job to be run incrementally by the ES
+**        background worker tasks, instead of on the calling task.  This is
+**        intended for low priority work which may take time, such as writing
+**        a file, which should not be done on an application's command path.
+**
+**        The job function is called repeatedly, with the given argument,
+**        for as long as it returns true.  Each call should do a limited
+**        amount of work and return.  Once the function returns false the
+**        job is complete and it is removed.
+**
+**        The job is called again no later than PeriodMsec after each call
+**        returns, or sooner if the background tasks are woken up.  When
+**        several jobs are due, the job with the highest priority (lowest
+**        value) runs first, and jobs of equal priority run in the order in
+**        which they became due.  A job which has waited more than
+**        DeadlineMsec since it became due runs before jobs which have not
+**        missed their deadline, whatever their priority.  Each job is only
+**        run by one background task at a time.
+**
+** \par Assumptions, External Events, and Notes:
+**        The job function runs on an ES background task, so it must not
+**        block for long periods and must protect any data it shares with
+**        the calling application.  Any jobs submitted by an application
+**        are removed when the application is deleted or restarted, which
+**        waits for a call that is in progress to return.
+**
+** \param[in]   JobFunc     The function to call to do the work.
+**
+** \param[in]   JobArg      The argument to pass to the function.
+**
+** \param[in]   Priority    The priority of the job, see #CFE_ES_BACKGROUND_PRIORITY_NORMAL.
+**                          Lower values are higher priority.
+**
+** \param[in]   PeriodMsec  The maximum time between calls, in milliseconds.  Must not be zero.
+**
+** \param[in]   DeadlineMsec The maximum time the job should wait to be called once it is
+**                          due, in milliseconds, or zero if the job has no deadline.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT              \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE \copybrief CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID  \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_SubmitBackgroundJob(CFE_ES_BackgroundJobFunc_t JobFunc, void *JobArg, uint16 Priority,
+        uint32 PeriodMsec, uint32 DeadlineMsec);
+
+/**@}*/
+
 /** @defgroup CFEAPIESMisc cFE Miscellaneous APIs
  * @{
  */
@@ -1138,7 +1259,8 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1,2)
 **        used is determined by the last parameter. 
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        To calculate the CRC of several blocks as a single value, pass the
+**        result for the previous block as the InputCRC of the next block.
 **
 ** \param[in]   DataPtr     Pointer to the base of the memory block.
 **
@@ -1151,7 +1273,8 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1,2)
 ** \param[in]   TypeCRC     One of the following CRC algorithm selections:
 **                          \arg \c CFE_MISSION_ES_CRC_8 - (Not currently implemented)
 **                          \arg \c CFE_MISSION_ES_CRC_16 - a CRC-16 algorithm
-**                          \arg \c CFE_MISSION_ES_CRC_32 - (not currently implemented)
+**                          \arg \c CFE_MISSION_ES_CRC_32 - the IEEE 802.3 CRC-32 algorithm
+**                          \arg \c CFE_MISSION_ES_CRC_32C - the CRC-32C (Castagnoli) algorithm
 **
 ** \return The result of the CRC calculation on the specified memory block, or error code \ref CFEReturnCodes
 **
@@ -1296,6 +1419,42 @@ CFE_Status_t CFE_ES_GetCDSBlockName(char *BlockName, CFE_ES_CDSHandle_t BlockId,
 */
 CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy);
 
+/*****************************************************************************/
+/**
+** \brief Save part of a block of data in the Critical Data Store (CDS)
+**
+** \par Description
+**        This routine copies a range of memory into a Critical Data Store block that
+**        had been previously registered via #CFE_ES_RegisterCDS.  Only the specified
+**        range of the block is written, and the CRC of the block is updated from the
+**        changed bytes rather than recomputed over the whole block.  This is intended
+**        for applications that keep a large block in the CDS but change only a small
+**        part of it at a time.
+**
+** \par Assumptions, External Events, and Notes:
+**        The whole block should have been written at least once with #CFE_ES_CopyToCDS
+**        (or restored with #CFE_ES_RestoreFromCDS) before partial updates are made, so
+**        the stored CRC matches the stored content.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \param[in]   DataToCopy   A Pointer to the memory to be copied into the CDS at the given offset.
+**
+** \param[in]   Offset       The offset, in bytes, within the CDS block to copy the data to.
+**
+** \param[in]   Size         The number of bytes to copy.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_CDS_INVALID_SIZE           \copybrief CFE_ES_CDS_INVALID_SIZE
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+**
+** \sa #CFE_ES_RegisterCDS, #CFE_ES_CopyToCDS, #CFE_ES_RestoreFromCDS
+**
+*/
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size);
+
 /*****************************************************************************/
 /**
 ** \brief Recover a block of data from the Critical Data Store (CDS)
@@ -1609,7 +1768,11 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
 **        tool (see section 5.15).    
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        If performance marker statistics are enabled on the platform, the
+**        time from each entry to the following exit of a marker is also
+**        accumulated in the statistics of the marker, whether or not the
+**        performance data collection is running.  The statistics are reported
+**        in the #CFE_ES_PerfStatsTlm_t telemetry packet.
 **
 ** \param[in]   Marker          Identifier of the specific event or marker.
 ** \param[in]   EntryExit       Used to specify Entry(0) or Exit(1)
@@ -1618,6 +1781,35 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
 **
 ******************************************************************************/
 void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit);
+
+/*****************************************************************************/
+/**
+** \brief Registers a name for a performance marker
+**
+** \par Description
+**        This function associates a name with the specified performance
+**        marker \c id.  The name is used to identify the marker when the
+**        performance data is written as a trace (see #CFE_ES_WRITE_PERF_TRACE_CC)
+**        and in the performance marker statistics telemetry.  Markers without a
+**        registered name are identified by their number.
+**
+** \par Assumptions, External Events, and Notes:
+**        This should be called by the application that owns the marker during
+**        its initialization.  Registering a name for a marker that already has
+**        one replaces the previous name.  The name may not contain double quotes,
+**        backslashes or control characters.
+**
+** \param[in]   Marker          Identifier of the specific event or marker.
+** \param[in]   MarkerName      Name of the marker.  Must be shorter than #OS_MAX_API_NAME.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT        \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_PerfLogEntry, #CFE_ES_PerfLogExit
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_PerfRegisterMarker(uint32 Marker, const char *MarkerName);
 /**@}*/
 
 /** @defgroup CFEAPIESGenCount cFE Generic Counter APIs
@@ -1647,6 +1839,36 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit);
 ******************************************************************************/
 CFE_Status_t CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *CounterName);
 
+/*****************************************************************************/
+/**
+** \brief Register a generic counter under the calling application's name
+**
+** \par Description
+**        This routine registers a generic counter named "AppName.CounterName",
+**        where AppName is the name of the calling application.  Each application
+**        can therefore use its own counter names without clashing with other
+**        applications.
+**
+** \par Assumptions, External Events, and Notes:
+**        The counter is deleted when the application is deleted, restarted or reloaded.
+**        The counter can be looked up by its full name with #CFE_ES_GetGenCounterIDByName.
+**
+** \param[in]  *CounterName   The Name of the generic counter, of fewer than #OS_MAX_API_NAME
+**                            characters, not including the application name.
+**
+** \param[out] *CounterIdPtr  The Counter Id of the newly created counter.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT              \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_ERR_DUPLICATE_NAME        \copybrief CFE_ES_ERR_DUPLICATE_NAME
+** \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE \copybrief CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+**
+** \sa #CFE_ES_RegisterGenCounter, #CFE_ES_IncrementGenCounter, #CFE_ES_AddGenCounter, #CFE_ES_DeleteGenCounter
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_RegisterAppGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *CounterName);
+
 /*****************************************************************************/
 /**
 ** \brief Delete a generic counter
@@ -1676,7 +1898,9 @@ CFE_Status_t CFE_ES_DeleteGenCounter(CFE_ES_CounterId_t CounterId);
 **        This routine increments the specified generic counter. 
 **
 ** \par Assumptions, External Events, and Notes:
-**        None.
+**        Where the compiler provides atomic operations the counter is incremented
+**        without taking the ES lock, so this can be called from any task.
+**        The counter wraps around to 0 after the maximum uint32 value.
 **
 ** \param[in]   CounterId    The Counter to be incremented.
 **
@@ -1689,6 +1913,31 @@ CFE_Status_t CFE_ES_DeleteGenCounter(CFE_ES_CounterId_t CounterId);
 ******************************************************************************/
 CFE_Status_t CFE_ES_IncrementGenCounter(CFE_ES_CounterId_t CounterId);
 
+/*****************************************************************************/
+/**
+** \brief Adds an amount to the specified generic counter
+**
+** \par Description
+**        This routine adds the given amount to the specified generic counter.
+**
+** \par Assumptions, External Events, and Notes:
+**        As with #CFE_ES_IncrementGenCounter, the counter is updated without taking
+**        the ES lock where the compiler provides atomic operations.
+**        The counter wraps around to 0 after the maximum uint32 value.
+**
+** \param[in]   CounterId    The Counter to be added to.
+**
+** \param[in]   Amount       The amount to add to the Counter.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_RegisterGenCounter, #CFE_ES_IncrementGenCounter, #CFE_ES_SetGenCount, #CFE_ES_GetGenCount
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_AddGenCounter(CFE_ES_CounterId_t CounterId, uint32 Amount);
+
 /*****************************************************************************/
 /**
 ** \brief Set the specified generic counter
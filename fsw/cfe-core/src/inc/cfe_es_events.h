@@ -43,7 +43,7 @@
 ** and when you're done adding, set this to the highest EID you used. It may
 ** be worthwhile to, on occasion, re-number the EID's to put them back in order.
 */
-#define CFE_ES_MAX_EID            92
+#define CFE_ES_MAX_EID            100
 
 /*
 ** ES task event message ID's.
@@ -964,6 +964,10 @@
 **  A performance data entry is defined by an unsigned 32 bit data point and an unsigned 64 bit time stamp.
 **  The second \c 'd' identifies the millisecond delay between writes and the 
 **  third \c 'd' identifies the number of entries written (in decimal) between delays. 
+**
+**  If a performance data stream is active, the message is instead
+**  <tt> 'Perf Stop Cmd Rcvd, ending stream to \%s' </tt>, where the \c 's' field
+**  identifies the name of the stream.
 **/
 #define CFE_ES_PERF_STOPCMD_EID       60
 
@@ -1463,6 +1467,151 @@
 **/
 #define CFE_ES_ERLOG_PENDING_ERR_EID    93
 
+/** \brief <tt> 'Memory pool profile written to '\%s', Size=\%d' </tt>
+**  \event <tt> 'Memory pool profile written to '\%s', Size=\%d' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services
+**  \link #CFE_ES_WRITE_MEM_POOL_PROFILE_CC Write Memory Pool Profile Command \endlink
+**  is successfully executed.
+**
+**  The \c 's' field identifies the name of the file written and the
+**  \c 'd' field specifies the size of the file (in bytes).
+**/
+#define CFE_ES_POOL_PROFILE_INF_EID     94
+
+/** \brief <tt> 'Error writing memory pool profile to '\%s', Status=0x\%08X' </tt>
+**  \event <tt> 'Error writing memory pool profile to '\%s', Status=0x\%08X' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services
+**  \link #CFE_ES_WRITE_MEM_POOL_PROFILE_CC Write Memory Pool Profile Command \endlink
+**  specifies a handle that is not a valid memory pool, or is unable to
+**  create or write the specified file.
+**
+**  The \c 's' field identifies the name of the file and the \c '08X' field
+**  identifies the error code returned from the failing API.
+**/
+#define CFE_ES_POOL_PROFILE_ERR_EID     95
+
+/** \brief <tt> 'Start streaming performance data to \%s, roll every \%lu entries' </tt>
+**  \event <tt> 'Start streaming performance data to \%s, roll every \%lu entries' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services
+**  \link #CFE_ES_START_PERF_STREAM_CC Start Streaming Performance Analyzer Data Command \endlink
+**  is successfully executed.
+**
+**  The \c 's' field identifies the name of the stream and the \c 'lu' field
+**  identifies the number of entries per file (zero if the data is not split).
+**/
+#define CFE_ES_PERF_STREAMCMD_EID       96
+
+/** \brief <tt> 'Cannot start streaming performance data, perf data write in progress' </tt>
+**  \event <tt> 'Cannot start streaming performance data, perf data write in progress' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services
+**  \link #CFE_ES_START_PERF_STREAM_CC Start Streaming Performance Analyzer Data Command \endlink
+**  is received while a performance data file is being written or a performance
+**  data stream is still active.
+**/
+#define CFE_ES_PERF_STREAMCMD_ERR_EID   97
+
+/** \brief <tt> 'Perf stream to \%s complete:Files=\%lu,EntryCount=\%lu,Lost=\%lu' </tt>
+**  \event <tt> 'Perf stream to \%s complete:Files=\%lu,EntryCount=\%lu,Lost=\%lu' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This event message is generated when a performance data stream is closed,
+**  after it was stopped or after an error writing the data.
+**
+**  The \c 's' field identifies the name of the stream, and the \c 'lu' fields
+**  identify the number of files opened, the number of entries written, and the
+**  number of entries which were overwritten before they could be written.
+**/
+#define CFE_ES_PERF_STREAM_EID          98
+
+/** \brief <tt> 'Perf Trace Cmd Rcvd, will write \%d entries to \%s' </tt>
+**  \event <tt> 'Perf Trace Cmd Rcvd, will write \%d entries to \%s' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This event message is generated upon receipt of a successful Executive Services
+**  \link #CFE_ES_WRITE_PERF_TRACE_CC Stop Performance Analyzer and Write Trace File Command \endlink
+**
+**  The \c 'd' field identifies the number of performance entries that will be written
+**  and the \c 's' field identifies the name of the trace file.
+**/
+#define CFE_ES_PERF_TRACECMD_EID        99
+
+/** \brief <tt> 'Perf trace cmd ignored, perf data write in progress' </tt>
+**  \event <tt> 'Perf trace cmd ignored, perf data write in progress' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services
+**  \link #CFE_ES_WRITE_PERF_TRACE_CC Stop Performance Analyzer and Write Trace File Command \endlink
+**  is received while a performance data file is being written or a performance
+**  data stream is active.
+**/
+#define CFE_ES_PERF_TRACECMD_ERR_EID    100
+
+/** \brief <tt> 'Startup profile \%lu sent, \%lu entries' </tt>
+**  \event <tt> 'Startup profile \%lu sent, \%lu entries' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services
+**  \link #CFE_ES_SEND_STARTUP_PROFILE_CC Telemeter Startup Profile Command \endlink
+**  or \link #CFE_ES_WRITE_STARTUP_PROFILE_CC Write Startup Profile Command \endlink
+**  is successfully executed.  When the profile is written to a file, the
+**  event text is <tt> 'Startup profile \%lu written to '\%s', Size=\%d' </tt>.
+**
+**  The \c 'lu' fields identify the profile and the number of app and library
+**  entries in it, and the \c 's' and \c 'd' fields identify the name and size
+**  (in bytes) of the file written.
+**/
+#define CFE_ES_STARTUP_PROFILE_INF_EID  101
+
+/** \brief <tt> 'Error writing startup profile to '\%s', Status=0x\%08X' </tt>
+**  \event <tt> 'Error writing startup profile to '\%s', Status=0x\%08X' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services
+**  \link #CFE_ES_SEND_STARTUP_PROFILE_CC Telemeter Startup Profile Command \endlink
+**  or \link #CFE_ES_WRITE_STARTUP_PROFILE_CC Write Startup Profile Command \endlink
+**  specifies a profile which is neither the current nor the previous one, or
+**  is unable to create or write the specified file.
+**
+**  The \c 's' field identifies the name of the file and the \c '08X' field
+**  identifies the error code returned from the failing API.
+**/
+#define CFE_ES_STARTUP_PROFILE_ERR_EID  102
+
 
 #endif /* _cfe_es_events_ */
 
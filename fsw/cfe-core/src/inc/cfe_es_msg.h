@@ -651,6 +651,9 @@
 **
 **  \par Description
 **       This command stops the Performance Analyzer from collecting any more data.
+**       If performance data is being streamed (see #CFE_ES_START_PERF_STREAM_CC),
+**       the remaining data is written to the stream and the stream is closed,
+**       instead of writing the data to the file specified in this command.
 **
 **  \cfecmdmnemonic \ES_STOPLADATA
 **
@@ -1056,6 +1059,268 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC     24
 
+/** \cfeescmd Writes a Memory Pool Allocation Profile to a File
+**
+**  \par Description
+**       This command writes the allocation profile of the specified memory
+**       pool to a file.  The file contains a #CFE_ES_MemPoolProfile_t record
+**       with the usage of each block size, including the peak number of blocks
+**       in use and the bytes that are not holding requested data, followed by
+**       a #CFE_ES_MemPoolSizeProfile_t record for each range of requested sizes.
+**
+**       The profile record also contains a suggested list of block sizes that
+**       would have served the recorded requests with the least memory, which
+**       can be used to tune the block size configuration of the pool (e.g. the
+**       CFE_PLATFORM_SB_MEM_BLOCK_SIZE_xx values for the Software Bus pool).
+**
+**       The size distribution is only recorded if the
+**       #CFE_PLATFORM_ES_MEMPOOL_PROFILE configuration parameter is true.
+**
+**  \cfecmdmnemonic \ES_WRITEPOOLPROFILE2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WriteMemPoolProfileCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with 
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will 
+**         increment
+**       - The #CFE_ES_POOL_PROFILE_INF_EID debug event message will be 
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_POOL_PROFILE_FILE configuration parameter) will be 
+**         updated with the lastest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**       - The specified handle is not a valid memory pool handle
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error 
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new 
+**       file in the file system (or overwrite an existing one) and could, 
+**       if performed repeatedly without sufficient file management by the 
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_SEND_MEM_POOL_STATS_CC
+*/
+#define CFE_ES_WRITE_MEM_POOL_PROFILE_CC   25
+
+/** \cfeescmd Start Streaming Performance Analyzer Data
+**
+**  \par Description
+**       This command causes the Performance Analyzer to begin collecting data
+**       continuously, while the data is written out by a background task.
+**       Unlike #CFE_ES_START_PERF_DATA_CC, the amount of data is not limited
+**       by the size of the Performance Analyzer buffer and the trigger masks
+**       are not used.
+**
+**       The data is written to the file specified in the command.  This may
+**       also be a FIFO or device, which allows the data to be read by another
+**       process while it is being collected.  If a non-zero number of roll
+**       entries is specified, the data is instead split into files of that
+**       many entries each, named by appending ".0", ".1", etc. to the
+**       filename, and at most #CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES files
+**       are kept.  Each file has the same format as the file written by
+**       #CFE_ES_STOP_PERF_DATA_CC.  If the data is not split, the entry count
+**       in the file header is zero and the entries continue to the end of
+**       the file.
+**
+**       The stream is ended with the #CFE_ES_STOP_PERF_DATA_CC command, which
+**       writes the remaining entries and closes the file in this case.
+**
+**  \cfecmdmnemonic \ES_STREAMLADATA
+**
+**  \par Command Structure
+**       #CFE_ES_StartPerfStreamCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with 
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will 
+**         increment
+**       - \b \c \ES_PERFSTATE - Current performance analyzer state will change to
+**         STREAMING.
+**       - The #CFE_ES_PERF_STREAMCMD_EID debug event message will be 
+**         generated.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**       - A previous #CFE_ES_STOP_PERF_DATA_CC command has not completely finished.
+**       - A performance data stream is already active.
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error 
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous but may cause a small increase in CPU
+**       utilization as the performance analyzer data is collected and written.  The
+**       amount of data written is not limited when the data is not split into files,
+**       and could fill the file system if the stream is not stopped.
+**
+**  \sa #CFE_ES_START_PERF_DATA_CC, #CFE_ES_STOP_PERF_DATA_CC, #CFE_ES_SET_PERF_FILTER_MASK_CC
+*/
+#define CFE_ES_START_PERF_STREAM_CC        26
+
+/** \cfeescmd Stop Performance Analyzer and Write Trace File
+**
+**  \par Description
+**       This command stops the Performance Analyzer from collecting any more data,
+**       like #CFE_ES_STOP_PERF_DATA_CC, but writes the data as a trace file in the
+**       Chrome trace event JSON format instead of the binary format.  This file can
+**       be viewed directly with standard trace viewers such as chrome://tracing or
+**       the Perfetto UI.
+**
+**       Each entry and exit marker becomes the begin or end of a slice on a track
+**       for that marker.  Markers are named by the name registered with
+**       #CFE_ES_PerfRegisterMarker, if any, or else by their number.  The
+**       timestamps are converted to microseconds.
+**
+**  \cfecmdmnemonic \ES_WRITELATRACE
+**
+**  \par Command Structure
+**       #CFE_ES_WritePerfTraceCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with 
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will 
+**         increment
+**       - \b \c \ES_PERFSTATE - Current performance analyzer state will change to
+**         IDLE. 
+**       - The #CFE_ES_PERF_TRACECMD_EID debug event message will be 
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_PERF_TRACE_FILENAME configuration parameter) will be 
+**         updated with the lastest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**       - A previous Stop Performance Analyzer command is still in process
+**       - A performance data stream is active
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error 
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new 
+**       file in the file system (or overwrite an existing one) and could, 
+**       if performed repeatedly without sufficient file management by the 
+**       operator, fill the file system.  The trace file is several times
+**       larger than the binary file.
+**
+**  \sa #CFE_ES_START_PERF_DATA_CC, #CFE_ES_STOP_PERF_DATA_CC
+*/
+#define CFE_ES_WRITE_PERF_TRACE_CC         27
+
+/** \cfeescmd Telemeter Startup Profile
+**
+**  \par Description
+**       This command sends the summary of the startup profile, which records
+**       how long each phase of the cFE startup took, in the
+**       \link #CFE_ES_StartupProfileTlm_t Startup Profile Telemetry Packet \endlink.
+**
+**       The profile is kept in the reset area.  On a processor reset, the
+**       profile of the boot before the reset is kept as the previous profile,
+**       so the startup that led to the reset can also be examined.  The
+**       command selects which of the two profiles is sent.
+**
+**  \cfecmdmnemonic \ES_TLMSTARTUPPROFILE
+**
+**  \par Command Structure
+**       #CFE_ES_SendStartupProfileCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with 
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will 
+**         increment
+**       - The #CFE_ES_STARTUP_PROFILE_INF_EID debug event message will be 
+**         generated.
+**       - The \link #CFE_ES_StartupProfileTlm_t Startup Profile Telemetry Packet \endlink
+**         is produced
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**       - The requested profile is not #CFE_ES_STARTUP_PROFILE_CURRENT or
+**         #CFE_ES_STARTUP_PROFILE_PREVIOUS
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error 
+**         cases
+**
+**  \par Criticality
+**       None
+**
+**  \sa #CFE_ES_WRITE_STARTUP_PROFILE_CC
+*/
+#define CFE_ES_SEND_STARTUP_PROFILE_CC     28
+
+/** \cfeescmd Writes the Startup Profile to a File
+**
+**  \par Description
+**       This command writes the startup profile to a file.  The file contains
+**       the #CFE_ES_StartupProfileSummary_t record with the end time of each
+**       startup phase, followed by a #CFE_ES_StartupProfileEntry_t record for
+**       each core app, startup script app and library, with the times it was
+**       loaded, registered and initialized.
+**
+**       All times are in microseconds since the entry to CFE_ES_Main.  Only
+**       the events before the system reaches the OPERATIONAL state are recorded.
+**
+**  \cfecmdmnemonic \ES_WRITESTARTUPPROFILE2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WriteStartupProfileCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with 
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will 
+**         increment
+**       - The #CFE_ES_STARTUP_PROFILE_INF_EID debug event message will be 
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_STARTUP_PROFILE_FILE configuration parameter) will be 
+**         updated with the lastest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**       - The requested profile is not #CFE_ES_STARTUP_PROFILE_CURRENT or
+**         #CFE_ES_STARTUP_PROFILE_PREVIOUS
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error 
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new 
+**       file in the file system (or overwrite an existing one) and could, 
+**       if performed repeatedly without sufficient file management by the 
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_SEND_STARTUP_PROFILE_CC
+*/
+#define CFE_ES_WRITE_STARTUP_PROFILE_CC    29
+
 
 /** \} */
 
@@ -1420,6 +1685,116 @@ typedef struct CFE_ES_DumpCDSRegistryCmd
     CFE_ES_DumpCDSRegistryCmd_Payload_t Payload;   /**< \brief Command payload */
 } CFE_ES_DumpCDSRegistryCmd_t;
 
+/**
+** \brief Write Memory Pool Profile Command Payload
+**
+** For command details, see #CFE_ES_WRITE_MEM_POOL_PROFILE_CC
+**
+**/
+typedef struct CFE_ES_WriteMemPoolProfileCmd_Payload
+{
+  CFE_ES_MemHandle_t    PoolHandle;                             /**< \brief Handle of Pool whose profile is to be written */
+  char                  FileName[CFE_MISSION_MAX_PATH_LEN];     /**< \brief ASCII text string of full path and filename 
+                                                                     of file the profile is to be written to */
+} CFE_ES_WriteMemPoolProfileCmd_Payload_t;
+
+/**
+ * \brief Write Memory Pool Profile Command
+ */
+typedef struct CFE_ES_WriteMemPoolProfileCmd
+{
+    CFE_MSG_CommandHeader_t                 CmdHeader; /**< \brief Command header */
+    CFE_ES_WriteMemPoolProfileCmd_Payload_t Payload;   /**< \brief Command payload */
+} CFE_ES_WriteMemPoolProfileCmd_t;
+
+/**
+** \brief Start Streaming Performance Analyzer Data Command Payload
+**
+** For command details, see #CFE_ES_START_PERF_STREAM_CC
+**
+**/
+typedef struct CFE_ES_StartPerfStreamCmd_Payload
+{
+  char                  StreamName[CFE_MISSION_MAX_PATH_LEN];   /**< \brief ASCII text string of full path and filename 
+                                                                     of file Performance Analyzer data is to be streamed to */
+  uint32                RollEntries;                            /**< \brief Number of entries per file, or zero to write
+                                                                     all entries to a single file */
+} CFE_ES_StartPerfStreamCmd_Payload_t;
+
+/**
+ * \brief Start Streaming Performance Analyzer Data Command
+ */
+typedef struct CFE_ES_StartPerfStreamCmd
+{
+    CFE_MSG_CommandHeader_t             CmdHeader; /**< \brief Command header */
+    CFE_ES_StartPerfStreamCmd_Payload_t Payload;   /**< \brief Command payload */
+} CFE_ES_StartPerfStreamCmd_t;
+
+/**
+** \brief Write Performance Analyzer Trace File Command Payload
+**
+** For command details, see #CFE_ES_WRITE_PERF_TRACE_CC
+**
+**/
+typedef struct CFE_ES_WritePerfTraceCmd_Payload
+{
+  char                  FileName[CFE_MISSION_MAX_PATH_LEN];     /**< \brief ASCII text string of full path and filename 
+                                                                     of file the trace is to be written to */
+} CFE_ES_WritePerfTraceCmd_Payload_t;
+
+/**
+ * \brief Write Performance Analyzer Trace File Command
+ */
+typedef struct CFE_ES_WritePerfTraceCmd
+{
+    CFE_MSG_CommandHeader_t            CmdHeader; /**< \brief Command header */
+    CFE_ES_WritePerfTraceCmd_Payload_t Payload;   /**< \brief Command payload */
+} CFE_ES_WritePerfTraceCmd_t;
+
+/**
+** \brief Send Startup Profile Command Payload
+**
+** For command details, see #CFE_ES_SEND_STARTUP_PROFILE_CC
+**
+**/
+typedef struct CFE_ES_SendStartupProfileCmd_Payload
+{
+  uint32                Profile;                                /**< \brief #CFE_ES_STARTUP_PROFILE_CURRENT or
+                                                                     #CFE_ES_STARTUP_PROFILE_PREVIOUS */
+} CFE_ES_SendStartupProfileCmd_Payload_t;
+
+/**
+ * \brief Send Startup Profile Command
+ */
+typedef struct CFE_ES_SendStartupProfileCmd
+{
+    CFE_MSG_CommandHeader_t                CmdHeader; /**< \brief Command header */
+    CFE_ES_SendStartupProfileCmd_Payload_t Payload;   /**< \brief Command payload */
+} CFE_ES_SendStartupProfileCmd_t;
+
+/**
+** \brief Write Startup Profile Command Payload
+**
+** For command details, see #CFE_ES_WRITE_STARTUP_PROFILE_CC
+**
+**/
+typedef struct CFE_ES_WriteStartupProfileCmd_Payload
+{
+  char                  FileName[CFE_MISSION_MAX_PATH_LEN];     /**< \brief ASCII text string of full path and filename 
+                                                                     of file the profile is to be written to */
+  uint32                Profile;                                /**< \brief #CFE_ES_STARTUP_PROFILE_CURRENT or
+                                                                     #CFE_ES_STARTUP_PROFILE_PREVIOUS */
+} CFE_ES_WriteStartupProfileCmd_Payload_t;
+
+/**
+ * \brief Write Startup Profile Command
+ */
+typedef struct CFE_ES_WriteStartupProfileCmd
+{
+    CFE_MSG_CommandHeader_t                 CmdHeader; /**< \brief Command header */
+    CFE_ES_WriteStartupProfileCmd_Payload_t Payload;   /**< \brief Command payload */
+} CFE_ES_WriteStartupProfileCmd_t;
+
 /*************************************************************************/
 
 /************************************/
@@ -1481,6 +1856,8 @@ typedef struct CFE_ES_AppInfo
                                                     \brief The Application's Main Task ID */
    uint32   NumOfChildTasks;                   /**< \cfetlmmnemonic \ES_CHILDTASKS
                                                     \brief Number of Child tasks for an App */
+   uint32   CpuAffinity;                       /**< \cfetlmmnemonic \ES_CPUAFFINITY
+                                                    \brief CPUs the Application's Main Task may run on, one bit per CPU, 0 if any CPU */
 
 } CFE_ES_AppInfo_t;
 
@@ -1502,8 +1879,50 @@ typedef struct CFE_ES_TaskInfo
    char                TaskName[CFE_MISSION_MAX_API_LEN]; /**< \brief Task Name */
    CFE_ES_AppId_t      AppId;                             /**< \brief Parent Application ID */
    char                AppName[CFE_MISSION_MAX_API_LEN];  /**< \brief Parent Application Name */
+   uint32              CpuAffinity;                       /**< \brief CPUs the task may run on, one bit per CPU, 0 if any CPU */
+   uint32              CpuTimeSeconds;                    /**< \brief CPU time used by the task, whole seconds part */
+   uint32              CpuTimeMicroseconds;               /**< \brief CPU time used by the task, microseconds part */
+   uint32              CpuUtilization;                    /**< \brief CPU utilization of the task over the utilization
+                                                               window, in hundredths of a percent of one CPU */
 } CFE_ES_TaskInfo_t;
 
+/**
+ * \brief Task CPU Utilization
+ *
+ * Structure that is used to provide the CPU time and utilization of a task
+ * in the task CPU utilization telemetry packet.  The CPU time is as of the
+ * last sample, and the utilization is over the samples in the utilization
+ * window.  Both are 0 if the CPU time of the task cannot be sampled.
+ *
+ * \sa #CFE_ES_TaskUtilTlm_t
+ */
+typedef struct CFE_ES_TaskUtil
+{
+    CFE_ES_TaskId_t       TaskId;                  /**< \brief Task Id */
+    CFE_ES_AppId_t        AppId;                   /**< \brief Parent Application ID */
+    char                  TaskName[CFE_MISSION_MAX_API_LEN]; /**< \brief Task Name */
+    uint32                CpuTimeSeconds;          /**< \brief CPU time used by the task, whole seconds part */
+    uint32                CpuTimeMicroseconds;     /**< \brief CPU time used by the task, microseconds part */
+    uint32                CpuUtilization;          /**< \brief CPU utilization, in hundredths of a percent of one CPU */
+    uint32                WindowMsec;              /**< \brief Time covered by the samples of CpuUtilization, in milliseconds */
+} CFE_ES_TaskUtil_t;
+
+/**
+ * \brief Generic Counter Value
+ *
+ * Structure that is used to provide the value of a generic counter in the
+ * generic counter snapshot telemetry packet.  Counters registered by an
+ * application are named in "AppName.CounterName" form.
+ *
+ * \sa #CFE_ES_GenCounterTlm_t
+ */
+typedef struct CFE_ES_GenCounterValue
+{
+    CFE_ES_CounterId_t    CounterId;               /**< \brief Counter Id */
+    uint32                Count;                   /**< \brief Value of the counter */
+    char                  CounterName[CFE_MISSION_ES_GEN_COUNTER_MAX_FULL_NAME_LEN]; /**< \brief Counter Name */
+} CFE_ES_GenCounterValue_t;
+
 /**
  * \brief CDS Register Dump Record
  *
@@ -1560,6 +1979,170 @@ typedef struct CFE_ES_MemPoolStats
                                                                             \brief Contains stats on each block size */
 } CFE_ES_MemPoolStats_t;
 
+/**
+ * \brief Block profile
+ *
+ * Sub-Structure that is used to provide allocation profile information
+ * about a specific block size/bucket within a memory pool.
+ */
+typedef struct CFE_ES_BlockProfile
+{
+    CFE_ES_MemOffset_t BlockSize;       /**< \brief Number of bytes in each of these blocks */
+    uint32  NumCreated;                 /**< \brief Number of Memory Blocks of this size created */
+    uint32  NumFree;                    /**< \brief Number of Memory Blocks of this size that are free */
+    uint32  PeakInUse;                  /**< \brief Highest number of Memory Blocks of this size in use at the same time */
+    CFE_ES_MemOffset_t RequestedBytes;  /**< \brief Sum of the sizes requested for the blocks currently in use */
+    CFE_ES_MemOffset_t UnusedBytes;     /**< \brief Bytes in blocks of this size that do not hold requested data,
+                                             which includes all free blocks and the unused end of blocks in use */
+} CFE_ES_BlockProfile_t;
+
+/**
+ * \brief Memory Pool Profile
+ *
+ * Structure that is used to provide allocation profile information
+ * about a memory pool.  This is the first record in the file written by
+ * the Write Memory Pool Profile command.
+ *
+ * The average block sizes are computed from the recorded size distribution,
+ * assuming every request in a size range is as large as the largest one.
+ *
+ * \sa #CFE_ES_WRITE_MEM_POOL_PROFILE_CC
+ */
+typedef struct CFE_ES_MemPoolProfile
+{
+    CFE_ES_MemHandle_t    PoolHandle;              /**< \brief Handle of memory pool */
+    CFE_ES_MemOffset_t    PoolSize;                /**< \brief Size of Memory Pool (in bytes) */
+    CFE_ES_MemOffset_t    NumFreeBytes;            /**< \brief Number of bytes never allocated to a block */
+    uint32                NumBlocksRequested;      /**< \brief Number of times a memory block has been allocated */
+    uint32                NumBlockSizes;           /**< \brief Number of valid entries in BlockProfile */
+    uint32                NumSuggestedSizes;       /**< \brief Number of valid entries in SuggestedBlockSizes */
+    uint32                NumSizeRanges;           /**< \brief Number of #CFE_ES_MemPoolSizeProfile_t records which follow */
+    CFE_ES_MemOffset_t    AvgBlockSize;            /**< \brief Average block size per request, with current block sizes */
+    CFE_ES_MemOffset_t    SuggestedAvgBlockSize;   /**< \brief Average block size per request, with suggested block sizes */
+    CFE_ES_BlockProfile_t BlockProfile[CFE_MISSION_ES_POOL_MAX_BUCKETS];        /**< \brief Profile of each block size */
+    CFE_ES_MemOffset_t    SuggestedBlockSizes[CFE_MISSION_ES_POOL_MAX_BUCKETS]; /**< \brief Suggested block sizes, in ascending order */
+} CFE_ES_MemPoolProfile_t;
+
+/**
+ * \brief Memory Pool Size Range Profile
+ *
+ * Structure that is used to provide the number of requests made to a
+ * memory pool within a range of sizes.
+ *
+ * \sa #CFE_ES_WRITE_MEM_POOL_PROFILE_CC
+ */
+typedef struct CFE_ES_MemPoolSizeProfile
+{
+    CFE_ES_MemOffset_t    MinSize;                 /**< \brief Smallest size in this range */
+    CFE_ES_MemOffset_t    MaxSize;                 /**< \brief Largest size requested in this range (0 if none) */
+    uint32                Count;                   /**< \brief Number of requests in this range */
+} CFE_ES_MemPoolSizeProfile_t;
+
+/**
+ * \brief Number of bins in the performance marker duration histogram
+ *
+ * Bin N counts the durations from 2^N up to 2^(N+1) - 1 timer ticks, and
+ * bin 0 also counts zero durations, which covers all 32 bit durations.
+ */
+#define CFE_ES_PERF_STATS_HISTOGRAM_BINS     32
+
+/**
+ * \brief Performance Marker Statistics
+ *
+ * Structure that is used to provide the statistics kept for a performance
+ * marker.  Durations are the times from a marker entry to the following
+ * exit, in performance timer ticks.
+ *
+ * \sa #CFE_ES_PerfStatsTlm_t
+ */
+typedef struct CFE_ES_PerfMarkerStats
+{
+    uint32                MarkerId;                /**< \brief Performance marker ID */
+    char                  Name[CFE_MISSION_MAX_API_LEN]; /**< \brief Name registered for the marker, if any */
+    uint32                Count;                   /**< \brief Number of durations measured */
+    uint32                MinDuration;             /**< \brief Shortest duration */
+    uint32                MaxDuration;             /**< \brief Longest duration */
+    uint32                MeanDuration;            /**< \brief Mean duration */
+    uint32                Histogram[CFE_ES_PERF_STATS_HISTOGRAM_BINS]; /**< \brief Number of durations in each power
+                                                                           of two range, see #CFE_ES_PERF_STATS_HISTOGRAM_BINS */
+} CFE_ES_PerfMarkerStats_t;
+
+/**
+ * \name Startup profile selection
+ * \{
+ */
+#define CFE_ES_STARTUP_PROFILE_CURRENT       0  /**< \brief Profile of the current boot */
+#define CFE_ES_STARTUP_PROFILE_PREVIOUS      1  /**< \brief Profile of the boot before the last processor reset */
+/** \} */
+
+/**
+ * \name Startup profile phases
+ *
+ * Indices of the phase end times in #CFE_ES_StartupProfileSummary_t.  Each
+ * phase starts where the previous one ended, and the first one starts at
+ * the entry to CFE_ES_Main.
+ * \{
+ */
+#define CFE_ES_STARTUP_PHASE_RESET_AREA      0  /**< \brief Reset area and performance log set up */
+#define CFE_ES_STARTUP_PHASE_FILE_SYSTEMS    1  /**< \brief Volatile and nonvolatile file systems mounted */
+#define CFE_ES_STARTUP_PHASE_CORE_STARTUP    2  /**< \brief Exception handlers attached, entering CORE_STARTUP */
+#define CFE_ES_STARTUP_PHASE_CORE_READY      3  /**< \brief Core apps created and running, entering CORE_READY */
+#define CFE_ES_STARTUP_PHASE_APPS_LOADED     4  /**< \brief Startup script apps and libraries loaded */
+#define CFE_ES_STARTUP_PHASE_APPS_INIT       5  /**< \brief Apps synchronized in LATE_INIT, entering APPS_INIT */
+#define CFE_ES_STARTUP_PHASE_OPERATIONAL     6  /**< \brief Apps synchronized in RUNNING, entering OPERATIONAL */
+#define CFE_ES_STARTUP_PHASES                7  /**< \brief Number of startup phases */
+/** \} */
+
+/**
+ * \brief Startup Profile Summary
+ *
+ * Structure that is used to provide the end time of each startup phase.
+ * This is the first record in the file written by the Write Startup Profile
+ * command.  Times are in microseconds since the entry to CFE_ES_Main, and
+ * are zero for the phases which were not reached.
+ *
+ * \sa #CFE_ES_SEND_STARTUP_PROFILE_CC, #CFE_ES_WRITE_STARTUP_PROFILE_CC
+ */
+typedef struct CFE_ES_StartupProfileSummary
+{
+    uint32                ResetType;               /**< \brief Reset type of the boot ( PROCESSOR or POWERON ) */
+    uint32                ResetSubtype;            /**< \brief Reset sub type of the boot */
+    uint32                MainEntryTime;           /**< \brief PSP time at the entry to CFE_ES_Main, in microseconds,
+                                                        which is the time taken by the PSP and OSAL initialization
+                                                        on platforms where the PSP time starts at boot */
+    uint32                NumEntries;              /**< \brief Number of #CFE_ES_StartupProfileEntry_t records which follow */
+    uint32                PhaseEndTime[CFE_ES_STARTUP_PHASES]; /**< \brief End time of each phase,
+                                                                    see #CFE_ES_STARTUP_PHASE_RESET_AREA */
+} CFE_ES_StartupProfileSummary_t;
+
+/**
+ * \brief Startup Profile Entry
+ *
+ * Structure that is used to provide the startup times of an app or library.
+ * Times are in microseconds since the entry to CFE_ES_Main, and are zero for
+ * the points which were not reached.  Core apps are not loaded, so their load
+ * start and end times are both the time their creation started.  Libraries
+ * are registered when their init function returns, and have no late init or
+ * running times.
+ *
+ * The load, registration and initialization durations are the differences
+ * between the consecutive times.
+ *
+ * \sa #CFE_ES_WRITE_STARTUP_PROFILE_CC
+ */
+typedef struct CFE_ES_StartupProfileEntry
+{
+    char                  Name[CFE_MISSION_MAX_API_LEN]; /**< \brief Name of the app or library */
+    uint32                Type;                    /**< \brief Core app, external app or library,
+                                                        see #CFE_ES_AppType_Enum_t */
+    uint32                LoadStartTime;           /**< \brief Time the module load started */
+    uint32                LoadEndTime;             /**< \brief Time the module load ended */
+    uint32                RegisteredTime;          /**< \brief Time the main task was started or the library
+                                                        init function returned */
+    uint32                LateInitTime;            /**< \brief Time the app reached the LATE_INIT state */
+    uint32                RunningTime;             /**< \brief Time the app reached the RUNNING state */
+} CFE_ES_StartupProfileEntry_t;
+
 
 /**********************************/
 /* Telemetry Message Data Formats */
@@ -1595,6 +2178,75 @@ typedef struct CFE_ES_MemStatsTlm
     CFE_ES_PoolStatsTlm_Payload_t Payload;   /**< \brief Telemetry payload */
 } CFE_ES_MemStatsTlm_t;
 
+/** 
+**  \cfeestlm Performance Marker Statistics Packet
+**/
+typedef struct CFE_ES_PerfStatsTlm_Payload
+{
+  uint32                TimerTicksPerSecond;            /**< \brief Performance timer ticks per second, to convert durations */
+  uint32                NumMarkers;                     /**< \brief Number of valid entries in MarkerStats */
+  CFE_ES_PerfMarkerStats_t MarkerStats[CFE_MISSION_ES_PERF_STATS_MAX_MARKERS]; /**< \brief Statistics of each marker,
+                                                                                   see #CFE_ES_PerfMarkerStats_t */
+} CFE_ES_PerfStatsTlm_Payload_t;
+
+typedef struct CFE_ES_PerfStatsTlm
+{
+    CFE_MSG_TelemetryHeader_t     TlmHeader; /**< \brief Telemetry header */
+    CFE_ES_PerfStatsTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} CFE_ES_PerfStatsTlm_t;
+
+/** 
+**  \cfeestlm Startup Profile Packet
+**/
+typedef struct CFE_ES_StartupProfileTlm_Payload
+{
+  uint32                Profile;                        /**< \brief #CFE_ES_STARTUP_PROFILE_CURRENT or
+                                                             #CFE_ES_STARTUP_PROFILE_PREVIOUS */
+  CFE_ES_StartupProfileSummary_t Summary;               /**< \brief For more info, see #CFE_ES_StartupProfileSummary_t */
+} CFE_ES_StartupProfileTlm_Payload_t;
+
+typedef struct CFE_ES_StartupProfileTlm
+{
+    CFE_MSG_TelemetryHeader_t          TlmHeader; /**< \brief Telemetry header */
+    CFE_ES_StartupProfileTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} CFE_ES_StartupProfileTlm_t;
+
+/** 
+**  \cfeestlm Task CPU Utilization Packet
+**/
+typedef struct CFE_ES_TaskUtilTlm_Payload
+{
+  uint32                NumTasks;                       /**< \brief Number of valid entries in Tasks */
+  CFE_ES_TaskUtil_t     Tasks[CFE_MISSION_ES_TASK_UTIL_MAX_TASKS]; /**< \brief CPU time and utilization of each task,
+                                                                        see #CFE_ES_TaskUtil_t */
+} CFE_ES_TaskUtilTlm_Payload_t;
+
+typedef struct CFE_ES_TaskUtilTlm
+{
+    CFE_MSG_TelemetryHeader_t    TlmHeader; /**< \brief Telemetry header */
+    CFE_ES_TaskUtilTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} CFE_ES_TaskUtilTlm_t;
+
+/** 
+**  \cfeestlm Generic Counter Snapshot Packet
+**/
+typedef struct CFE_ES_GenCounterTlm_Payload
+{
+  uint32                Sequence;                       /**< \brief Number of the snapshot, the same in all packets of a snapshot */
+  uint16                PacketNumber;                   /**< \brief Number of this packet within the snapshot, starting at 0 */
+  uint8                 LastPacket;                     /**< \brief True in the last packet of the snapshot */
+  uint8                 Spare;                          /**< \brief Spare byte to maintain alignment */
+  uint32                NumCounters;                    /**< \brief Number of valid entries in Counters */
+  CFE_ES_GenCounterValue_t Counters[CFE_MISSION_ES_GEN_COUNTER_SNAPSHOT_MAX_COUNTERS]; /**< \brief Value of each counter,
+                                                                                          see #CFE_ES_GenCounterValue_t */
+} CFE_ES_GenCounterTlm_Payload_t;
+
+typedef struct CFE_ES_GenCounterTlm
+{
+    CFE_MSG_TelemetryHeader_t      TlmHeader; /**< \brief Telemetry header */
+    CFE_ES_GenCounterTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} CFE_ES_GenCounterTlm_t;
+
 /*************************************************************************/
 
 /** 
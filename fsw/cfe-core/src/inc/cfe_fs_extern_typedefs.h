@@ -204,7 +204,29 @@ enum CFE_FS_SubType
     * command.
     *
     */
-   CFE_FS_SubType_ES_QUERYALLTASKS                    = 23
+   CFE_FS_SubType_ES_QUERYALLTASKS                    = 23,
+
+   /**
+    * @brief Executive Services Memory Pool Profile File
+    *
+    *
+    * Executive Services Memory Pool Profile File which is generated in response to a
+    * \link #CFE_ES_WRITE_MEM_POOL_PROFILE_CC \ES_WRITEPOOLPROFILE2FILE \endlink
+    * command.
+    *
+    */
+   CFE_FS_SubType_ES_POOL_PROFILE                     = 24,
+
+   /**
+    * @brief Executive Services Startup Profile File
+    *
+    *
+    * Executive Services Startup Profile File which is generated in response to a
+    * \link #CFE_ES_WRITE_STARTUP_PROFILE_CC \ES_WRITESTARTUPPROFILE2FILE \endlink
+    * command.
+    *
+    */
+   CFE_FS_SubType_ES_STARTUP_PROFILE                  = 25
 };
 
 /**
@@ -192,6 +192,49 @@ static inline bool CFE_ResourceId_IsDefined(CFE_ResourceId_t id)
 
 /** \} */
 
+/**
+ * @brief An entry in a resource name index
+ *
+ * A name index allows a registry of named resources (apps, libraries, tables,
+ * etc) to be searched by name without comparing every entry.  The index is
+ * an array of these entries, one per registry table entry, provided by the
+ * registry itself.  No other memory is used.
+ *
+ * Each index entry has two roles: it links the registry entry with the same
+ * table index into the chain of its hash bucket, and it is the head of the
+ * chain of the bucket with the same index.  Entry numbers are stored plus
+ * one, so an index which is all zero (such as after memset()) is empty.  The
+ * registry may therefore have at most 65535 entries.
+ *
+ * A registry entry stays in the index until it is added with a new name or
+ * removed, so the match function passed to CFE_ResourceId_NameIndexFind()
+ * must confirm that the entry is in use.
+ */
+typedef struct
+{
+    uint32 NameHash;   /**< Hash of the name the registry entry was added with */
+    uint16 NextEntry;  /**< Next registry entry in the same bucket plus one, or 0 at the end */
+    uint16 FirstEntry; /**< First registry entry in the bucket with this index plus one, or 0 if empty */
+} CFE_ResourceId_NameIndexEntry_t;
+
+/**
+ * @brief Number of words in the slot map of a registry table
+ *
+ * A slot map records which entries of a registry table are in use, one bit
+ * per entry, so CFE_ResourceId_FindNextFree() can skip over used entries
+ * without checking each one.  The map is an array of uint32 of this size,
+ * provided by the registry itself.
+ *
+ * A set bit means the entry is in use.  The map is only a hint: every free
+ * entry it reports is confirmed with the registry's check function and the
+ * map is corrected when it is wrong, so a map which is all zero (such as after
+ * memset()) is valid.  An entry must not be marked in use once it is free,
+ * or it may be passed over until the table is otherwise full.
+ *
+ * @param[in]   TableSize the maximum size of the target table
+ */
+#define CFE_RESOURCEID_SLOTMAP_WORDS(TableSize)   (((TableSize) + 31) / 32)
+
 
 /*
  * Non-inline API functions provided by the Resource ID module
@@ -241,6 +284,40 @@ extern uint32 CFE_ResourceId_GetSerial(CFE_ResourceId_t ResourceId);
  */
 extern CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32 TableSize, bool (*CheckFunc)(CFE_ResourceId_t) );
 
+/**
+ * @brief Locate the next resource ID which does not map to an in-use table entry, using a slot map
+ *
+ * This returns the same ID as CFE_ResourceId_FindNext() would, but entries
+ * which the slot map shows to be in use are skipped 32 at a time rather than
+ * checked individually.  The check function is only called for entries which
+ * the map shows to be free, and for every entry if the map shows the table
+ * to be full.  The map is updated for any entry where it was found to be
+ * wrong.
+ *
+ * The caller must mark entries in the map with CFE_ResourceId_SlotMapMark()
+ * whenever they are set used or free.  The returned entry is not marked.
+ *
+ * returns an undefined ID value if no open slots are available
+ *
+ * @param[in]     StartId   the last issued ID for the resource category (app, lib, etc).
+ * @param[in]     TableSize the maximum size of the target table
+ * @param[in,out] SlotMap   slot map of the target table, #CFE_RESOURCEID_SLOTMAP_WORDS words
+ * @param[in]     CheckFunc a function to check if the given ID is available
+ * @returns       Next ID value which does not map to a valid entry
+ * @retval        #CFE_RESOURCEID_UNDEFINED if no open slots.
+ */
+extern CFE_ResourceId_t CFE_ResourceId_FindNextFree(CFE_ResourceId_t StartId, uint32 TableSize, uint32 *SlotMap, bool (*CheckFunc)(CFE_ResourceId_t) );
+
+/**
+ * @brief Mark a table entry as used or free in a slot map
+ *
+ * @param[in,out] SlotMap   slot map of the target table, #CFE_RESOURCEID_SLOTMAP_WORDS words
+ * @param[in]     TableSize the maximum size of the target table
+ * @param[in]     EntryIdx  the table index of the entry, ignored if not less than TableSize
+ * @param[in]     IsUsed    whether the entry is now in use
+ */
+extern void CFE_ResourceId_SlotMapMark(uint32 *SlotMap, uint32 TableSize, uint32 EntryIdx, bool IsUsed);
+
 /**
  * @brief Internal routine to aid in converting an ES resource ID to an array index
 
@@ -252,6 +329,56 @@ extern CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32
  */
 extern int32 CFE_ResourceId_ToIndex(CFE_ResourceId_t Id, uint32 BaseValue, uint32 TableSize, uint32 *Idx);
 
+/**
+ * @brief Add a registry entry to a name index
+ *
+ * Adds the registry entry at EntryIdx to the index under the given name.  If
+ * the entry is already in the index (under any name) it is moved, so this
+ * should be called whenever the name of a registry entry is set.
+ *
+ * As this modifies the index, the registry must be locked prior to invoking
+ * this function.
+ *
+ * @param[inout] Index     the name index, an array of TableSize entries
+ * @param[in]    TableSize the size of the registry table
+ * @param[in]    EntryIdx  the registry table index of the entry
+ * @param[in]    Name      the name of the registry entry
+ */
+extern void CFE_ResourceId_NameIndexAdd(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 EntryIdx, const char *Name);
+
+/**
+ * @brief Remove a registry entry from a name index
+ *
+ * This has no effect if the entry is not in the index.
+ *
+ * As this modifies the index, the registry must be locked prior to invoking
+ * this function.
+ *
+ * @param[inout] Index     the name index, an array of TableSize entries
+ * @param[in]    TableSize the size of the registry table
+ * @param[in]    EntryIdx  the registry table index of the entry
+ */
+extern void CFE_ResourceId_NameIndexRemove(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 EntryIdx);
+
+/**
+ * @brief Find a registry entry by name using a name index
+ *
+ * Only the registry entries in the bucket of the name which were added with
+ * the same name hash are checked, by calling MatchFunc with the index of the
+ * entry.  MatchFunc must confirm that the entry is in use and that its name
+ * is equal to Name.
+ *
+ * @param[in]  Index     the name index, an array of TableSize entries
+ * @param[in]  TableSize the size of the registry table
+ * @param[in]  Name      the name to find
+ * @param[in]  MatchFunc a function to check if the registry entry at the given index is in use with the given name
+ * @param[out] EntryIdx  the registry table index of the entry found
+ * @returns Status code, CFE_SUCCESS if found.
+ * @retval #CFE_ES_ERR_NAME_NOT_FOUND if no entry matches the name
+ */
+extern int32 CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, const char *Name,
+        bool (*MatchFunc)(uint32, const char *), uint32 *EntryIdx);
+
 
 
 #endif  /* CFE_RESOURCEID_H */
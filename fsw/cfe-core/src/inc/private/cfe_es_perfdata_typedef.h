@@ -37,10 +37,24 @@
 #define CFE_ES_PERF_32BIT_WORDS_IN_MASK ((CFE_MISSION_ES_PERF_MAX_IDS) / 32)
 
 
+/*
+ * Version of the metadata and entry layout.  With high resolution timestamps,
+ * the timer fields hold a 64 bit count, normally of nanoseconds, and each
+ * entry also has the number of the CPU it was recorded on.
+ */
+#if (CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS == true)
+#define CFE_ES_PERF_DATA_VERSION    2
+#else
+#define CFE_ES_PERF_DATA_VERSION    1
+#endif
+
 typedef struct {
     uint32         Data;
     uint32         TimerUpper32;   /* TBU - timebase register */
     uint32         TimerLower32;   /* TBL - timebase register */
+#if (CFE_PLATFORM_ES_PERF_HIRES_TIMESTAMPS == true)
+    uint32         CpuId;          /* CPU the entry was recorded on */
+#endif
 } CFE_ES_PerfDataEntry_t;
 
 typedef struct {
@@ -70,6 +84,12 @@ typedef struct {
 
 typedef struct {
     CFE_ES_PerfMetaData_t          MetaData;
+    /*
+     * Incremented each time an entry is stored in the last slot of either
+     * half of the DataBuffer, so the performance data stream knows when a
+     * half is complete.  This is not part of the dumped metadata.
+     */
+    uint32                         SwitchCount;
     CFE_ES_PerfDataEntry_t         DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE];
 } CFE_ES_PerfData_t;
 
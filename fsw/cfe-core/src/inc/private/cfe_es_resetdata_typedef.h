@@ -36,6 +36,7 @@
 #include <cfe_time.h>                  /* Required for CFE_TIME_ResetVars_t definition */
 #include "cfe_es_erlog_typedef.h"      /* Required for CFE_ES_ERLog_t definition */
 #include "cfe_es_perfdata_typedef.h"   /* Required for CFE_ES_PerfData_t definition */
+#include "cfe_es_startprofile_typedef.h" /* Required for CFE_ES_StartupProfile_t definition */
 #include "cfe_evs_log_typedef.h"       /* Required for CFE_EVS_Log_t definition */
 #include "cfe_platform_cfg.h"          /* CFE_PLATFORM_ES_ER_LOG_ENTRIES, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE */
 
@@ -98,6 +99,13 @@ typedef struct
    */
    CFE_EVS_Log_t              EVS_Log;
 
+   /*
+   ** Startup profile of the current boot, and of the boot before
+   ** the last processor reset
+   */
+   CFE_ES_StartupProfile_t    StartupProfile;
+   CFE_ES_StartupProfile_t    PrevStartupProfile;
+
 } CFE_ES_ResetData_t;
 
 
@@ -0,0 +1,53 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * \file cfe_es_startprofile_typedef.h
+ *
+ * Definition of the CFE_ES_StartupProfile structure type.
+ * This is in its own header file since it is part of the ES reset area.
+ */
+
+#ifndef CFE_ES_STARTPROFILE_TYPEDEF_H_
+#define CFE_ES_STARTPROFILE_TYPEDEF_H_
+
+#include <common_types.h>
+#include "cfe_es_msg.h"        /* Required for CFE_ES_StartupProfileSummary_t definition */
+#include "cfe_platform_cfg.h"  /* Required for CFE_PLATFORM_ES_MAX_APPLICATIONS, CFE_PLATFORM_ES_MAX_LIBRARIES */
+
+/*
+** Number of entries in the startup profile.  Apps use the entry of the
+** same index as their app table entry, and libraries use the entries
+** after the apps.
+*/
+#define CFE_ES_STARTUP_PROFILE_ENTRIES  (CFE_PLATFORM_ES_MAX_APPLICATIONS + CFE_PLATFORM_ES_MAX_LIBRARIES)
+
+/*
+** Startup profile type
+** An entry is in use if its name is not empty.
+*/
+typedef struct
+{
+    CFE_ES_StartupProfileSummary_t Summary;
+    CFE_ES_StartupProfileEntry_t   Entries[CFE_ES_STARTUP_PROFILE_ENTRIES];
+} CFE_ES_StartupProfile_t;
+
+
+#endif /* CFE_ES_STARTPROFILE_TYPEDEF_H_ */
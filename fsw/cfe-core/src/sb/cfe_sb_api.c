@@ -138,7 +138,7 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
         CFE_SB_LockSharedData(__func__,__LINE__);
 
         /* get first available entry in pipe table */
-        PendingPipeId = CFE_ResourceId_FindNext(CFE_SB_Global.LastPipeId, CFE_PLATFORM_SB_MAX_PIPES, CFE_SB_CheckPipeDescSlotUsed);
+        PendingPipeId = CFE_ResourceId_FindNextFree(CFE_SB_Global.LastPipeId, CFE_PLATFORM_SB_MAX_PIPES, CFE_SB_Global.PipeSlotMap, CFE_SB_CheckPipeDescSlotUsed);
         PipeDscPtr = CFE_SB_LocatePipeDescByID(CFE_SB_PIPEID_C(PendingPipeId));
 
         /* if pipe table is full, send event and return error */
@@ -192,8 +192,15 @@ typedef struct
     CFE_EVS_BinFilter_t            EventFilters[CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER];
     CFE_SB_Qos_t                   Default_Qos;
     CFE_ResourceId_t               LastPipeId;
+    uint32                         PipeSlotMap[CFE_RESOURCEID_SLOTMAP_WORDS(CFE_PLATFORM_SB_MAX_PIPES)];
 } CFE_SB_Global_t;
 
+/*
+ * External variables private to the software bus module
+ */
+
+extern CFE_SB_Global_t CFE_SB_Global;
+
 
 /******************************************************************************
 **  Typedef:  CFE_SB_SendErrEventBuf_t
@@ -430,6 +437,7 @@ static inline CFE_SB_PipeId_t CFE_SB_PipeDescGetID(const CFE_SB_PipeD_t *PipeDsc
 static inline void CFE_SB_PipeDescSetUsed(CFE_SB_PipeD_t *PipeDscPtr, CFE_ResourceId_t PendingID)
 {
     PipeDscPtr->PipeId = CFE_SB_PIPEID_C(PendingID);
+    CFE_ResourceId_SlotMapMark(CFE_SB_Global.PipeSlotMap, CFE_PLATFORM_SB_MAX_PIPES, PipeDscPtr - CFE_SB_Global.PipeTbl, true);
 }
 
 /**
@@ -446,6 +454,7 @@ static inline void CFE_SB_PipeDescSetUsed(CFE_SB_PipeD_t *PipeDscPtr, CFE_Resour
 static inline void CFE_SB_PipeDescSetFree(CFE_SB_PipeD_t *PipeDscPtr)
 {
     PipeDscPtr->PipeId = CFE_SB_INVALID_PIPE;
+    CFE_ResourceId_SlotMapMark(CFE_SB_Global.PipeSlotMap, CFE_PLATFORM_SB_MAX_PIPES, PipeDscPtr - CFE_SB_Global.PipeTbl, false);
 }
 
 /**
@@ -466,15 +475,8 @@ static inline bool CFE_SB_PipeDescIsMatch(const CFE_SB_PipeD_t *PipeDscPtr, CFE_
     return (PipeDscPtr != NULL && CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->PipeId, PipeID));
 }
 
-/* Availability check functions used in conjunction with CFE_ResourceId_FindNext() */
+/* Availability check functions used in conjunction with CFE_ResourceId_FindNextFree() */
 bool CFE_SB_CheckPipeDescSlotUsed(CFE_ResourceId_t CheckId);
 
-
-/*
- * External variables private to the software bus module
- */
-
-extern CFE_SB_Global_t CFE_SB_Global;
-
 #endif /* _cfe_sb_priv_ */
 /*****************************************************************************/
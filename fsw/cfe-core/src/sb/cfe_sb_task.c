@@ -157,6 +157,11 @@ int32 CFE_SB_AppInit(void){
     /* Get the assigned Application ID for the SB Task */
     CFE_ES_GetAppID(&CFE_SB_Global.AppId);
 
+    /* Name the performance markers used by SB */
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_SB_MAIN_PERF_ID, "SB_MAIN");
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_SB_MSG_LIM_PERF_ID, "SB_MSG_LIM");
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID, "SB_PIPE_OFLOW");
+
     /* Process the platform cfg file events to be filtered */
     if(CFE_PLATFORM_SB_FILTERED_EVENT1 != 0){
       CFE_SB_Global.EventFilters[CfgFileEventsToFilter].EventID = CFE_PLATFORM_SB_FILTERED_EVENT1;
@@ -314,8 +314,7 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
                     RegRecPtr->ValidationFuncPtr = TblValidationFuncPtr;
 
                     /* Save Table Name in Registry */
-                    strncpy(RegRecPtr->Name, TblName, sizeof(RegRecPtr->Name) - 1);
-                    RegRecPtr->Name[sizeof(RegRecPtr->Name) - 1] = '\0';
+                    CFE_TBL_SetRegistryRecordName(RegRecPtr, TblName);
 
                     /* Set the "Dump Only" flag to value based upon selected option */
                     if ((TblOptionFlags & CFE_TBL_OPT_LD_DMP_MSK) == CFE_TBL_OPT_DUMP_ONLY)
@@ -642,6 +641,8 @@ int32 CFE_TBL_Unregister ( CFE_TBL_Handle_t TblHandle )
 
             /* Remove Table Name */
             RegRecPtr->Name[0] = '\0';
+            CFE_ResourceId_NameIndexRemove(CFE_TBL_Global.RegistryNameIndex, CFE_PLATFORM_TBL_MAX_NUM_TABLES,
+                    RegRecPtr - CFE_TBL_Global.Registry);
         }
 
         /* Remove the Access Descriptor Link from linked list */
@@ -225,6 +225,10 @@ int32 CFE_TBL_EarlyInit (void)
 ********************************************************************/
 void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr)
 {
+    /* The name is cleared, so the record is no longer found by name */
+    CFE_ResourceId_NameIndexRemove(CFE_TBL_Global.RegistryNameIndex, CFE_PLATFORM_TBL_MAX_NUM_TABLES,
+            RegRecPtr - CFE_TBL_Global.Registry);
+
     memset(RegRecPtr, 0, sizeof(*RegRecPtr));
 
     RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
@@ -238,6 +242,22 @@ void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr)
 } /* End CFE_TBL_InitRegistryRecord */
 
 
+/*******************************************************************
+**
+** CFE_TBL_SetRegistryRecordName
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+void CFE_TBL_SetRegistryRecordName(CFE_TBL_RegistryRec_t *RegRecPtr, const char *TblName)
+{
+    strncpy(RegRecPtr->Name, TblName, sizeof(RegRecPtr->Name) - 1);
+    RegRecPtr->Name[sizeof(RegRecPtr->Name) - 1] = '\0';
+
+    CFE_ResourceId_NameIndexAdd(CFE_TBL_Global.RegistryNameIndex, CFE_PLATFORM_TBL_MAX_NUM_TABLES,
+            RegRecPtr - CFE_TBL_Global.Registry, RegRecPtr->Name);
+} /* End CFE_TBL_SetRegistryRecordName */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_ValidateHandle
@@ -514,6 +534,24 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
 }   /* End of CFE_TBL_GetNextNotification() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_RegistryRecordNameMatch
+**
+** Local helper to check a Table Registry Record against a name, for the
+** name index
+********************************************************************/
+
+static bool CFE_TBL_RegistryRecordNameMatch(uint32 Idx, const char *TblName)
+{
+    const CFE_TBL_RegistryRec_t *RegRecPtr = &CFE_TBL_Global.Registry[Idx];
+
+    /* Check to see if the record is currently being used */
+    return (!CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED) &&
+            strcmp(TblName, RegRecPtr->Name) == 0);
+}
+
+
 /*******************************************************************
 **
 ** CFE_TBL_FindTableInRegistry
@@ -524,24 +562,14 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
 int16 CFE_TBL_FindTableInRegistry(const char *TblName)
 {
     int16 RegIndx = CFE_TBL_NOT_FOUND;
-    int16 i = -1;
+    uint32 Idx;
 
-    do
+    /* Perform a case sensitive name lookup through the name index */
+    if (CFE_ResourceId_NameIndexFind(CFE_TBL_Global.RegistryNameIndex, CFE_PLATFORM_TBL_MAX_NUM_TABLES,
+            TblName, CFE_TBL_RegistryRecordNameMatch, &Idx) == CFE_SUCCESS)
     {
-        /* Point to next record in the Table Registry */
-        i++;
-
-        /* Check to see if the record is currently being used */
-        if ( !CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED) )
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(TblName, CFE_TBL_Global.Registry[i].Name) == 0)
-            {
-                /* If the names match, then return the index */
-                RegIndx = i;
-            }
-        }
-    } while ( (RegIndx == CFE_TBL_NOT_FOUND) && (i < (CFE_PLATFORM_TBL_MAX_NUM_TABLES-1)) );
+        RegIndx = Idx;
+    }
 
     return RegIndx;
 }   /* End of CFE_TBL_FindTableInRegistry() */
@@ -1336,6 +1364,8 @@ int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId)
 
                 /* Remove Table Name */
                 RegRecPtr->Name[0] = '\0';
+                CFE_ResourceId_NameIndexRemove(CFE_TBL_Global.RegistryNameIndex, CFE_PLATFORM_TBL_MAX_NUM_TABLES,
+                        RegRecPtr - CFE_TBL_Global.Registry);
             }
             
             /* Remove the Access Descriptor Link from linked list */
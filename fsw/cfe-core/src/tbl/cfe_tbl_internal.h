@@ -475,6 +475,25 @@ int32 CFE_TBL_ReadHeaders( osal_id_t FileDescriptor,
 ******************************************************************************/
 void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr);
 
+/*****************************************************************************/
+/**
+** \brief Sets the name of a Table Registry Record
+**
+** \par Description
+**        Copies the name into the Table Registry Record and adds the record
+**        to the name index used by #CFE_TBL_FindTableInRegistry.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function assumes the registry has been locked.
+**
+** \param[in]  RegRecPtr - Pointer to the Table Registry Record
+**
+** \param[in]  TblName - Pointer to character string containing complete
+**                       Table Name (of the format "AppName.TblName").
+**
+******************************************************************************/
+void CFE_TBL_SetRegistryRecordName(CFE_TBL_RegistryRec_t *RegRecPtr, const char *TblName);
+
 
 /*****************************************************************************/
 /**
@@ -161,6 +161,11 @@ int32 CFE_TBL_TaskInit(void)
       CFE_ES_WriteToSysLog("TBL:Call to CFE_ES_RegisterApp Failed:RC=0x%08X\n",(unsigned int)Status);
       return Status;
     }/* end if */
+
+    /*
+    ** Name the performance markers used by Table Services
+    */
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_TBL_MAIN_PERF_ID, "TBL_MAIN");
     
     /*
     ** Initialize global Table Services data
@@ -208,6 +208,16 @@ int32 CFE_TIME_TaskInit(void)
       CFE_ES_WriteToSysLog("TIME:Call to CFE_ES_RegisterApp Failed:RC=0x%08X\n",(unsigned int)Status);
       return Status;
     }/* end if */
+
+    /*
+    ** Name the performance markers used by Time Services
+    */
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_TIME_MAIN_PERF_ID, "TIME_MAIN");
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_TIME_TONE1HZISR_PERF_ID, "TIME_TONE1HZISR");
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_TIME_LOCAL1HZISR_PERF_ID, "TIME_LOCAL1HZISR");
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_TIME_SENDMET_PERF_ID, "TIME_SENDMET");
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_TIME_TONE1HZTASK_PERF_ID, "TIME_TONE1HZTASK");
+    CFE_ES_PerfRegisterMarker(CFE_MISSION_TIME_LOCAL1HZTASK_PERF_ID, "TIME_LOCAL1HZTASK");
     
     Status = CFE_EVS_Register(NULL, 0, 0);
     if(Status != CFE_SUCCESS)
@@ -59,6 +59,7 @@ extern CFE_ES_Global_t       CFE_ES_Global;
 extern CFE_ES_TaskData_t     CFE_ES_TaskData;
 
 extern int32 dummy_function(void);
+extern uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
 
 /*
 ** Global variables
@@ -83,6 +84,9 @@ typedef struct
 CFE_ES_GMP_DirectBuffer_t   UT_MemPoolDirectBuffer;
 CFE_ES_GMP_IndirectBuffer_t UT_MemPoolIndirectBuffer;
 
+/* Number of calls to the child task entry point used by the affinity tests */
+uint32 UT_ChildTaskEntryCount;
+
 /* Create a startup script buffer for a maximum of 5 lines * 80 chars/line */
 char StartupScript[MAX_STARTUP_SCRIPT];
 
@@ -209,11 +213,40 @@ static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC =
         .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
         .CommandCode = CFE_ES_DUMP_CDS_REGISTRY_CC
 };
+static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_PROFILE_CC =
+{
+        .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
+        .CommandCode = CFE_ES_WRITE_MEM_POOL_PROFILE_CC
+};
+
+static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_START_PERF_STREAM_CC =
+{
+        .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
+        .CommandCode = CFE_ES_START_PERF_STREAM_CC
+};
+
+static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_WRITE_PERF_TRACE_CC =
+{
+        .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
+        .CommandCode = CFE_ES_WRITE_PERF_TRACE_CC
+};
+
+static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_SEND_STARTUP_PROFILE_CC =
+{
+        .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
+        .CommandCode = CFE_ES_SEND_STARTUP_PROFILE_CC
+};
+
+static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_WRITE_STARTUP_PROFILE_CC =
+{
+        .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
+        .CommandCode = CFE_ES_WRITE_STARTUP_PROFILE_CC
+};
 
 static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_CMD_INVALID_CC =
 {
         .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
-        .CommandCode = CFE_ES_DUMP_CDS_REGISTRY_CC + 2
+        .CommandCode = CFE_ES_WRITE_STARTUP_PROFILE_CC + 2
 };
 
 static const UT_TaskPipeDispatchId_t  UT_TPID_CFE_ES_SEND_HK =
@@ -404,6 +437,53 @@ void ES_UT_SetupSingleLibId(const char *LibName, CFE_ES_LibRecord_t **OutLibRec)
     ++CFE_ES_Global.RegisteredLibs;
 }
 
+/*
+ * The PSP calls of cfe_es_cputime.c are not part of the ES unit
+ * test, these stubs are used instead so the tests can set the CPU time
+ * of tasks.  The CPU time is taken from the data buffer, if one is set.
+ */
+int32 CFE_ES_GetTaskCpuClock(CFE_ES_TaskCpuClock_t *ClockPtr)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_GetTaskCpuClock);
+    ClockPtr->CpuTimeRef = 0;
+    ClockPtr->IsValid = (status == CFE_SUCCESS);
+
+    return status;
+}
+
+int32 CFE_ES_ReadTaskCpuTime(const CFE_ES_TaskCpuClock_t *ClockPtr, uint64 *CpuTimeUsecPtr)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_ReadTaskCpuTime);
+    if (status == CFE_SUCCESS && !ClockPtr->IsValid)
+    {
+        status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        *CpuTimeUsecPtr = 0;
+        UT_Stub_CopyToLocal(UT_KEY(CFE_ES_ReadTaskCpuTime), CpuTimeUsecPtr, sizeof(*CpuTimeUsecPtr));
+    }
+
+    return status;
+}
+
+/*
+ * The CPU affinity of cfe_es_affinity.c is applied through the PSP, so it is
+ * also replaced by a stub, which allows the tests to check the affinity
+ * without restricting the host.
+ */
+int32 CFE_ES_SetTaskAffinity(uint32 CpuAffinity)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_SetTaskAffinity), CpuAffinity);
+
+    return UT_DEFAULT_IMPL(CFE_ES_SetTaskAffinity);
+}
+
 int32 ES_UT_PoolDirectRetrieve(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offset,
         CFE_ES_GenPoolBD_t **BdPtr)
 {
@@ -447,6 +527,62 @@ int32 ES_UT_CDSPoolCommit(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offset,
     return CFE_PSP_WriteToCDS(BdPtr, Offset, sizeof(*BdPtr));
 }
 
+/*
+ * Reference bucket search, as done before the size class table was added.
+ * Returns the same inverted bucket ID as CFE_ES_GenPoolFindBucket().
+ */
+uint16 ES_UT_PoolLinearFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize)
+{
+    uint16 Index;
+
+    for (Index=0; Index < PoolRecPtr->NumBuckets; ++Index)
+    {
+        if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
+        {
+            break;
+        }
+    }
+
+    return (PoolRecPtr->NumBuckets - Index);
+}
+
+void ES_UT_CheckPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    size_t LargestSize;
+    size_t ReqSize;
+    uint16 i;
+
+    /* Each block size exactly, and one byte over it */
+    for (i=0; i < PoolRecPtr->NumBuckets; ++i)
+    {
+        ReqSize = PoolRecPtr->Buckets[i].BlockSize;
+        UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(PoolRecPtr, ReqSize),
+                ES_UT_PoolLinearFindBucket(PoolRecPtr, ReqSize));
+        UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(PoolRecPtr, ReqSize + 1),
+                ES_UT_PoolLinearFindBucket(PoolRecPtr, ReqSize + 1));
+    }
+
+    /* Every size up to twice the largest block size, and far beyond it */
+    LargestSize = PoolRecPtr->Buckets[PoolRecPtr->NumBuckets - 1].BlockSize;
+    for (ReqSize=0; ReqSize <= (2 * LargestSize); ++ReqSize)
+    {
+        if (CFE_ES_GenPoolFindBucket(PoolRecPtr, ReqSize) != ES_UT_PoolLinearFindBucket(PoolRecPtr, ReqSize))
+        {
+            break;
+        }
+    }
+    UtAssert_True(ReqSize > (2 * LargestSize), "Bucket for all sizes to %lu matches linear search (stopped at %lu)",
+            (unsigned long)(2 * LargestSize), (unsigned long)ReqSize);
+
+    UtAssert_ZERO(CFE_ES_GenPoolFindBucket(PoolRecPtr, LargestSize + 1));
+    UtAssert_ZERO(CFE_ES_GenPoolFindBucket(PoolRecPtr, (size_t)-1));
+}
+
+void ES_UT_ChildTaskEntry(void)
+{
+    ++UT_ChildTaskEntryCount;
+}
+
 void ES_UT_SetupMemPoolId(CFE_ES_MemPoolRecord_t **OutPoolRecPtr)
 {
     CFE_ResourceId_t UtPoolID;
@@ -642,6 +778,31 @@ static int32 ES_UT_SetAppStateHook(void *UserObj, int32 StubRetcode,
     return StubRetcode;
 }
 
+/*
+ * Records the number of registered external apps at each module load,
+ * to check the order in which the startup script entries are processed
+ */
+typedef struct
+{
+    uint32 NumLoads;
+    uint32 RegisteredApps[8];
+} ES_UT_ModuleLoadHook_t;
+
+static int32 ES_UT_ModuleLoadHook(void *UserObj, int32 StubRetcode,
+                                  uint32 CallCount,
+                                  const UT_StubContext_t *Context)
+{
+    ES_UT_ModuleLoadHook_t *LoadHook = UserObj;
+
+    if (LoadHook->NumLoads < 8)
+    {
+        LoadHook->RegisteredApps[LoadHook->NumLoads] = CFE_ES_Global.RegisteredExternalApps;
+        ++LoadHook->NumLoads;
+    }
+
+    return StubRetcode;
+}
+
 void UtTest_Setup(void)
 {
     UT_Init("es");
@@ -659,6 +820,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestTask);
     UT_ADD_TEST(TestPerf);
     UT_ADD_TEST(TestAPI);
+    UT_ADD_TEST(TestCRC);
     UT_ADD_TEST(TestGenericCounterAPI);
     UT_ADD_TEST(TestCDS);
     UT_ADD_TEST(TestGenericPool);
@@ -691,6 +853,8 @@ void ES_ResetUnitTest(void)
 
 void TestInit(void)
 {
+    uint32 NumEntries;
+
     UtPrintf("Begin Test Init");
 
     UT_SetCDSSize(128 * 1024);
@@ -719,6 +883,27 @@ void TestInit(void)
               UT_GetStubCount(UT_KEY(CFE_PSP_Panic)) == 0,
               "CFE_ES_Main",
               "Normal startup");
+
+    /* Check the startup profile of the normal startup */
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->StartupProfile.Summary.ResetType, CFE_PSP_RST_TYPE_POWERON);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->StartupProfile.Summary.NumEntries,
+            CFE_ES_Global.RegisteredCoreApps + CFE_ES_Global.RegisteredExternalApps +
+            CFE_ES_Global.RegisteredLibs);
+    UtAssert_True(strcmp(CFE_ES_ResetDataPtr->StartupProfile.Entries[CFE_PLATFORM_ES_MAX_APPLICATIONS].Name,
+            "TST_LIB") == 0 &&
+            CFE_ES_ResetDataPtr->StartupProfile.Entries[CFE_PLATFORM_ES_MAX_APPLICATIONS].Type ==
+            CFE_ES_AppType_LIBRARY,
+            "CFE_ES_Main - startup profile library entry");
+
+    /* Test that a processor reset keeps the startup profile of the previous boot */
+    NumEntries = CFE_ES_ResetDataPtr->StartupProfile.Summary.NumEntries;
+    CFE_ES_StartupProfileInit(CFE_PSP_RST_TYPE_PROCESSOR);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->PrevStartupProfile.Summary.NumEntries, NumEntries);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->StartupProfile.Summary.NumEntries, 0);
+
+    /* Test that a power on reset clears the startup profile of the previous boot */
+    CFE_ES_StartupProfileInit(CFE_PSP_RST_TYPE_POWERON);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->PrevStartupProfile.Summary.NumEntries, 0);
 }
 
 void TestStartupErrorPaths(void)
@@ -730,6 +915,8 @@ void TestStartupErrorPaths(void)
     OS_statvfs_t StatBuf;
     CFE_ES_TaskRecord_t *TaskRecPtr;
     CFE_ES_AppRecord_t *AppRecPtr;
+    uint32 WaitRemaining;
+    osal_task_entry EntryFunc;
 
     UtPrintf("Begin Test Startup Error Paths");
 
@@ -1155,6 +1342,53 @@ void TestStartupErrorPaths(void)
     CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
     ASSERT(CFE_ES_WaitForSystemState(CFE_ES_SystemState_CORE_READY, 0));
 
+    /* Test that a change of the app state notifies the waiting tasks, once */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, NULL, &AppRecPtr, NULL);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    ASSERT(CFE_ES_WaitForSystemState(CFE_ES_SystemState_APPS_INIT, 0));
+    UtAssert_INT32_EQ(AppRecPtr->AppState, CFE_ES_AppState_LATE_INIT);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_BinSemFlush)), 1);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_BinSemGive)), 1);
+    ASSERT(CFE_ES_WaitForSystemState(CFE_ES_SystemState_APPS_INIT, 0));
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_BinSemFlush)), 1);
+
+    /* Test the startup sync wait with no time remaining */
+    ES_ResetUnitTest();
+    WaitRemaining = 0;
+    UtAssert_INT32_EQ(CFE_ES_StartupSyncWait(&WaitRemaining), CFE_ES_OPERATION_TIMED_OUT);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_BinSemTimedWait)), 0);
+
+    /* Test the startup sync wait timing out, which deducts the poll time */
+    WaitRemaining = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC + 10;
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_ES_StartupSyncWait(&WaitRemaining), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(WaitRemaining, 10);
+
+    /* Test the startup sync wait being notified, which deducts only the time waited */
+    UtAssert_INT32_EQ(CFE_ES_StartupSyncWait(&WaitRemaining), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(WaitRemaining, 9);
+
+    /* Test the startup sync wait falling back to polling without the semaphore */
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_StartupSyncWait(&WaitRemaining), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(WaitRemaining, 0);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_TaskDelay)), 1);
+
+    /* Test getting the app entry point when the app record is already complete */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_UNDEFINED, NULL, &AppRecPtr, NULL);
+    AppRecPtr->ModuleInfo.EntryAddress = (cpuaddr)ES_UT_SetupForOSCleanup;
+    UtAssert_INT32_EQ(CFE_ES_GetAppEntryPoint(&EntryFunc), CFE_SUCCESS);
+    UtAssert_True(EntryFunc == (osal_task_entry)ES_UT_SetupForOSCleanup, "CFE_ES_GetAppEntryPoint - Entry point");
+    UtAssert_INT32_EQ(AppRecPtr->AppState, CFE_ES_AppState_EARLY_INIT);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_BinSemTimedWait)), 0);
+
+    /* Test getting the app entry point when the app record is never completed */
+    ES_ResetUnitTest();
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemTimedWait), OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_ES_GetAppEntryPoint(&EntryFunc), CFE_ES_ERR_APP_REGISTER);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_BinSemTimedWait)) > 0, "CFE_ES_GetAppEntryPoint - Waited for app record");
 }
 
 void TestApps(void)
@@ -1167,7 +1401,11 @@ void TestApps(void)
     CFE_ES_TaskRecord_t *UtTaskRecPtr;
     CFE_ES_AppRecord_t *UtAppRecPtr;
     CFE_ES_MemPoolRecord_t *UtPoolRecPtr;
+    uint64 CpuTimeUsec;
     char NameBuffer[OS_MAX_API_NAME+5];
+    char ScriptBuffer[256];
+    ES_UT_ModuleLoadHook_t ModuleLoadHook;
+    uint32 ProfileIdx;
 
     UtPrintf("Begin Test Apps");
 
@@ -1240,6 +1478,129 @@ void TestApps(void)
     CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR,
                              CFE_PLATFORM_ES_NONVOL_STARTUP_FILE);
     UtAssert_NONZERO(UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_ES_APP_STARTUP_OPEN]));
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 1);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_TaskCreate)), 3 + CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_CountSemDelete)), (CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS > 0) ? 2 : 0);
+    UtAssert_True(!CFE_ES_Global.StartupLoad.IsActive, "Startup load not active after script");
+
+    /* Test that the apps above a library in the startup script are started
+     * before the library is loaded, and the apps below it are loaded after
+     */
+    ES_ResetUnitTest();
+    memset(&ModuleLoadHook, 0, sizeof(ModuleLoadHook));
+    strncpy(ScriptBuffer,
+            "CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70, 4096, 0x0, 1; "
+            "CFE_LIB, /cf/apps/tst_lib.bundle, TST_LIB_Init, TST_LIB, 0, 0, 0x0, 1; "
+            "CFE_APP, /cf/apps/sch.bundle, SCH_TaskMain, SCH_APP, 120, 4096, 0x0, 1; !",
+            sizeof(ScriptBuffer) - 1);
+    ScriptBuffer[sizeof(ScriptBuffer) - 1] = '\0';
+    UT_SetReadBuffer(ScriptBuffer, strlen(ScriptBuffer));
+    UT_SetHookFunction(UT_KEY(OS_ModuleLoad), ES_UT_ModuleLoadHook, &ModuleLoadHook);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR,
+                             CFE_PLATFORM_ES_NONVOL_STARTUP_FILE);
+    UtAssert_UINT32_EQ(ModuleLoadHook.NumLoads, 3);
+    UtAssert_UINT32_EQ(ModuleLoadHook.RegisteredApps[0], 0);
+    UtAssert_UINT32_EQ(ModuleLoadHook.RegisteredApps[1], 1);
+    UtAssert_UINT32_EQ(ModuleLoadHook.RegisteredApps[2], 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 2);
+
+    /* Test starting applications where the app load semaphores
+     * cannot be created, so the apps are loaded sequentially
+     */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR,
+                             CFE_PLATFORM_ES_NONVOL_STARTUP_FILE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_TaskCreate)), 3);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_CountSemDelete)), 0);
+
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 1, OS_ERROR);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR,
+                             CFE_PLATFORM_ES_NONVOL_STARTUP_FILE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_CountSemDelete)), 1);
+
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 2, OS_ERROR);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR,
+                             CFE_PLATFORM_ES_NONVOL_STARTUP_FILE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_BinSemDelete)), 1);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_CountSemDelete)), 1);
+
+    /* Test starting applications where a load worker cannot be started,
+     * and where a queued app cannot be loaded
+     */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskCreate), 1, OS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(OS_ModuleLoad), 2, OS_ERROR);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR,
+                             CFE_PLATFORM_ES_NONVOL_STARTUP_FILE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoad.NumWorkers, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 1);
+
+    /* Test that the startup file is read in blocks rather than a byte at a time */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_POWERON,
+                             CFE_PLATFORM_ES_NONVOL_STARTUP_FILE);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_read)), 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+
+    /* Test starting applications from a startup script in memory */
+    ES_ResetUnitTest();
+    CFE_ES_StartApplicationsFromBuffer(StartupScript, NumBytes);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_OpenCreate)), 0);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_read)), 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 1);
+
+    /* Test parsing a startup script where the lines are split across blocks,
+     * and anything after the end of the script is ignored
+     */
+    ES_ResetUnitTest();
+    {
+        CFE_ES_StartScriptParser_t Parser;
+        const char *Block1 = "CFE_LIB, /cf/apps/tst_lib.bundle, ";
+        const char *Block2 = "TST_LIB_Init, TST_LIB, 0, 0, 0x0, 1";
+        const char *Block3 = "; ! CFE_LIB, /cf/apps/x.bundle, NULL, X_LIB, 0, 0, 0x0, 1;";
+
+        CFE_ES_StartScriptParserInit(&Parser);
+        UtAssert_True(!CFE_ES_StartScriptParse(&Parser, Block1, strlen(Block1)),
+                      "CFE_ES_StartScriptParse - first block");
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 0);
+        UtAssert_True(!CFE_ES_StartScriptParse(&Parser, Block2, strlen(Block2)),
+                      "CFE_ES_StartScriptParse - second block");
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 0);
+        UtAssert_True(CFE_ES_StartScriptParse(&Parser, Block3, strlen(Block3)),
+                      "CFE_ES_StartScriptParse - end of script");
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 1);
+        UtAssert_True(CFE_ES_StartScriptParse(&Parser, Block3 + 4, strlen(Block3 + 4)),
+                      "CFE_ES_StartScriptParse - after end of script");
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 1);
+    }
+
+    /* Test parsing a startup script line which exactly fills the line buffer,
+     * leaving no room for the terminator
+     */
+    ES_ResetUnitTest();
+    {
+        CFE_ES_StartScriptParser_t Parser;
+
+        memset(ScriptBuffer, 'x', CFE_ES_STARTSCRIPT_LINE_BUFFER_SIZE);
+        ScriptBuffer[CFE_ES_STARTSCRIPT_LINE_BUFFER_SIZE] = ';';
+        CFE_ES_StartScriptParserInit(&Parser);
+        CFE_ES_StartScriptParse(&Parser, ScriptBuffer, CFE_ES_STARTSCRIPT_LINE_BUFFER_SIZE + 1);
+        UtAssert_NONZERO(UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_FILE_LINE_TOO_LONG]));
+    }
 
     /* Test parsing the startup script with an unknown entry type */
     ES_ResetUnitTest();
@@ -1261,6 +1622,38 @@ void TestApps(void)
                 "Unknown entry type");
     }
 
+    /* Test the startup profile entry of an app created during startup,
+     * and that nothing is recorded once the system is operational
+     */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_ResetDataPtr->StartupProfile, 0, sizeof(CFE_ES_ResetDataPtr->StartupProfile));
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    Return = CFE_ES_AppCreate(&AppId,
+                              "ut/filename.x",
+                              "EntryPoint",
+                              "AppName",
+                              170,
+                              4096,
+                              1,
+                              0);
+    UtAssert_INT32_EQ(Return, CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_AppID_ToIndex(AppId, &ProfileIdx), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->StartupProfile.Summary.NumEntries, 1);
+    UtAssert_True(strcmp(CFE_ES_ResetDataPtr->StartupProfile.Entries[ProfileIdx].Name, "AppName") == 0 &&
+            CFE_ES_ResetDataPtr->StartupProfile.Entries[ProfileIdx].Type == CFE_ES_AppType_EXTERNAL,
+            "CFE_ES_AppCreate - startup profile entry");
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    Return = CFE_ES_AppCreate(&AppId,
+                              "ut/filename.x",
+                              "EntryPoint",
+                              "AppName2",
+                              170,
+                              4096,
+                              1,
+                              0);
+    UtAssert_INT32_EQ(Return, CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->StartupProfile.Summary.NumEntries, 1);
+
     /* Test parsing the startup script with an invalid file entry */
     ES_ResetUnitTest();
     UT_Report(__FILE__, __LINE__,
@@ -1277,7 +1670,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               4096,
-                              1);
+                              1,
+                              0);
     UtAssert_INT32_EQ(Return, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     UtAssert_NONZERO(UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_APP_CREATE]));
     
@@ -1289,7 +1683,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               4096,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_ES_BAD_ARGUMENT,
               "CFE_ES_AppCreate",
@@ -1304,7 +1699,8 @@ void TestApps(void)
                               NameBuffer,
                               170,
                               4096,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_ES_BAD_ARGUMENT,
               "CFE_ES_AppCreate",
@@ -1319,7 +1715,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_SUCCESS,
               "CFE_ES_AppCreate",
@@ -1332,7 +1729,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_ES_ERR_DUPLICATE_NAME,
               "CFE_ES_AppCreate",
@@ -1347,7 +1745,8 @@ void TestApps(void)
                               "AppName2",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UtAssert_INT32_EQ(Return, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     UtAssert_NONZERO(UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_EXTRACT_FILENAME_UT55]));
 
@@ -1360,7 +1759,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UT_Report(__FILE__, __LINE__,
               Return == CFE_ES_NO_RESOURCE_IDS_AVAILABLE &&
                 UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_NO_FREE_APP_SLOTS]),
@@ -1384,7 +1784,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UtAssert_INT32_EQ(Return, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     UtAssert_NONZERO(UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_CANNOT_FIND_SYMBOL]));
 
@@ -1401,7 +1802,8 @@ void TestApps(void)
                               "AppName",
                               170,
                               8192,
-                              1);
+                              1,
+                              0);
     UtAssert_INT32_EQ(Return, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     UtAssert_NONZERO(UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_CANNOT_FIND_SYMBOL]));
     UtAssert_NONZERO(UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_MODULE_UNLOAD_FAILED]));
@@ -1724,10 +2126,12 @@ void TestApps(void)
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
     AppId = CFE_ES_AppRecordGetID(UtAppRecPtr);
+    UtAppRecPtr->StartParams.CpuAffinity = 0x5;
     UT_Report(__FILE__, __LINE__,
               CFE_ES_GetAppInfo(&AppInfo, AppId) == CFE_SUCCESS,
               "CFE_ES_GetAppInfo",
               "Get application information; successful");
+    UtAssert_UINT32_EQ(AppInfo.CpuAffinity, 0x5);
 
     /* Test populating the application information structure with data using
      * a null application information pointer
@@ -1960,6 +2364,105 @@ void TestApps(void)
                   "CFE application; restart application on exception");
     }
 
+    /* Test parsing the startup script for a cFE application with the
+     * optional CPU affinity
+     */
+    ES_ResetUnitTest();
+    {
+        const char *TokenList[] =
+        {
+                "CFE_APP",
+                "/cf/apps/tst_lib.bundle",
+                "TST_LIB_Init",
+                "TST_LIB",
+                "0",
+                "0",
+                "0x0",
+                "0",
+                "0x6"
+        };
+        UtAssert_INT32_EQ(CFE_ES_ParseFileEntry(TokenList, 9), CFE_SUCCESS);
+        UtAppRecPtr = CFE_ES_LocateAppRecordByName("TST_LIB");
+        UtAssert_True(UtAppRecPtr != NULL && UtAppRecPtr->StartParams.CpuAffinity == 0x6,
+                "CFE_ES_ParseFileEntry - CPU affinity");
+    }
+
+    /* Test the task CPU utilization scan with a task whose CPU time
+     * cannot be read, which clears its samples and utilization
+     */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, &UtTaskRecPtr);
+    UtTaskRecPtr->NumCpuTimeSamples = 3;
+    UtTaskRecPtr->CpuUtilization = 5000;
+    UtTaskRecPtr->CpuUtilWindowMsec = 2000;
+    UT_SetBSP_Time(10, 0);
+    UtAssert_True(!CFE_ES_RunTaskUtilScan(0, NULL), "CFE_ES_RunTaskUtilScan - idle");
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskUtilSampleIdx, 1);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->NumCpuTimeSamples, 0);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->CpuUtilization, 0);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->CpuUtilWindowMsec, 0);
+    UtAssert_True(CFE_ES_TaskRecordGetCpuTime(UtTaskRecPtr) == 0, "CFE_ES_TaskRecordGetCpuTime - no samples");
+
+    /* Test the task CPU utilization scan does not sample again before it is due */
+    UT_SetBSP_Time(10, 100000);
+    CFE_ES_RunTaskUtilScan(0, NULL);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskUtilSampleIdx, 1);
+
+    /* Test the task CPU utilization over the window, with the CPU time
+     * of the task set through the stub: 0.5 s of CPU time in 1 s
+     */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, &UtTaskRecPtr);
+    UtAssert_INT32_EQ(CFE_ES_GetTaskCpuClock(&UtTaskRecPtr->CpuClock), CFE_SUCCESS);
+    CpuTimeUsec = 2000000;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_ReadTaskCpuTime), &CpuTimeUsec, sizeof(CpuTimeUsec), false);
+    UT_SetBSP_Time(10, 0);
+    CFE_ES_RunTaskUtilScan(0, NULL);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->NumCpuTimeSamples, 1);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->CpuUtilization, 0);
+    CpuTimeUsec = 2500000;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_ReadTaskCpuTime), &CpuTimeUsec, sizeof(CpuTimeUsec), false);
+    UT_SetBSP_Time(11, 0);
+    CFE_ES_RunTaskUtilScan(0, NULL);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->NumCpuTimeSamples, 2);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->CpuUtilization, 5000);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->CpuUtilWindowMsec, 1000);
+    UtAssert_True(CFE_ES_TaskRecordGetCpuTime(UtTaskRecPtr) == 2500000, "CFE_ES_TaskRecordGetCpuTime - latest sample");
+
+    /* Test more than one CPU worth of time, which is only sampling jitter, is capped */
+    CpuTimeUsec = 4500000;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_ReadTaskCpuTime), &CpuTimeUsec, sizeof(CpuTimeUsec), false);
+    UT_SetBSP_Time(12, 0);
+    CFE_ES_RunTaskUtilScan(0, NULL);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->NumCpuTimeSamples, 3);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->CpuUtilization, 10000);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->CpuUtilWindowMsec, 2000);
+
+    /* Test a task whose CPU time clock cannot be obtained */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetTaskCpuClock), CFE_ES_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(CFE_ES_GetTaskCpuClock(&UtTaskRecPtr->CpuClock), CFE_ES_NOT_IMPLEMENTED);
+    UtAssert_True(!UtTaskRecPtr->CpuClock.IsValid, "CFE_ES_GetTaskCpuClock - not available");
+
+    /* Test sending the task CPU utilization telemetry */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, &UtTaskRecPtr);
+    UtTaskRecPtr->CpuUtilization = 1234;
+    UtTaskRecPtr->CpuUtilWindowMsec = 3500;
+    CFE_ES_TaskData.TaskUtilNextTask = 0;
+    CFE_ES_SendTaskUtil();
+    UtAssert_UINT32_EQ(CFE_ES_TaskData.TaskUtilPacket.Payload.NumTasks, 1);
+    UtAssert_True(CFE_RESOURCEID_TEST_EQUAL(CFE_ES_TaskData.TaskUtilPacket.Payload.Tasks[0].TaskId,
+            CFE_ES_TaskRecordGetID(UtTaskRecPtr)), "CFE_ES_SendTaskUtil - task ID");
+    UtAssert_UINT32_EQ(CFE_ES_TaskData.TaskUtilPacket.Payload.Tasks[0].CpuUtilization, 1234);
+    UtAssert_UINT32_EQ(CFE_ES_TaskData.TaskUtilPacket.Payload.Tasks[0].WindowMsec, 3500);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)), 1);
+
+    /* Test nothing is sent when there are no tasks */
+    ES_ResetUnitTest();
+    CFE_ES_SendTaskUtil();
+    UtAssert_UINT32_EQ(CFE_ES_TaskData.TaskUtilPacket.Payload.NumTasks, 0);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)), 0);
+
     /* Test scanning and acting on the application table where the timer
      * expires for a waiting application
      */
@@ -2362,6 +2865,7 @@ void TestGenericPool(void)
     uint32                 CountBuf;
     uint32                 ErrBuf;
     CFE_ES_BlockStats_t    BlockStats;
+    CFE_ES_GenPoolBD_t    *BdPtr;
     static const size_t  UT_POOL_BLOCK_SIZES[CFE_PLATFORM_ES_POOL_MAX_BUCKETS] =
     {
             /*
@@ -2372,6 +2876,15 @@ void TestGenericPool(void)
             64, 128, 20, 24, 28, 12,
             52, 32, 4, 8, 36
     };
+    static const size_t  UT_PROFILE_BLOCK_SIZES[3] = { 32, 64, 128 };
+    /* Several sizes in the same size class, and sizes far apart */
+    static const size_t  UT_SPARSE_BLOCK_SIZES[6] = { 10, 11, 12, 13, 1000, 70000 };
+    static const size_t  UT_REPEATED_BLOCK_SIZES[6] = { 8, 8, 8, 32, 64, 32 };
+    size_t SuggestedSizes[3];
+    uint64 RequestedBytes;
+    size_t MinSize;
+    size_t MaxSize;
+    uint32 PeakInUse;
     uint16 i;
     uint32 ExpectedCount;
 
@@ -2390,6 +2903,19 @@ void TestGenericPool(void)
                 ES_UT_PoolDirectCommit),
             CFE_SUCCESS);
 
+    /* The size class lookup must pick the same bucket as a linear search */
+    ES_UT_CheckPoolFindBucket(&Pool1);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitialize(&Pool2,
+                0,
+                OffsetEnd,
+                32,
+                6,
+                UT_SPARSE_BLOCK_SIZES,
+                ES_UT_PoolDirectRetrieve,
+                ES_UT_PoolDirectCommit),
+            CFE_SUCCESS);
+    ES_UT_CheckPoolFindBucket(&Pool2);
+
     /* Allocate buffers until no space left */
     UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 44), CFE_SUCCESS);
     UtAssert_True(Offset1 > 0 && Offset1 < OffsetEnd, "0 < Offset(%lu) < %lu",
@@ -2586,6 +3112,242 @@ void TestGenericPool(void)
     Pool1.TailPosition = 0xFFFFFF;
     UtAssert_True(!CFE_ES_GenPoolValidateState(&Pool1), "Validate Corrupt handle");
 
+    /*
+     * Test buddy mode - with 32 byte alignment the descriptor occupies 32 bytes,
+     * so the block spans are 64, 128 and 256 bytes.  The direct buffer holds
+     * exactly one 256 byte span.
+     */
+    ES_ResetUnitTest();
+    memset(&UT_MemPoolDirectBuffer, 0xee, sizeof(UT_MemPoolDirectBuffer));
+    OffsetEnd = sizeof(UT_MemPoolDirectBuffer.Data);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitializeBuddy(&Pool1,
+                0,
+                OffsetEnd,
+                32,
+                CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
+                UT_POOL_BLOCK_SIZES,
+                ES_UT_PoolDirectRetrieve,
+                ES_UT_PoolDirectCommit),
+            CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Pool1.NumBuckets, 3);
+
+    /* Fill the pool with small blocks, which splits the single large span */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset3, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset4, 20), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Offset2, Offset1 + 64);
+    UtAssert_UINT32_EQ(Pool1.SplitCount, 3);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &OffsetEnd, 20), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &OffsetEnd, 100), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    /* A misaligned offset within the pool is not a valid block */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1 + 32), CFE_ES_POOL_BLOCK_INVALID);
+
+    /* Return all blocks - these should merge back into the single large span */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(BlockSize, 20);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset3), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset4), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Pool1.MergeCount, 3);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 1, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 1);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, 1);
+
+    /* Unlike the fixed bucket mode, the memory is now available for a large block */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset4, 200), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Offset4, Offset1);
+
+    /* Rebuild from a mixture of allocated and deallocated buddy blocks */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset4), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitializeBuddy(&Pool2,
+                0,
+                sizeof(UT_MemPoolDirectBuffer.Data),
+                32,
+                CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
+                UT_POOL_BLOCK_SIZES,
+                ES_UT_PoolDirectRetrieve,
+                ES_UT_PoolDirectCommit),
+            CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolRebuild(&Pool2), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Pool1.TailPosition, Pool2.TailPosition);
+    for (i=0; i < Pool1.NumBuckets; ++i)
+    {
+        ExpectedCount = Pool1.Buckets[i].ReleaseCount - Pool1.Buckets[i].RecycleCount;
+        UtAssert_UINT32_EQ(ExpectedCount, Pool2.Buckets[i].ReleaseCount - Pool2.Buckets[i].RecycleCount);
+    }
+
+    /* Freeing the last block in the rebuilt pool merges everything again */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool2, &BlockSize, Offset2), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool2, &Offset4, 200), CFE_SUCCESS);
+
+    /* Lock-free mode is not supported in combination with buddy mode */
+    UtAssert_True(!CFE_ES_GenPoolEnableLockFree(&Pool2), "Enable lock-free, buddy mode");
+
+    /*
+     * Test lock-free mode - free blocks are kept on the atomic stack,
+     * and are recycled in the same LIFO order as the locked stack.
+     */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitialize(&Pool1,
+                0,
+                sizeof(UT_MemPoolDirectBuffer.Data),
+                32,
+                CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
+                UT_POOL_BLOCK_SIZES,
+                ES_UT_PoolDirectRetrieve,
+                ES_UT_PoolDirectCommit),
+            CFE_SUCCESS);
+    UtAssert_True(CFE_ES_GenPoolEnableLockFree(&Pool1), "Enable lock-free");
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset1, 20), CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset1, 1000), CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_UINT32_EQ(Pool1.ValidationErrorCount, 1);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset3, 18), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Offset3, Offset2);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset4, 18), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Offset4, Offset1);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset3, 18), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Blocks already on the free stack are carried over when enabling */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitialize(&Pool1,
+                0,
+                sizeof(UT_MemPoolDirectBuffer.Data),
+                32,
+                CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
+                UT_POOL_BLOCK_SIZES,
+                ES_UT_PoolDirectRetrieve,
+                ES_UT_PoolDirectCommit),
+            CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1), CFE_SUCCESS);
+    UtAssert_True(CFE_ES_GenPoolEnableLockFree(&Pool1), "Enable lock-free after release");
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset2, 20), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Offset2, Offset1);
+
+    /*
+     * The descriptor is also stored in the CDS, so its layout must stay the
+     * same for a CDS written by an earlier build to be rebuilt
+     */
+    UtAssert_UINT32_EQ(offsetof(CFE_ES_GenPoolBD_t, Allocated), 2);
+    UtAssert_UINT32_EQ(sizeof(((CFE_ES_GenPoolBD_t *)0)->Allocated), 2);
+
+    /* A corrupt block taken off the free stack is counted and not handed out */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2), CFE_SUCCESS);
+    ES_UT_PoolDirectRetrieve(&Pool1, Offset2 - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    BdPtr->CheckBits = 0;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset3, 20), CFE_SUCCESS);
+    UtAssert_True(Offset3 != Offset2, "Corrupt free block not recycled");
+    UtAssert_UINT32_EQ(Pool1.ValidationErrorCount, 1);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset4, 20), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /*
+     * Test the allocation profile - the peak and requested bytes of each bucket,
+     * the size distribution, and the block sizes suggested from it.
+     */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitialize(&Pool1,
+                0,
+                sizeof(UT_MemPoolDirectBuffer.Data),
+                4,
+                3,
+                UT_PROFILE_BLOCK_SIZES,
+                ES_UT_PoolDirectRetrieve,
+                ES_UT_PoolDirectCommit),
+            CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 20), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset3, 30), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset4, 100), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1), CFE_SUCCESS);
+#if (CFE_PLATFORM_ES_MEMPOOL_PROFILE == true)
+    CFE_ES_GenPoolGetBucketProfile(&Pool1, 3, &PeakInUse, &RequestedBytes);
+    UtAssert_UINT32_EQ(PeakInUse, 3);
+    UtAssert_UINT32_EQ(RequestedBytes, 50);
+    CFE_ES_GenPoolGetBucketProfile(&Pool1, 1, &PeakInUse, &RequestedBytes);
+    UtAssert_UINT32_EQ(PeakInUse, 1);
+    UtAssert_UINT32_EQ(RequestedBytes, 100);
+    CFE_ES_GenPoolGetBucketProfile(&Pool1, 4, &PeakInUse, &RequestedBytes);
+    UtAssert_UINT32_EQ(PeakInUse, 0);
+    UtAssert_UINT32_EQ(RequestedBytes, 0);
+
+    ExpectedCount = 0;
+    i = 0;
+    while (CFE_ES_GenPoolGetSizeProfile(&Pool1, i, &MinSize, &MaxSize, &CountBuf))
+    {
+        UtAssert_True(MaxSize == 0 || (MaxSize >= MinSize && MaxSize < 2 * MinSize),
+                "Size class %u range %lu..%lu", (unsigned int)i,
+                (unsigned long)MinSize, (unsigned long)MaxSize);
+        ExpectedCount += CountBuf;
+        ++i;
+    }
+    UtAssert_UINT32_EQ(i, CFE_ES_GENERIC_POOL_PROFILE_BINS);
+    UtAssert_UINT32_EQ(ExpectedCount, 4);
+
+    /* 3 requests use a 32 byte block, 1 uses a 128 byte block */
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolCalcProfileCost(&Pool1, 3, UT_PROFILE_BLOCK_SIZES), 224);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolSuggestBlockSizes(&Pool1, 3, SuggestedSizes), 3);
+    UtAssert_UINT32_EQ(SuggestedSizes[0], 32);
+    UtAssert_UINT32_EQ(SuggestedSizes[1], 100);
+    UtAssert_UINT32_EQ(SuggestedSizes[2], 128);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolCalcProfileCost(&Pool1, 3, SuggestedSizes), 196);
+
+    /* The largest configured block size is always kept */
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolSuggestBlockSizes(&Pool1, 1, SuggestedSizes), 1);
+    UtAssert_UINT32_EQ(SuggestedSizes[0], 128);
+#else
+    /* The profile is not recorded, so there is nothing to suggest sizes from */
+    CFE_ES_GenPoolGetBucketProfile(&Pool1, 3, &PeakInUse, &RequestedBytes);
+    UtAssert_ZERO(PeakInUse);
+    UtAssert_ZERO(RequestedBytes);
+
+    ExpectedCount = 0;
+    i = 0;
+    while (CFE_ES_GenPoolGetSizeProfile(&Pool1, i, &MinSize, &MaxSize, &CountBuf))
+    {
+        ExpectedCount += CountBuf + MaxSize;
+        ++i;
+    }
+    UtAssert_UINT32_EQ(i, CFE_ES_GENERIC_POOL_PROFILE_BINS);
+    UtAssert_ZERO(ExpectedCount);
+    UtAssert_ZERO(CFE_ES_GenPoolSuggestBlockSizes(&Pool1, 3, SuggestedSizes));
+#endif
+
+    /* Rebuilding recovers the requested bytes of the blocks in use */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitialize(&Pool2,
+                0,
+                sizeof(UT_MemPoolDirectBuffer.Data),
+                4,
+                3,
+                UT_PROFILE_BLOCK_SIZES,
+                ES_UT_PoolDirectRetrieve,
+                ES_UT_PoolDirectCommit),
+            CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolRebuild(&Pool2), CFE_SUCCESS);
+    CFE_ES_GenPoolGetBucketProfile(&Pool2, 3, &PeakInUse, &RequestedBytes);
+    UtAssert_UINT32_EQ(PeakInUse, 2);
+    UtAssert_UINT32_EQ(RequestedBytes, 50);
+
+    /* Repeated block sizes are merged into one bucket */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 32, 6,
+                UT_REPEATED_BLOCK_SIZES, ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit),
+            CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Pool1.NumBuckets, 3);
+    UtAssert_UINT32_EQ(Pool1.Buckets[0].BlockSize, 8);
+    UtAssert_UINT32_EQ(Pool1.Buckets[1].BlockSize, 32);
+    UtAssert_UINT32_EQ(Pool1.Buckets[2].BlockSize, 64);
+    ES_UT_CheckPoolFindBucket(&Pool1);
+
+    /* Zero-size or empty block size lists are not valid */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitializeBuddy(&Pool1, 0, OffsetEnd, 32, 0,
+                UT_POOL_BLOCK_SIZES, ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit),
+            CFE_ES_ERR_MEM_BLOCK_SIZE);
 }
 
 
@@ -2615,6 +3377,9 @@ void TestTask(void)
         CFE_ES_DeleteCDSCmd_t        DeleteCDSCmd;
         CFE_ES_SendMemPoolStatsCmd_t SendMemPoolStatsCmd;
         CFE_ES_DumpCDSRegistryCmd_t  DumpCDSRegistryCmd;
+        CFE_ES_WriteMemPoolProfileCmd_t WriteMemPoolProfileCmd;
+        CFE_ES_SendStartupProfileCmd_t SendStartupProfileCmd;
+        CFE_ES_WriteStartupProfileCmd_t WriteStartupProfileCmd;
         CFE_ES_QueryAllTasksCmd_t    QueryAllTasksCmd;
     } CmdBuf;
     CFE_ES_AppRecord_t          *UtAppRecPtr;
@@ -3716,6 +4481,144 @@ void TestTask(void)
               "CFE_ES_DumpCDSRegistryCmd",
               "Dump CDS; OS write");
 
+    /* Test writing a memory pool profile with an invalid handle */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteMemPoolProfileCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_PROFILE_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_POOL_PROFILE_ERR_EID) &&
+              UT_GetStubCount(UT_KEY(OS_OpenCreate)) == 0,
+              "CFE_ES_WriteMemPoolProfileCmd",
+              "Write pool profile; bad handle");
+
+    /* Test successfully writing a memory pool profile to the default file */
+    ES_ResetUnitTest();
+    ES_UT_SetupMemPoolId(&UtPoolRecPtr);
+    CmdBuf.WriteMemPoolProfileCmd.Payload.PoolHandle = CFE_ES_MemPoolRecordGetID(UtPoolRecPtr);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteMemPoolProfileCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_PROFILE_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_POOL_PROFILE_INF_EID) &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 1 + CFE_ES_GENERIC_POOL_PROFILE_BINS,
+              "CFE_ES_WriteMemPoolProfileCmd",
+              "Write pool profile; success");
+
+    /* Test writing a memory pool profile with an OS create failure */
+    ES_ResetUnitTest();
+    ES_UT_SetupMemPoolId(&UtPoolRecPtr);
+    CmdBuf.WriteMemPoolProfileCmd.Payload.PoolHandle = CFE_ES_MemPoolRecordGetID(UtPoolRecPtr);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteMemPoolProfileCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_PROFILE_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_POOL_PROFILE_ERR_EID),
+              "CFE_ES_WriteMemPoolProfileCmd",
+              "Write pool profile; OS create");
+
+    /* Test writing a memory pool profile with a bad FS write header */
+    ES_ResetUnitTest();
+    ES_UT_SetupMemPoolId(&UtPoolRecPtr);
+    CmdBuf.WriteMemPoolProfileCmd.Payload.PoolHandle = CFE_ES_MemPoolRecordGetID(UtPoolRecPtr);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 1, -1);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteMemPoolProfileCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_PROFILE_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_POOL_PROFILE_ERR_EID) &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 0,
+              "CFE_ES_WriteMemPoolProfileCmd",
+              "Write pool profile; write header");
+
+    /* Test writing a memory pool profile with an OS write failure on a size record */
+    ES_ResetUnitTest();
+    ES_UT_SetupMemPoolId(&UtPoolRecPtr);
+    CmdBuf.WriteMemPoolProfileCmd.Payload.PoolHandle = CFE_ES_MemPoolRecordGetID(UtPoolRecPtr);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteMemPoolProfileCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_PROFILE_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_POOL_PROFILE_ERR_EID) &&
+              UT_GetStubCount(UT_KEY(OS_write)) == 2,
+              "CFE_ES_WriteMemPoolProfileCmd",
+              "Write pool profile; OS write");
+
+    /* Set up a previous startup profile with an app and a library entry */
+    memset(&CFE_ES_ResetDataPtr->PrevStartupProfile, 0, sizeof(CFE_ES_ResetDataPtr->PrevStartupProfile));
+    CFE_ES_ResetDataPtr->PrevStartupProfile.Summary.NumEntries = 2;
+    CFE_ES_ResetDataPtr->PrevStartupProfile.Summary.PhaseEndTime[CFE_ES_STARTUP_PHASE_OPERATIONAL] = 12345;
+    strcpy(CFE_ES_ResetDataPtr->PrevStartupProfile.Entries[0].Name, "UT_APP");
+    strcpy(CFE_ES_ResetDataPtr->PrevStartupProfile.Entries[CFE_PLATFORM_ES_MAX_APPLICATIONS].Name, "UT_LIB");
+
+    /* Test sending the startup profile telemetry with an invalid profile */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.SendStartupProfileCmd.Payload.Profile = CFE_ES_STARTUP_PROFILE_PREVIOUS + 1;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.SendStartupProfileCmd),
+            UT_TPID_CFE_ES_CMD_SEND_STARTUP_PROFILE_CC);
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_STARTUP_PROFILE_ERR_EID) &&
+            UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)) == 0,
+            "CFE_ES_SendStartupProfileCmd - bad profile");
+
+    /* Test successfully sending the previous startup profile telemetry */
+    ES_ResetUnitTest();
+    CmdBuf.SendStartupProfileCmd.Payload.Profile = CFE_ES_STARTUP_PROFILE_PREVIOUS;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.SendStartupProfileCmd),
+            UT_TPID_CFE_ES_CMD_SEND_STARTUP_PROFILE_CC);
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_STARTUP_PROFILE_INF_EID) &&
+            UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)) == 1 &&
+            CFE_ES_TaskData.StartupProfilePacket.Payload.Profile == CFE_ES_STARTUP_PROFILE_PREVIOUS &&
+            CFE_ES_TaskData.StartupProfilePacket.Payload.Summary.NumEntries == 2 &&
+            CFE_ES_TaskData.StartupProfilePacket.Payload.Summary.PhaseEndTime[CFE_ES_STARTUP_PHASE_OPERATIONAL] == 12345,
+            "CFE_ES_SendStartupProfileCmd - success");
+
+    /* Test writing the startup profile with an invalid profile */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.WriteStartupProfileCmd.Payload.Profile = CFE_ES_STARTUP_PROFILE_PREVIOUS + 1;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteStartupProfileCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_STARTUP_PROFILE_CC);
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_STARTUP_PROFILE_ERR_EID) &&
+            UT_GetStubCount(UT_KEY(OS_OpenCreate)) == 0,
+            "CFE_ES_WriteStartupProfileCmd - bad profile");
+
+    /* Test successfully writing the previous startup profile to the default file,
+     * which only writes the entries in use
+     */
+    ES_ResetUnitTest();
+    CmdBuf.WriteStartupProfileCmd.Payload.Profile = CFE_ES_STARTUP_PROFILE_PREVIOUS;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteStartupProfileCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_STARTUP_PROFILE_CC);
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_STARTUP_PROFILE_INF_EID) &&
+            UT_GetStubCount(UT_KEY(OS_write)) == 3,
+            "CFE_ES_WriteStartupProfileCmd - success");
+
+    /* Test writing the startup profile with an OS create failure */
+    ES_ResetUnitTest();
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteStartupProfileCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_STARTUP_PROFILE_CC);
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_STARTUP_PROFILE_ERR_EID) &&
+            UT_GetStubCount(UT_KEY(OS_write)) == 0,
+            "CFE_ES_WriteStartupProfileCmd - OS create");
+
+    /* Test writing the startup profile with a bad FS write header */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 1, -1);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteStartupProfileCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_STARTUP_PROFILE_CC);
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_STARTUP_PROFILE_ERR_EID) &&
+            UT_GetStubCount(UT_KEY(OS_write)) == 0,
+            "CFE_ES_WriteStartupProfileCmd - write header");
+
+    /* Test writing the startup profile with an OS write failure on an entry */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteStartupProfileCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_STARTUP_PROFILE_CC);
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_STARTUP_PROFILE_ERR_EID) &&
+            UT_GetStubCount(UT_KEY(OS_write)) == 2,
+            "CFE_ES_WriteStartupProfileCmd - OS write");
+
     /* Test telemetry pool statistics retrieval with an invalid handle */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
@@ -4025,6 +4928,10 @@ void TestTask(void)
 
 void TestPerf(void)
 {
+    static const char * const InvalidMarkerNames[] =
+    {
+        "UT\"MARKER", "UT\\MARKER", "UT\nMARKER", "UT\tMARKER", "UT\x1FMARKER", "\x01"
+    };
     union
     {
         CFE_MSG_Message_t              Msg;
@@ -4032,7 +4939,11 @@ void TestPerf(void)
         CFE_ES_StopPerfDataCmd_t       PerfStopCmd;
         CFE_ES_SetPerfFilterMaskCmd_t  PerfSetFilterMaskCmd;
         CFE_ES_SetPerfTriggerMaskCmd_t PerfSetTrigMaskCmd;
+        CFE_ES_StartPerfStreamCmd_t    PerfStreamCmd;
+        CFE_ES_WritePerfTraceCmd_t     PerfTraceCmd;
     } CmdBuf;
+    uint32 i;
+    uint32 j;
 
     UtPrintf("Begin Test Performance Log");
 
@@ -4046,6 +4957,14 @@ void TestPerf(void)
               "CFE_ES_SetupPerfVariables",
               "Idle data collection");
 
+    /* Test the perf data version is set on a power on reset */
+    ES_ResetUnitTest();
+    CFE_ES_SetupPerfVariables(CFE_PSP_RST_TYPE_POWERON);
+    UtAssert_True(Perf->MetaData.Version == CFE_ES_PERF_DATA_VERSION &&
+            Perf->MetaData.State == CFE_ES_PERF_IDLE,
+            "CFE_ES_SetupPerfVariables - power on, Version (%u) == %u",
+            (unsigned int)Perf->MetaData.Version, (unsigned int)CFE_ES_PERF_DATA_VERSION);
+
     /* Test successful performance data collection start in START
      * trigger mode
      */
@@ -4059,6 +4978,23 @@ void TestPerf(void)
               "CFE_ES_StartPerfDataCmd",
               "Collect performance data; mode START");
 
+#if (CFE_PLATFORM_ES_PERF_LOCKFREE == true) && CFE_ES_ATOMIC_AVAILABLE
+    /* Test that the start command waits for lock-free writers, but not
+     * forever if a writer never finishes
+     */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CFE_ES_Global.PerfActiveWriters = 1;
+    Perf->MetaData.DataCount = 5;
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PERF_TRIGGER_START;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartCmd),
+            UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_TaskDelay)) == CFE_ES_PERF_WRITER_WAIT_LIMIT &&
+            Perf->MetaData.DataCount == 0 &&
+            Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER,
+            "CFE_ES_StartPerfDataCmd - Lock-free writer did not finish");
+#endif
+
     /* Test successful performance data collection start in CENTER
      * trigger mode
      */
@@ -4130,6 +5066,7 @@ void TestPerf(void)
      * start command
      */
     ES_ResetUnitTest();
+    CFE_ES_BackgroundInit();
     memset(&CFE_ES_TaskData.BackgroundPerfDumpState, 0,
             sizeof(CFE_ES_TaskData.BackgroundPerfDumpState));
     memset(&CmdBuf, 0, sizeof(CmdBuf));
@@ -4170,15 +5107,96 @@ void TestPerf(void)
               "CFE_ES_StopPerfDataCmd",
               "Stop collecting performance data (non-default file name)");
 
-    /* Test performance data collection stop with a file write in progress */
+    /* Test performance data collection stop with a file write in progress */
+    ES_ResetUnitTest();
+    CFE_ES_TaskData.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_INIT;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStopCmd),
+            UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STOPCMD_ERR2_EID),
+              "CFE_ES_StopPerfDataCmd",
+              "Stop performance data command ignored");
+
+    /* Test successful request to write the performance data as a trace */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_TaskData.BackgroundPerfDumpState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfDumpState));
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfTraceCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_PERF_TRACE_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_TRACECMD_EID) &&
+              CFE_ES_TaskData.BackgroundPerfDumpState.Format == CFE_ES_PerfDumpFormat_TRACE &&
+              CFE_ES_TaskData.BackgroundPerfDumpState.PendingState == CFE_ES_PerfDumpState_INIT,
+              "CFE_ES_WritePerfTraceCmd",
+              "Write performance data trace");
+
+    /* Test request to write a trace with a file write in progress */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfTraceCmd),
+            UT_TPID_CFE_ES_CMD_WRITE_PERF_TRACE_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_TRACECMD_ERR_EID),
+              "CFE_ES_WritePerfTraceCmd",
+              "Write trace command ignored");
+
+    /* Test successful start of performance data streaming */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_TaskData.BackgroundPerfDumpState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfDumpState));
+    memset(&CFE_ES_TaskData.BackgroundPerfStreamState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfStreamState));
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfStreamCmd.Payload.RollEntries = 100;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStreamCmd),
+            UT_TPID_CFE_ES_CMD_START_PERF_STREAM_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STREAMCMD_EID) &&
+              Perf->MetaData.State == CFE_ES_PERF_STREAMING &&
+              CFE_ES_TaskData.BackgroundPerfStreamState.PendingState == CFE_ES_PerfStreamState_OPEN_FILE &&
+              CFE_ES_TaskData.BackgroundPerfStreamState.RollEntries == 100,
+              "CFE_ES_StartPerfStreamCmd",
+              "Start streaming performance data");
+
+    /* Test start of performance data streaming while a stream is active */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStreamCmd),
+            UT_TPID_CFE_ES_CMD_START_PERF_STREAM_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STREAMCMD_ERR_EID),
+              "CFE_ES_StartPerfStreamCmd",
+              "Stream already active");
+
+    /* Test start of performance data collection while a stream is active */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartCmd),
+            UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STARTCMD_ERR_EID),
+              "CFE_ES_StartPerfDataCmd",
+              "Cannot start collecting performance data; stream active");
+
+    /* Test stopping performance data streaming */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStopCmd),
+            UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STOPCMD_EID) &&
+              Perf->MetaData.State == CFE_ES_PERF_IDLE &&
+              CFE_ES_TaskData.BackgroundPerfDumpState.PendingState == CFE_ES_PerfDumpState_IDLE,
+              "CFE_ES_StopPerfDataCmd",
+              "Stop streaming performance data");
+
+    /* Test stop command while the stream is still being written */
     ES_ResetUnitTest();
-    CFE_ES_TaskData.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_INIT;
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStopCmd),
             UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
     UT_Report(__FILE__, __LINE__,
               UT_EventIsInHistory(CFE_ES_PERF_STOPCMD_ERR2_EID),
               "CFE_ES_StopPerfDataCmd",
-              "Stop performance data command ignored");
+              "Stop command ignored; stream still being written");
+    memset(&CFE_ES_TaskData.BackgroundPerfStreamState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfStreamState));
 
     /* Test performance filter mask command with out of range filter
          mask value */
@@ -4337,6 +5355,28 @@ void TestPerf(void)
               "CFE_ES_PerfLogAdd",
               "Data count below maximum");
 
+    /* Test addition of a new entry to the performance log when the buffer
+     * is full and the end wraps around
+     */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.TriggerMask[0] = 0x0;
+    Perf->MetaData.FilterMask[0] = 0xffff;
+    Perf->MetaData.DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->MetaData.DataStart = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1;
+    Perf->MetaData.DataEnd = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UT_Report(__FILE__, __LINE__,
+              Perf->MetaData.DataCount == CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE &&
+              Perf->MetaData.DataStart == 0 &&
+              Perf->MetaData.DataEnd == 0,
+              "CFE_ES_PerfLogAdd",
+              "Buffer full; end wraps around");
+#if (CFE_PLATFORM_ES_PERF_LOCKFREE == true)
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_MutSemTake)) == 0,
+              "CFE_ES_PerfLogAdd - Lock-free; mutex not taken");
+#endif
+
     /* Test addition of a new entry to the performance log with a marker that
      * is not in the trigger mask
      */
@@ -4501,6 +5541,179 @@ void TestPerf(void)
             "CFE_ES_RunPerfLogDump - wraparound, FileSize (%u) == sizeof(CFE_ES_PerfDataEntry_t) * 4",
             (unsigned int)CFE_ES_TaskData.BackgroundPerfDumpState.FileSize);
 
+    /* Test writing the perf log as a trace - no file header, start of file,
+     * one registered marker name, two entries, and end of file are written
+     */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_TaskData.BackgroundPerfDumpState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfDumpState));
+    memset(Perf->DataBuffer, 0, sizeof(Perf->DataBuffer));
+    CFE_ES_PerfRegisterMarker(1, "UT_MARKER");
+    Perf->MetaData.DataCount = 2;
+    Perf->MetaData.DataEnd = 2;
+    Perf->MetaData.TimerTicksPerSecond = 1000000;
+    Perf->DataBuffer[0].Data = 1;
+    Perf->DataBuffer[1].Data = 1 | (1U << CFE_MISSION_ES_PERF_EXIT_BIT);
+    Perf->DataBuffer[1].TimerLower32 = 10;
+    CFE_ES_TaskData.BackgroundPerfDumpState.Format = CFE_ES_PerfDumpFormat_TRACE;
+    CFE_ES_TaskData.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_INIT;
+    for (i = 0; i < 100; ++i)
+    {
+        if (!CFE_ES_RunPerfLogDump(1000, &CFE_ES_TaskData.BackgroundPerfDumpState))
+        {
+            break;
+        }
+    }
+    UtAssert_True(CFE_ES_TaskData.BackgroundPerfDumpState.CurrentState == CFE_ES_PerfDumpState_IDLE &&
+            CFE_ES_TaskData.BackgroundPerfDumpState.TraceEvents == 3,
+            "CFE_ES_RunPerfLogDump - trace, TraceEvents (%u) == 3",
+            (unsigned int)CFE_ES_TaskData.BackgroundPerfDumpState.TraceEvents);
+    UtAssert_True(UT_GetStubCount(UT_KEY(CFE_FS_WriteHeader)) == 0 &&
+            UT_GetStubCount(UT_KEY(OS_write)) == 5,
+            "CFE_ES_RunPerfLogDump - trace, OS_write() called 5 times");
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_PERF_DATAWRITTEN_EID),
+              "CFE_ES_RunPerfLogDump - trace, generated CFE_ES_PERF_DATAWRITTEN_EID");
+
+    /* Test perf log stream state machine */
+    /* Nominal call 1 - should open the file and wait for data */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_TaskData.BackgroundPerfStreamState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfStreamState));
+    Perf->MetaData.State = CFE_ES_PERF_STREAMING;
+    Perf->MetaData.DataEnd = 0;
+    Perf->SwitchCount = 0;
+    CFE_ES_TaskData.BackgroundPerfStreamState.PendingState = CFE_ES_PerfStreamState_OPEN_FILE;
+    CFE_ES_RunPerfLogStream(1000, &CFE_ES_TaskData.BackgroundPerfStreamState);
+    UtAssert_True(CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState == CFE_ES_PerfStreamState_WAIT_DATA,
+            "CFE_ES_RunPerfLogStream - CurrentState (%d) == WAIT_DATA (%d)",
+            (int)CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState, (int)CFE_ES_PerfStreamState_WAIT_DATA);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_OpenCreate)) == 1, "CFE_ES_RunPerfLogStream - OS_OpenCreate() called");
+
+    /* Nominal call 2 - first half of the buffer is complete, but nothing is written until the next call */
+    Perf->SwitchCount = 1;
+    Perf->MetaData.DataEnd = CFE_ES_PERF_STREAM_HALF_SIZE + 1;
+    CFE_ES_RunPerfLogStream(1000, &CFE_ES_TaskData.BackgroundPerfStreamState);
+    UtAssert_True(CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState == CFE_ES_PerfStreamState_WRITE_ENTRIES &&
+            CFE_ES_TaskData.BackgroundPerfStreamState.TotalEntries == 0,
+            "CFE_ES_RunPerfLogStream - half complete, CurrentState (%d) == WRITE_ENTRIES (%d)",
+            (int)CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState, (int)CFE_ES_PerfStreamState_WRITE_ENTRIES);
+
+    /* Nominal call 3 - writes as many entries as the work credit allows */
+    CFE_ES_RunPerfLogStream(1000, &CFE_ES_TaskData.BackgroundPerfStreamState);
+    UtAssert_True(CFE_ES_TaskData.BackgroundPerfStreamState.TotalEntries == CFE_PLATFORM_ES_PERF_STREAM_ENTRIES_BTWN_DLYS,
+            "CFE_ES_RunPerfLogStream - TotalEntries (%u) == CFE_PLATFORM_ES_PERF_STREAM_ENTRIES_BTWN_DLYS",
+            (unsigned int)CFE_ES_TaskData.BackgroundPerfStreamState.TotalEntries);
+
+    /* Stop the stream - the rest of the first half and the filled part of the second half are written */
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    Perf->MetaData.DataEnd = CFE_ES_PERF_STREAM_HALF_SIZE + 3;
+    for (i = 0; i < 100; ++i)
+    {
+        if (!CFE_ES_RunPerfLogStream(1000, &CFE_ES_TaskData.BackgroundPerfStreamState))
+        {
+            break;
+        }
+    }
+    UtAssert_True(CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState == CFE_ES_PerfStreamState_IDLE &&
+            CFE_ES_TaskData.BackgroundPerfStreamState.TotalEntries == CFE_ES_PERF_STREAM_HALF_SIZE + 3 &&
+            CFE_ES_TaskData.BackgroundPerfStreamState.LostEntries == 0,
+            "CFE_ES_RunPerfLogStream - stopped, TotalEntries (%u) == CFE_ES_PERF_STREAM_HALF_SIZE + 3",
+            (unsigned int)CFE_ES_TaskData.BackgroundPerfStreamState.TotalEntries);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_close)) == 1, "CFE_ES_RunPerfLogStream - OS_close() called");
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_PERF_STREAM_EID),
+              "CFE_ES_RunPerfLogStream - stopped, generated CFE_ES_PERF_STREAM_EID");
+
+    /* Test that the stream skips ahead when the writers have overwritten the half being written */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_TaskData.BackgroundPerfStreamState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfStreamState));
+    OS_OpenCreate(&CFE_ES_TaskData.BackgroundPerfStreamState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState = CFE_ES_PerfStreamState_WRITE_ENTRIES;
+    CFE_ES_TaskData.BackgroundPerfStreamState.HalfPos = 1;
+    Perf->MetaData.State = CFE_ES_PERF_STREAMING;
+    Perf->MetaData.DataEnd = CFE_ES_PERF_STREAM_HALF_SIZE + 1;
+    Perf->SwitchCount = 3;
+    CFE_ES_RunPerfLogStream(1, &CFE_ES_TaskData.BackgroundPerfStreamState);
+    UtAssert_True(CFE_ES_TaskData.BackgroundPerfStreamState.HalvesWritten == 2 &&
+            CFE_ES_TaskData.BackgroundPerfStreamState.LostEntries == CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1,
+            "CFE_ES_RunPerfLogStream - overrun, LostEntries (%u) == CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1",
+            (unsigned int)CFE_ES_TaskData.BackgroundPerfStreamState.LostEntries);
+
+    /* Test that a block is not written when the writers move back into its half while it is copied */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_TaskData.BackgroundPerfStreamState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfStreamState));
+    OS_OpenCreate(&CFE_ES_TaskData.BackgroundPerfStreamState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState = CFE_ES_PerfStreamState_WRITE_ENTRIES;
+    Perf->MetaData.State = CFE_ES_PERF_STREAMING;
+    Perf->MetaData.DataEnd = 1;
+    Perf->SwitchCount = 1;
+    CFE_ES_RunPerfLogStream(1, &CFE_ES_TaskData.BackgroundPerfStreamState);
+    UtAssert_True(CFE_ES_TaskData.BackgroundPerfStreamState.HalvesWritten == 1 &&
+            CFE_ES_TaskData.BackgroundPerfStreamState.TotalEntries == 0 &&
+            CFE_ES_TaskData.BackgroundPerfStreamState.LostEntries == CFE_ES_PERF_STREAM_HALF_SIZE &&
+            UT_GetStubCount(UT_KEY(OS_write)) == 0,
+            "CFE_ES_RunPerfLogStream - overwritten while copied, LostEntries (%u) == CFE_ES_PERF_STREAM_HALF_SIZE",
+            (unsigned int)CFE_ES_TaskData.BackgroundPerfStreamState.LostEntries);
+
+    /* Test splitting the stream into rolling files */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_TaskData.BackgroundPerfStreamState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfStreamState));
+    OS_OpenCreate(&CFE_ES_TaskData.BackgroundPerfStreamState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState = CFE_ES_PerfStreamState_WRITE_ENTRIES;
+    CFE_ES_TaskData.BackgroundPerfStreamState.RollEntries = 10;
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    Perf->MetaData.DataEnd = 25;
+    Perf->SwitchCount = 0;
+    for (i = 0; i < 100; ++i)
+    {
+        if (!CFE_ES_RunPerfLogStream(1000, &CFE_ES_TaskData.BackgroundPerfStreamState))
+        {
+            break;
+        }
+    }
+    UtAssert_True(CFE_ES_TaskData.BackgroundPerfStreamState.TotalEntries == 25 &&
+            CFE_ES_TaskData.BackgroundPerfStreamState.FileEntries == 5 &&
+            CFE_ES_TaskData.BackgroundPerfStreamState.FileCount == 2,
+            "CFE_ES_RunPerfLogStream - rolling files, FileCount (%u) == 2",
+            (unsigned int)CFE_ES_TaskData.BackgroundPerfStreamState.FileCount);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_OpenCreate)) == 3 && UT_GetStubCount(UT_KEY(OS_close)) == 3,
+            "CFE_ES_RunPerfLogStream - rolling files, OS_OpenCreate() and OS_close() called");
+
+    /* Test a failure to open the output file */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_TaskData.BackgroundPerfStreamState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfStreamState));
+    Perf->MetaData.State = CFE_ES_PERF_STREAMING;
+    CFE_ES_TaskData.BackgroundPerfStreamState.PendingState = CFE_ES_PerfStreamState_OPEN_FILE;
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), -10);
+    CFE_ES_RunPerfLogStream(1000, &CFE_ES_TaskData.BackgroundPerfStreamState);
+    UtAssert_True(CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState == CFE_ES_PerfStreamState_IDLE &&
+            Perf->MetaData.State == CFE_ES_PERF_IDLE,
+            "CFE_ES_RunPerfLogStream - OS create fail, CurrentState (%d) == IDLE (%d)",
+            (int)CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState, (int)CFE_ES_PerfStreamState_IDLE);
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_PERF_LOG_ERR_EID),
+              "CFE_ES_RunPerfLogStream - OS create fail, generated CFE_ES_PERF_LOG_ERR_EID");
+
+    /* Test a failure to write to the output file */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_TaskData.BackgroundPerfStreamState, 0,
+            sizeof(CFE_ES_TaskData.BackgroundPerfStreamState));
+    OS_OpenCreate(&CFE_ES_TaskData.BackgroundPerfStreamState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState = CFE_ES_PerfStreamState_WRITE_ENTRIES;
+    Perf->MetaData.State = CFE_ES_PERF_STREAMING;
+    Perf->MetaData.DataEnd = CFE_ES_PERF_STREAM_HALF_SIZE + 1;
+    Perf->SwitchCount = 1;
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -10);
+    CFE_ES_RunPerfLogStream(1000, &CFE_ES_TaskData.BackgroundPerfStreamState);
+    UtAssert_True(CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState == CFE_ES_PerfStreamState_IDLE &&
+            Perf->MetaData.State == CFE_ES_PERF_IDLE,
+            "CFE_ES_RunPerfLogStream - OS_write fail, CurrentState (%d) == IDLE (%d)",
+            (int)CFE_ES_TaskData.BackgroundPerfStreamState.CurrentState, (int)CFE_ES_PerfStreamState_IDLE);
+    UtAssert_True(UT_EventIsInHistory(CFE_ES_FILEWRITE_ERR_EID),
+              "CFE_ES_RunPerfLogStream - OS_write fail, generated CFE_ES_FILEWRITE_ERR_EID");
+
     /* Confirm that the "CFE_ES_GetPerfLogDumpRemaining" function works.
      * This requires that the state is not idle, in order to get nonzero results.
      */
@@ -4516,6 +5729,122 @@ void TestPerf(void)
     /* in WRITE_PERF_ENTRIES, it should report the StateCounter */
     CFE_ES_TaskData.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
     UtAssert_True(CFE_ES_GetPerfLogDumpRemaining() == 10, " CFE_ES_GetPerfLogDumpRemaining - Active Phase");
+
+    /* Test registering performance marker names */
+    ES_ResetUnitTest();
+    UtAssert_True(CFE_ES_PerfRegisterMarker(2, "UT_MARKER") == CFE_SUCCESS &&
+            strcmp(CFE_ES_Global.PerfMarkerTable[2].Name, "UT_MARKER") == 0,
+            "CFE_ES_PerfRegisterMarker - nominal");
+    UtAssert_True(CFE_ES_PerfRegisterMarker(CFE_MISSION_ES_PERF_MAX_IDS, "UT_MARKER") == CFE_ES_BAD_ARGUMENT,
+            "CFE_ES_PerfRegisterMarker - marker out of range");
+    UtAssert_True(CFE_ES_PerfRegisterMarker(2, NULL) == CFE_ES_BAD_ARGUMENT &&
+            CFE_ES_PerfRegisterMarker(2, "") == CFE_ES_BAD_ARGUMENT,
+            "CFE_ES_PerfRegisterMarker - no name");
+    UtAssert_True(CFE_ES_PerfRegisterMarker(2, "UT_MARKER_NAME_TOO_LONG_FOR_REGISTRY") == CFE_ES_BAD_ARGUMENT,
+            "CFE_ES_PerfRegisterMarker - name too long");
+
+    /* Test names with characters which would need escaping in the trace file
+     * are rejected, and leave the registered name unchanged
+     */
+    for (i = 0; i < sizeof(InvalidMarkerNames) / sizeof(InvalidMarkerNames[0]); ++i)
+    {
+        UtAssert_True(CFE_ES_PerfRegisterMarker(2, InvalidMarkerNames[i]) == CFE_ES_BAD_ARGUMENT &&
+                strcmp(CFE_ES_Global.PerfMarkerTable[2].Name, "UT_MARKER") == 0,
+                "CFE_ES_PerfRegisterMarker - invalid character in name %u", (unsigned int)i);
+    }
+
+    /* Test a space is the lowest character accepted */
+    UtAssert_True(CFE_ES_PerfRegisterMarker(2, "UT MARKER") == CFE_SUCCESS &&
+            strcmp(CFE_ES_Global.PerfMarkerTable[2].Name, "UT MARKER") == 0,
+            "CFE_ES_PerfRegisterMarker - space in name");
+
+#if (CFE_PLATFORM_ES_PERF_MARKER_STATS == true)
+    /* Test marker statistics are kept while the perf log is idle, and an
+     * exit without an entry is not counted
+     */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    CFE_ES_PerfRegisterMarker(2, "UT_MARKER");
+    CFE_ES_PerfLogEntry(2);
+    CFE_ES_PerfLogExit(2);
+    CFE_ES_PerfLogEntry(2);
+    CFE_ES_PerfLogExit(2);
+    CFE_ES_PerfLogExit(2);
+    for (i = 0, j = 0; i < CFE_ES_PERF_STATS_HISTOGRAM_BINS; ++i)
+    {
+        j += CFE_ES_Global.PerfMarkerTable[2].Histogram[i];
+    }
+    UtAssert_True(CFE_ES_Global.PerfMarkerTable[2].Count == 2 && j == 2 &&
+            CFE_ES_Global.PerfMarkerTable[2].MinDuration <= CFE_ES_Global.PerfMarkerTable[2].MaxDuration &&
+            Perf->MetaData.DataCount == 0,
+            "CFE_ES_PerfLogAdd - marker statistics, Count (%u) == 2",
+            (unsigned int)CFE_ES_Global.PerfMarkerTable[2].Count);
+
+    /* Test sending the marker statistics */
+    CFE_ES_TaskData.PerfStatsNextMarker = 0;
+    CFE_ES_SendPerfStats();
+    UtAssert_True(CFE_ES_TaskData.PerfStatsPacket.Payload.NumMarkers == 1 &&
+            CFE_ES_TaskData.PerfStatsPacket.Payload.MarkerStats[0].MarkerId == 2 &&
+            CFE_ES_TaskData.PerfStatsPacket.Payload.MarkerStats[0].Count == 2 &&
+            strcmp(CFE_ES_TaskData.PerfStatsPacket.Payload.MarkerStats[0].Name, "UT_MARKER") == 0 &&
+            UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)) == 1,
+            "CFE_ES_SendPerfStats - one marker");
+
+    /* Test nested markers, and a marker entered again before it is exited,
+     * are each measured from their own entry
+     */
+    ES_ResetUnitTest();
+    CFE_ES_SetupPerfVariables(CFE_PSP_RST_TYPE_POWERON);
+    CFE_ES_PerfLogEntry(3);
+    CFE_ES_PerfLogEntry(4);
+    CFE_ES_PerfLogEntry(3);
+    CFE_ES_PerfLogExit(3);
+    CFE_ES_PerfLogExit(3);
+    CFE_ES_PerfLogExit(4);
+    UtAssert_True(CFE_ES_Global.PerfMarkerTable[3].Count == 2 &&
+            CFE_ES_Global.PerfMarkerTable[4].Count == 1 &&
+            CFE_ES_Global.PerfMarkerTable[3].MinDuration <= CFE_ES_Global.PerfMarkerTable[3].MaxDuration,
+            "CFE_ES_PerfLogAdd - nested marker statistics, Count (%u) == 2",
+            (unsigned int)CFE_ES_Global.PerfMarkerTable[3].Count);
+
+    /* Test entries deeper than the nesting limit are not measured */
+    ES_ResetUnitTest();
+    for (i = 0; i <= CFE_ES_PERF_STATS_MAX_NESTING; ++i)
+    {
+        CFE_ES_PerfLogEntry(5);
+    }
+    for (i = 0; i <= CFE_ES_PERF_STATS_MAX_NESTING; ++i)
+    {
+        CFE_ES_PerfLogExit(5);
+    }
+    UtAssert_True(CFE_ES_Global.PerfMarkerTable[5].Count == CFE_ES_PERF_STATS_MAX_NESTING,
+            "CFE_ES_PerfLogAdd - nesting limit, Count (%u) == CFE_ES_PERF_STATS_MAX_NESTING",
+            (unsigned int)CFE_ES_Global.PerfMarkerTable[5].Count);
+
+    /* Test markers are sent in turn when there are more than fit in a packet */
+    ES_ResetUnitTest();
+    for (i = 0; i <= CFE_MISSION_ES_PERF_STATS_MAX_MARKERS; ++i)
+    {
+        CFE_ES_Global.PerfMarkerTable[10 + i].Count = 1;
+    }
+    CFE_ES_TaskData.PerfStatsNextMarker = 0;
+    CFE_ES_SendPerfStats();
+    UtAssert_True(CFE_ES_TaskData.PerfStatsPacket.Payload.NumMarkers == CFE_MISSION_ES_PERF_STATS_MAX_MARKERS &&
+            CFE_ES_TaskData.PerfStatsPacket.Payload.MarkerStats[0].MarkerId == 10,
+            "CFE_ES_SendPerfStats - full packet");
+    CFE_ES_SendPerfStats();
+    UtAssert_True(CFE_ES_TaskData.PerfStatsPacket.Payload.NumMarkers == 1 &&
+            CFE_ES_TaskData.PerfStatsPacket.Payload.MarkerStats[0].MarkerId == 10 + CFE_MISSION_ES_PERF_STATS_MAX_MARKERS &&
+            UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)) == 2,
+            "CFE_ES_SendPerfStats - next markers");
+
+    /* Test nothing is sent when no marker has statistics */
+    ES_ResetUnitTest();
+    CFE_ES_SendPerfStats();
+    UtAssert_True(CFE_ES_TaskData.PerfStatsPacket.Payload.NumMarkers == 0 &&
+            UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)) == 0,
+            "CFE_ES_SendPerfStats - no statistics");
+#endif
 }
 
 void TestAPI(void)
@@ -4761,6 +6090,22 @@ void TestAPI(void)
               CFE_ES_GetTaskID(&TaskId) == CFE_SUCCESS,
               "CFE_ES_GetTaskID",
               "Get task ID by context successful");
+#if (CFE_PLATFORM_ES_TASK_CONTEXT_LOCKFREE == true) && CFE_ES_ATOMIC_AVAILABLE
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_MutSemTake)) == 0,
+              "CFE_ES_GetAppID - Lock-free; mutex not taken");
+
+    /* Test getting the IDs while the task record is changing, which takes the lock */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", NULL, &UtTaskRecPtr);
+    ++UtTaskRecPtr->Generation;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetAppID(&AppId) == CFE_SUCCESS &&
+              CFE_RESOURCEID_TEST_EQUAL(AppId, UtTaskRecPtr->AppId),
+              "CFE_ES_GetAppID",
+              "Task record changing; locked lookup");
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_MutSemTake)) == 1,
+              "CFE_ES_GetAppID - Task record changing; mutex taken");
+#endif
 
     /* Test getting the app name with a bad app ID */
     ES_ResetUnitTest();
@@ -4961,6 +6306,61 @@ void TestAPI(void)
     UT_Report(__FILE__, __LINE__,
               Return == CFE_SUCCESS, "CFE_ES_CreateChildTask",
               "Create child task successful");
+    UtAssert_UINT32_EQ(CFE_ES_LocateTaskRecordByID(TaskId)->CpuAffinity, 0);
+
+    /* Test creating a child task with a CPU affinity, which is
+     * recorded in the task table and reported in the task info
+     */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    Return = CFE_ES_CreateChildTaskWithAffinity(&TaskId,
+                                    "TaskName",
+                                    ES_UT_ChildTaskEntry,
+                                    StackBuf,
+                                    sizeof(StackBuf),
+                                    400,
+                                    0x3);
+    UtAssert_INT32_EQ(Return, CFE_SUCCESS);
+    UtTaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskId);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->CpuAffinity, 0x3);
+    UtAssert_True(UtTaskRecPtr->EntryFunc == ES_UT_ChildTaskEntry,
+            "CFE_ES_CreateChildTask - entry point recorded");
+    UtAssert_INT32_EQ(CFE_ES_GetTaskInfo(&TaskInfo, TaskId), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(TaskInfo.CpuAffinity, 0x3);
+
+    /* Test the child task entry point calling the recorded entry point,
+     * without an affinity
+     */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, &UtTaskRecPtr);
+    UtTaskRecPtr->EntryFunc = ES_UT_ChildTaskEntry;
+    UtTaskRecPtr->CpuAffinity = 0;
+    UT_ChildTaskEntryCount = 0;
+    CFE_ES_ChildTaskEntryPoint();
+    UtAssert_UINT32_EQ(UT_ChildTaskEntryCount, 1);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_SetTaskAffinity)), 0);
+
+    /* Test the child task entry point applying the affinity, and still
+     * calling the entry point when the affinity cannot be applied
+     */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, &UtTaskRecPtr);
+    UtTaskRecPtr->EntryFunc = ES_UT_ChildTaskEntry;
+    UtTaskRecPtr->CpuAffinity = 0x3;
+    UT_ChildTaskEntryCount = 0;
+    CFE_ES_ChildTaskEntryPoint();
+    UtAssert_UINT32_EQ(UT_ChildTaskEntryCount, 1);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_SetTaskAffinity)), 1);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_SetTaskAffinity), CFE_ES_NOT_IMPLEMENTED);
+    CFE_ES_ChildTaskEntryPoint();
+    UtAssert_UINT32_EQ(UT_ChildTaskEntryCount, 2);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_SetTaskAffinity)), 2);
+
+    /* Test the child task entry point without a task record */
+    ES_ResetUnitTest();
+    UT_ChildTaskEntryCount = 0;
+    CFE_ES_ChildTaskEntryPoint();
+    UtAssert_UINT32_EQ(UT_ChildTaskEntryCount, 0);
 
     /* Test deleting a child task using a main task's ID */
     ES_ResetUnitTest();
@@ -5103,14 +6503,19 @@ void TestAPI(void)
      * which has no failure path.
      */
 
-    /* Test calculating a CRC on a range of memory using CRC type 32
-     * NOTE: This capability is not currently implemented in cFE
-     */
+    /* Test calculating a CRC on a range of memory using CRC type 32 */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32) == 0x4E5B937F,
+              "CFE_ES_CalculateCRC",
+              "CRC-32 algorithm");
+
+    /* Test calculating a CRC on a range of memory using CRC type 32C */
     ES_ResetUnitTest();
     UT_Report(__FILE__, __LINE__,
-              CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32) == 0,
+              CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32C) == 0x383306B8,
               "CFE_ES_CalculateCRC",
-              "*Not implemented* CRC-32 algorithm");
+              "CRC-32C algorithm");
 
     /* Test calculating a CRC on a range of memory using an invalid CRC type
      */
@@ -5247,11 +6652,123 @@ void TestAPI(void)
      UtAssert_INT32_EQ(CFE_ES_GetTaskIDByName(&TaskId, "Nonexistent"), CFE_ES_ERR_NAME_NOT_FOUND);
 }
 
+/*
+** Bit at a time reference CRC, for comparison with CFE_ES_CalculateCRC
+*/
+static uint32 ES_UT_ReferenceCRC(const uint8 *DataPtr, size_t DataLength, uint32 TypeCRC)
+{
+    uint32 Poly;
+    uint32 Crc;
+    size_t i;
+    uint32 Bit;
+
+    if (TypeCRC == CFE_MISSION_ES_CRC_16)
+    {
+        Poly = 0xA001;
+        Crc = 0;
+    }
+    else
+    {
+        Poly = (TypeCRC == CFE_MISSION_ES_CRC_32) ? 0xEDB88320 : 0x82F63B78;
+        Crc = 0xFFFFFFFF;
+    }
+
+    for (i = 0; i < DataLength; ++i)
+    {
+        Crc ^= DataPtr[i];
+        for (Bit = 0; Bit < 8; ++Bit)
+        {
+            Crc = (Crc >> 1) ^ (((Crc & 1) != 0) ? Poly : 0);
+        }
+    }
+
+    if (TypeCRC == CFE_MISSION_ES_CRC_16)
+    {
+        /* The CRC-16 is returned sign extended */
+        if ((Crc & 0x8000) != 0)
+        {
+            Crc |= 0xFFFF0000;
+        }
+    }
+    else
+    {
+        Crc = ~Crc;
+    }
+
+    return Crc;
+}
+
+void TestCRC(void)
+{
+    static const uint32 CrcTypes[] = { CFE_MISSION_ES_CRC_16, CFE_MISSION_ES_CRC_32, CFE_MISSION_ES_CRC_32C };
+    static uint8 Buffer[4096];
+    uint8  Delta[40];
+    uint32 Crc;
+    uint32 DeltaCrc;
+    uint32 t;
+    uint32 Count;
+    size_t Offset;
+    size_t Size;
+    size_t i;
+
+    UtPrintf("Begin Test CRC");
+
+    /* Standard check values */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_16), 0xFFFFBB3D);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32), 0xCBF43926);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32C), 0xE3069283);
+
+    for (i = 0; i < sizeof(Buffer); ++i)
+    {
+        Buffer[i] = (uint8)((i * 2654435761UL) >> 13);
+    }
+
+    for (t = 0; t < (sizeof(CrcTypes) / sizeof(CrcTypes[0])); ++t)
+    {
+        /* Compare with the reference at all lengths and alignments around the slice size */
+        Count = 0;
+        for (Offset = 0; Offset < 8; ++Offset)
+        {
+            for (Size = 0; Size < 40; ++Size)
+            {
+                if (CFE_ES_CalculateCRC(&Buffer[Offset], Size, 0, CrcTypes[t]) !=
+                        ES_UT_ReferenceCRC(&Buffer[Offset], Size, CrcTypes[t]))
+                {
+                    ++Count;
+                }
+            }
+        }
+        UtAssert_True(Count == 0, "CRC type %lu matches reference", (unsigned long)CrcTypes[t]);
+
+        /* The CRC of one block may be continued over the next */
+        Crc = CFE_ES_CalculateCRC(Buffer, 1000, 0, CrcTypes[t]);
+        Crc = CFE_ES_CalculateCRC(&Buffer[1000], 3000, Crc, CrcTypes[t]);
+        UtAssert_UINT32_EQ(Crc, CFE_ES_CalculateCRC(Buffer, 4000, 0, CrcTypes[t]));
+
+        /* Update the CRC for a change to part of the buffer */
+        Crc = CFE_ES_CalculateCRC(Buffer, 4000, 0, CrcTypes[t]);
+        for (i = 0; i < sizeof(Delta); ++i)
+        {
+            Delta[i] = (uint8)(i + 1);
+            Buffer[1500 + i] ^= Delta[i];
+        }
+        DeltaCrc = CFE_ES_CrcRawUpdate(CrcTypes[t], 0, Delta, sizeof(Delta));
+        UtAssert_UINT32_EQ(CFE_ES_CrcApplyDelta(CrcTypes[t], Crc, DeltaCrc, 4000 - 1500 - sizeof(Delta)),
+                CFE_ES_CalculateCRC(Buffer, 4000, 0, CrcTypes[t]));
+        for (i = 0; i < sizeof(Delta); ++i)
+        {
+            Buffer[1500 + i] ^= Delta[i];
+        }
+    }
+}
+
 void TestGenericCounterAPI(void)
 {
     char CounterName[11];
+    char FullName[CFE_MISSION_ES_GEN_COUNTER_MAX_FULL_NAME_LEN];
     CFE_ES_CounterId_t CounterId;
     CFE_ES_CounterId_t CounterId2;
+    CFE_ES_AppRecord_t *UtAppRecPtr;
     uint32 CounterCount;
     int i;
 
@@ -5448,6 +6965,70 @@ void TestGenericCounterAPI(void)
     UtAssert_INT32_EQ(CFE_ES_GetGenCounterName(CounterName, CFE_ES_COUNTERID_UNDEFINED, sizeof(CounterName)), CFE_ES_ERR_RESOURCEID_NOT_VALID);
     UtAssert_INT32_EQ(CFE_ES_GetGenCounterName(NULL, CounterId, sizeof(CounterName)), CFE_ES_BAD_ARGUMENT);
     UtAssert_INT32_EQ(CFE_ES_GetGenCounterIDByName(&CounterId, NULL), CFE_ES_BAD_ARGUMENT);
+
+    /* Test adding to a generic counter, including wrapping around */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_RegisterGenCounter(&CounterId, "Counter1"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_AddGenCounter(CFE_ES_COUNTERID_UNDEFINED, 5), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_AddGenCounter(CounterId, 5), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_IncrementGenCounter(CounterId), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GetGenCount(CounterId, &CounterCount), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CounterCount, 6);
+    UtAssert_INT32_EQ(CFE_ES_SetGenCount(CounterId, 0xFFFFFFFF), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_AddGenCounter(CounterId, 2), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GetGenCount(CounterId, &CounterCount), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CounterCount, 1);
+    UtAssert_INT32_EQ(CFE_ES_DeleteGenCounter(CounterId), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_AddGenCounter(CounterId, 1), CFE_ES_BAD_ARGUMENT);
+
+    /* Test registering generic counters under the calling app's name */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_RegisterAppGenCounter(NULL, "Counter1"), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_RegisterAppGenCounter(&CounterId, NULL), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_RegisterAppGenCounter(&CounterId, ""), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_RegisterAppGenCounter(&CounterId,
+            "ThisCounterNameIsMuchTooLongToRegister"), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_RegisterAppGenCounter(&CounterId, "Counter1"), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_True(!CFE_RESOURCEID_TEST_DEFINED(CounterId), "CFE_ES_RegisterAppGenCounter - no app context");
+
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", &UtAppRecPtr, NULL);
+    UtAssert_INT32_EQ(CFE_ES_RegisterGenCounter(&CounterId2, "Counter1"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_RegisterAppGenCounter(&CounterId, "Counter1"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_RegisterAppGenCounter(&CounterId2, "Counter1"), CFE_ES_ERR_DUPLICATE_NAME);
+    UtAssert_INT32_EQ(CFE_ES_GetGenCounterName(FullName, CounterId, sizeof(FullName)), CFE_SUCCESS);
+    UtAssert_True(strcmp(FullName, "UT.Counter1") == 0, "CFE_ES_RegisterAppGenCounter - full name");
+    UtAssert_INT32_EQ(CFE_ES_GetGenCounterIDByName(&CounterId2, "UT.Counter1"), CFE_SUCCESS);
+    UtAssert_True(CFE_RESOURCEID_TEST_EQUAL(CounterId, CounterId2), "Counter IDs Match");
+
+    /* Test the app's counters are deleted with the app, and others are not */
+    UtAssert_INT32_EQ(CFE_ES_CleanUpApp(CFE_ES_AppRecordGetID(UtAppRecPtr)), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_IncrementGenCounter(CounterId), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GetGenCounterIDByName(&CounterId2, "UT.Counter1"), CFE_ES_ERR_NAME_NOT_FOUND);
+    UtAssert_INT32_EQ(CFE_ES_GetGenCounterIDByName(&CounterId2, "Counter1"), CFE_SUCCESS);
+
+    /* Test nothing is sent in a snapshot when there are no counters */
+    ES_ResetUnitTest();
+    CFE_ES_SendGenCounterSnapshot();
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)), 0);
+
+    /* Test a snapshot of all the counters is sent in as many packets as needed */
+    ES_ResetUnitTest();
+    for (i = 0; i <= CFE_MISSION_ES_GEN_COUNTER_SNAPSHOT_MAX_COUNTERS; i++)
+    {
+        snprintf(CounterName, sizeof(CounterName), "Counter%d", i + 1);
+        UtAssert_INT32_EQ(CFE_ES_RegisterGenCounter(&CounterId, CounterName), CFE_SUCCESS);
+    }
+    CFE_ES_SetGenCount(CounterId, 42);
+    CFE_ES_SendGenCounterSnapshot();
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)), 2);
+    UtAssert_UINT32_EQ(CFE_ES_TaskData.GenCounterPacket.Payload.PacketNumber, 1);
+    UtAssert_True(CFE_ES_TaskData.GenCounterPacket.Payload.LastPacket, "CFE_ES_SendGenCounterSnapshot - last packet");
+    UtAssert_UINT32_EQ(CFE_ES_TaskData.GenCounterPacket.Payload.NumCounters, 1);
+    UtAssert_True(CFE_RESOURCEID_TEST_EQUAL(CFE_ES_TaskData.GenCounterPacket.Payload.Counters[0].CounterId,
+            CounterId), "CFE_ES_SendGenCounterSnapshot - counter ID");
+    UtAssert_UINT32_EQ(CFE_ES_TaskData.GenCounterPacket.Payload.Counters[0].Count, 42);
+    UtAssert_True(strcmp(CFE_ES_TaskData.GenCounterPacket.Payload.Counters[0].CounterName, CounterName) == 0,
+            "CFE_ES_SendGenCounterSnapshot - counter name");
 }
 
 void TestCDS()
@@ -5638,6 +7219,20 @@ void TestCDS()
               "CFE_ES_RestoreFromCDS",
               "Restore from CDS successful");
 
+    /* Test copying a range to a CDS */
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CopyToCDSRange(CDSHandle, &BlockData[4], 4, 8) == CFE_SUCCESS,
+              "CFE_ES_CopyToCDSRange",
+              "Copy range to CDS successful");
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CopyToCDSRange(CDSHandle, NULL, 4, 8) == CFE_ES_BAD_ARGUMENT,
+              "CFE_ES_CopyToCDSRange",
+              "Copy range to CDS null pointer");
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CopyToCDSRange(CDSHandle, &BlockData[4], 4, 0) == CFE_ES_BAD_ARGUMENT,
+              "CFE_ES_CopyToCDSRange",
+              "Copy range to CDS zero size");
+
     /* Test CDS registering using a name longer than the maximum allowed */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
@@ -5936,6 +7531,14 @@ void TestCDSMempool(void)
     size_t                 SavedSize;
     size_t                 SavedOffset;
     uint8                 *CdsPtr;
+    uint8                  RangeData[300];
+    uint8                  ReadData[300];
+    size_t                 BlockOffsets[20];
+    size_t                 BlockSize;
+    size_t                 SavedTail;
+    uint32                 SavedCount;
+    uint32                 ReadCount;
+    uint32                 i;
 
     UtPrintf("Begin Test CDS memory pool");
 
@@ -6095,6 +7698,78 @@ void TestCDSMempool(void)
               "CFE_ES_CDSBlockRead",
               "CRC error on content");
     CdsPtr[UtCdsRegRecPtr->BlockOffset] ^= 0x02;  /* Fix Bit */
+
+    /* Test CDS block range write */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    ES_UT_SetupSingleCDSRegistry("UT", sizeof(RangeData) + sizeof(CFE_ES_CDS_BlockHeader_t),
+            false, &UtCdsRegRecPtr);
+    BlockHandle = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
+    for (i = 0; i < sizeof(RangeData); ++i)
+    {
+        RangeData[i] = i;
+    }
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, RangeData), CFE_SUCCESS);
+
+    /* The CRC is updated for the range, so the whole block still reads back correctly */
+    memset(&RangeData[10], 0xA5, 7);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, &RangeData[10], 10, 7), CFE_SUCCESS);
+    RangeData[sizeof(RangeData) - 1] = 0x5A;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, &RangeData[sizeof(RangeData) - 1],
+            sizeof(RangeData) - 1, 1), CFE_SUCCESS);
+    memset(ReadData, 0, sizeof(ReadData));
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(ReadData, BlockHandle), CFE_SUCCESS);
+    UtAssert_True(memcmp(ReadData, RangeData, sizeof(RangeData)) == 0, "CDS range write content");
+
+    /* Ranges outside of the block */
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, sizeof(RangeData), 1),
+            CFE_ES_CDS_INVALID_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 1, sizeof(RangeData)),
+            CFE_ES_CDS_INVALID_SIZE);
+
+    /* Read errors on the header and on the previous content of the range */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 4), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 4), OS_ERROR);
+
+    /* Write error on the header */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 4), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* Invalid handle */
+    BlockHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(7));
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 4),
+            CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /*
+     * Test rebuilding the CDS pool through the descriptor read-ahead.
+     * Allocate a set of blocks and free one, then check the rebuilt
+     * pool matches, with fewer reads from the CDS than there are blocks.
+     */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    for (i = 0; i < 20; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&CFE_ES_Global.CDSVars.Pool, &BlockOffsets[i], 100 + i),
+                CFE_SUCCESS);
+    }
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&CFE_ES_Global.CDSVars.Pool, &BlockSize, BlockOffsets[5]),
+            CFE_SUCCESS);
+    SavedTail = CFE_ES_Global.CDSVars.Pool.TailPosition;
+    SavedCount = CFE_ES_Global.CDSVars.Pool.AllocationCount;
+
+    ReadCount = UT_GetStubCount(UT_KEY(CFE_PSP_ReadFromCDS));
+    UtAssert_INT32_EQ(CFE_ES_RebuildCDSPool(CFE_ES_Global.CDSVars.DataSize, CDS_POOL_OFFSET), CFE_SUCCESS);
+    ReadCount = UT_GetStubCount(UT_KEY(CFE_PSP_ReadFromCDS)) - ReadCount;
+    UtAssert_True(ReadCount > 0 && ReadCount < 20, "CDS rebuild read count (%lu)", (unsigned long)ReadCount);
+    UtAssert_True(!CFE_ES_Global.CDSVars.ReadAhead.Enabled, "CDS read-ahead disabled after rebuild");
+    UtAssert_UINT32_EQ(CFE_ES_Global.CDSVars.Pool.TailPosition, SavedTail);
+    UtAssert_UINT32_EQ(CFE_ES_Global.CDSVars.Pool.AllocationCount, SavedCount);
+
+    /* The freed block was recovered, so it is reused */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&CFE_ES_Global.CDSVars.Pool, &BlockSize, 105), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(BlockSize, BlockOffsets[5]);
 }
 
 void TestESMempool(void)
@@ -6198,6 +7873,21 @@ void TestESMempool(void)
               "CFE_ES_PutPoolBuf",
               "Return buffer to the second memory pool; successful");
 
+    /* Test recycling a pool buffer with lock-free free lists, which
+     * should not need the mutex.  Only creating a new block takes it.
+     */
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID2);
+    UtAssert_True(CFE_ES_GenPoolEnableLockFree(&PoolPtr->Pool), "Enable lock-free pool");
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UtAssert_True(CFE_ES_GetPoolBuf(&addressp2, PoolID2, 256) > 0, "Recycle pool buffer, lock-free");
+    UtAssert_True(CFE_ES_PutPoolBuf(PoolID2, addressp2) > 0, "Return pool buffer, lock-free");
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), 0);
+    UtAssert_True(CFE_ES_GetPoolBuf(&addressp2, PoolID2, 8) > 0, "Create pool buffer, lock-free");
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), 1);
+    UtAssert_True(CFE_ES_PutPoolBuf(PoolID2, addressp2) > 0, "Return pool buffer, lock-free");
+    UtAssert_True(CFE_ES_PutPoolBuf(PoolID2, addressp2) == CFE_ES_POOL_BLOCK_INVALID, "Double free, lock-free");
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), 1);
+
     /* Test handle validation using a handle with an invalid memory address */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemValidateRange), 1, -1);
     UT_Report(__FILE__, __LINE__,
@@ -6776,12 +8466,84 @@ void TestSysLog(void)
               true,
               "CFE_ES_WriteToSysLog",
               "Truncate message");
-    
+
+    /* Test appending messages which fit before the end of the log,
+     * which does not need the lock where atomics are available */
+    ES_ResetUnitTest();
+    CFE_ES_ResetDataPtr->SystemLogWriteIdx = 0;
+    CFE_ES_ResetDataPtr->SystemLogEndIdx = 0;
+    CFE_ES_ResetDataPtr->SystemLogEntryNum = 0;
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend("first\n"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend("second\n"), CFE_SUCCESS);
+    UtAssert_True(memcmp(CFE_ES_ResetDataPtr->SystemLog, "first\nsecond\n", 13) == 0,
+            "CFE_ES_SysLogAppend - Messages in order");
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->SystemLogWriteIdx, 13);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->SystemLogEndIdx, 13);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->SystemLogEntryNum, 2);
+#if CFE_ES_ATOMIC_AVAILABLE
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), 0);
+#endif
+
+    /* A message which does not fit takes the lock, and wraps in overwrite mode */
+    CFE_ES_ResetDataPtr->SystemLogWriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - 4;
+    CFE_ES_ResetDataPtr->SystemLogEndIdx = CFE_ES_ResetDataPtr->SystemLogWriteIdx;
+    CFE_ES_ResetDataPtr->SystemLogMode = CFE_ES_LogMode_OVERWRITE;
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend("wrapped\n"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), 1);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->SystemLogWriteIdx, 8);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->SystemLogEndIdx, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - 4);
+    UtAssert_True(memcmp(CFE_ES_ResetDataPtr->SystemLog, "wrapped\n", 8) == 0,
+            "CFE_ES_SysLogAppend - Wrapped message");
+
+    /* A write index left past the end of the log by a reset is recovered */
+    CFE_ES_ResetDataPtr->SystemLogWriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE + 1;
+    CFE_ES_ResetDataPtr->SystemLogEndIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE;
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend("recovered\n"), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->SystemLogWriteIdx, 10);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->SystemLogEndIdx, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE);
+
+    /* In discard mode, the log stays full */
+    CFE_ES_ResetDataPtr->SystemLogWriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE;
+    CFE_ES_ResetDataPtr->SystemLogMode = CFE_ES_LogMode_DISCARD;
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend("discarded\n"), CFE_ES_ERR_SYS_LOG_FULL);
+    UtAssert_UINT32_EQ(CFE_ES_ResetDataPtr->SystemLogWriteIdx, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE);
+}
+
+/*
+ * A submitted background job, which records the order of the calls
+ */
+typedef struct
+{
+    uint32 JobNum;
+    uint32 CallsLeft;
+} ES_UT_BackgroundJob_t;
+
+static uint32 ES_UT_BackgroundJobLog[4];
+static uint32 ES_UT_BackgroundJobLogCount;
+
+static bool ES_UT_BackgroundJob(uint32 ElapsedTime, void *Arg)
+{
+    ES_UT_BackgroundJob_t *JobPtr = Arg;
+
+    if (ES_UT_BackgroundJobLogCount < 4)
+    {
+        ES_UT_BackgroundJobLog[ES_UT_BackgroundJobLogCount] = JobPtr->JobNum;
+        ++ES_UT_BackgroundJobLogCount;
+    }
+
+    --JobPtr->CallsLeft;
+    return (JobPtr->CallsLeft > 0);
 }
 
 void TestBackground(void)
 {
     int32 status;
+    uint32 i;
+    CFE_ES_AppId_t AppId;
+    CFE_ES_AppRecord_t *UtAppRecPtr;
+    ES_UT_BackgroundJob_t LowJob;
+    ES_UT_BackgroundJob_t HighJob;
+    CFE_ES_BackgroundJobState_t *SubmittedPtr;
 
     /* CFE_ES_BackgroundInit() with default setup
      * causes  CFE_ES_CreateChildTask to fail.
@@ -6790,6 +8552,11 @@ void TestBackground(void)
     status = CFE_ES_BackgroundInit();
     UtAssert_True(status == CFE_ES_ERR_RESOURCEID_NOT_VALID, "CFE_ES_BackgroundInit - CFE_ES_CreateChildTask failure (%08x)", (unsigned int)status);
 
+    /* CFE_ES_BackgroundInit() failing to create the job mutex */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_BackgroundInit(), OS_ERROR);
+
     /* The CFE_ES_BackgroundCleanup() function has no conditionals -
      * it just needs to be executed as part of this routine,
      * and confirm that it deleted the semaphore.
@@ -6798,6 +8565,7 @@ void TestBackground(void)
     OS_BinSemCreate(&CFE_ES_Global.BackgroundTask.WorkSem, "UT", 0, 0);
     CFE_ES_BackgroundCleanup();
     UtAssert_True(UT_GetStubCount(UT_KEY(OS_BinSemDelete)) == 1, "CFE_ES_BackgroundCleanup - OS_BinSemDelete called");
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemDelete)), 1);
 
     /*
      * Test background task loop function
@@ -6832,4 +8600,141 @@ void TestBackground(void)
     UtAssert_True(CFE_ES_Global.BackgroundTask.NumJobsRunning == 1,
             "CFE_ES_BackgroundTask - Nominal, CFE_ES_Global.BackgroundTask.NumJobsRunning (%u) == 1",
             (unsigned int)CFE_ES_Global.BackgroundTask.NumJobsRunning);
+
+    /*
+     * Test submitting background jobs
+     */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(NULL, NULL, CFE_ES_BACKGROUND_PRIORITY_NORMAL, 100, 0),
+            CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(ES_UT_BackgroundJob, NULL, CFE_ES_BACKGROUND_PRIORITY_NORMAL, 0, 0),
+            CFE_ES_BAD_ARGUMENT);
+
+    /* Not called from an app */
+    UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(ES_UT_BackgroundJob, NULL, CFE_ES_BACKGROUND_PRIORITY_NORMAL, 100, 0),
+            CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* All job slots in use */
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(ES_UT_BackgroundJob, NULL, CFE_ES_BACKGROUND_PRIORITY_NORMAL, 100, 0),
+                CFE_SUCCESS);
+    }
+    UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(ES_UT_BackgroundJob, NULL, CFE_ES_BACKGROUND_PRIORITY_NORMAL, 100, 0),
+            CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(OS_BinSemGive)), CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS);
+
+    /*
+     * Submitted jobs run in priority order, and are removed once idle.
+     * The low priority job is submitted first.
+     */
+    ES_ResetUnitTest();
+    CFE_ES_BackgroundInit();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
+    memset(ES_UT_BackgroundJobLog, 0, sizeof(ES_UT_BackgroundJobLog));
+    ES_UT_BackgroundJobLogCount = 0;
+    LowJob.JobNum = 1;
+    LowJob.CallsLeft = 1;
+    HighJob.JobNum = 2;
+    HighJob.CallsLeft = 2;
+    SubmittedPtr = &CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_NUM_FIXED_JOBS];
+    UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(ES_UT_BackgroundJob, &LowJob, CFE_ES_BACKGROUND_PRIORITY_LOW, 100, 0),
+            CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(ES_UT_BackgroundJob, &HighJob, CFE_ES_BACKGROUND_PRIORITY_HIGH, 100, 0),
+            CFE_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    CFE_ES_BackgroundTask();
+    UtAssert_UINT32_EQ(ES_UT_BackgroundJobLogCount, 2);
+    UtAssert_UINT32_EQ(ES_UT_BackgroundJobLog[0], 2);
+    UtAssert_UINT32_EQ(ES_UT_BackgroundJobLog[1], 1);
+    UtAssert_True(SubmittedPtr[0].RunFunc == NULL, "CFE_ES_BackgroundTask - Idle submitted job removed");
+    UtAssert_True(SubmittedPtr[1].RunFunc != NULL, "CFE_ES_BackgroundTask - Active submitted job kept");
+    UtAssert_True(!SubmittedPtr[1].IsRunning, "CFE_ES_BackgroundTask - Job not running");
+
+    /* The active job is not due again until its period expires, or a wakeup */
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    CFE_ES_BackgroundTask();
+    UtAssert_UINT32_EQ(ES_UT_BackgroundJobLogCount, 2);
+    CFE_ES_BackgroundWakeup();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    CFE_ES_BackgroundTask();
+    UtAssert_UINT32_EQ(ES_UT_BackgroundJobLogCount, 3);
+    UtAssert_UINT32_EQ(ES_UT_BackgroundJobLog[2], 2);
+    UtAssert_True(SubmittedPtr[1].RunFunc == NULL, "CFE_ES_BackgroundTask - Finished submitted job removed");
+
+    /*
+     * A job which has missed its deadline runs before a higher priority job.
+     * The low priority job is made overdue by far more than its deadline.
+     */
+    ES_ResetUnitTest();
+    CFE_ES_BackgroundInit();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
+    memset(ES_UT_BackgroundJobLog, 0, sizeof(ES_UT_BackgroundJobLog));
+    ES_UT_BackgroundJobLogCount = 0;
+    LowJob.JobNum = 1;
+    LowJob.CallsLeft = 1;
+    HighJob.JobNum = 2;
+    HighJob.CallsLeft = 1;
+    SubmittedPtr = &CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_NUM_FIXED_JOBS];
+    UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(ES_UT_BackgroundJob, &LowJob, CFE_ES_BACKGROUND_PRIORITY_LOW, 100, 50),
+            CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(ES_UT_BackgroundJob, &HighJob, CFE_ES_BACKGROUND_PRIORITY_HIGH, 100, 0),
+            CFE_SUCCESS);
+    SubmittedPtr[0].LastRunTime = OS_TimeSubtract(SubmittedPtr[0].LastRunTime, OS_TimeAssembleFromNanoseconds(10, 0));
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    CFE_ES_BackgroundTask();
+    UtAssert_UINT32_EQ(ES_UT_BackgroundJobLogCount, 2);
+    UtAssert_UINT32_EQ(ES_UT_BackgroundJobLog[0], 1);
+    UtAssert_UINT32_EQ(ES_UT_BackgroundJobLog[1], 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.MissedDeadlines, 1);
+
+    /*
+     * Jobs of the same group do not run at the same time.  While the perf
+     * log stream is running, the perf log dump is not run, but other jobs are.
+     */
+    ES_ResetUnitTest();
+    CFE_ES_BackgroundInit();
+    CFE_ES_Global.BackgroundTask.Jobs[2].IsRunning = true;
+    CFE_ES_Global.BackgroundTask.RunningGroups = 1UL << CFE_ES_Global.BackgroundTask.Jobs[2].Group;
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    CFE_ES_BackgroundTask();
+    UtAssert_True(CFE_ES_Global.BackgroundTask.Jobs[1].Group != 0, "CFE_ES_BackgroundTask - Perf dump in a group");
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[1].WakeupCount, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[0].WakeupCount, CFE_ES_Global.BackgroundTask.WakeupCount);
+
+    /*
+     * Test removing the jobs of a deleted app
+     */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", &UtAppRecPtr, NULL);
+    AppId = CFE_ES_AppRecordGetID(UtAppRecPtr);
+    SubmittedPtr = &CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_NUM_FIXED_JOBS];
+    UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(ES_UT_BackgroundJob, NULL, CFE_ES_BACKGROUND_PRIORITY_NORMAL, 100, 0),
+            CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_BackgroundCleanUpApp(AppId), CFE_SUCCESS);
+    UtAssert_True(SubmittedPtr->RunFunc == NULL, "CFE_ES_BackgroundCleanUpApp - Pending job removed");
+
+    /* A running job is cancelled, and the cleanup reports it until the job returns */
+    UtAssert_INT32_EQ(CFE_ES_SubmitBackgroundJob(ES_UT_BackgroundJob, NULL, CFE_ES_BACKGROUND_PRIORITY_NORMAL, 100, 0),
+            CFE_SUCCESS);
+    SubmittedPtr->IsRunning = true;
+    UtAssert_INT32_EQ(CFE_ES_BackgroundCleanUpApp(AppId), CFE_ES_APP_CLEANUP_ERR);
+    UtAssert_True(SubmittedPtr->RunFunc != NULL, "CFE_ES_BackgroundCleanUpApp - Running job kept");
+    UtAssert_True(SubmittedPtr->IsCancelled, "CFE_ES_BackgroundCleanUpApp - Running job cancelled");
+    UtAssert_INT32_EQ(CFE_ES_BackgroundCleanUpApp(AppId), CFE_ES_APP_CLEANUP_ERR);
+
+    /* The app is not cleaned up by the app table scan while its job runs */
+    UtAppRecPtr->AppState = CFE_ES_AppState_WAITING;
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_SYS_DELETE;
+    UtAppRecPtr->ControlReq.AppTimerMsec = 0;
+    memset(&CFE_ES_TaskData.BackgroundAppScanState, 0, sizeof(CFE_ES_TaskData.BackgroundAppScanState));
+    UtAssert_True(CFE_ES_RunAppTableScan(0, &CFE_ES_TaskData.BackgroundAppScanState),
+            "CFE_ES_RunAppTableScan - App pending while its job runs");
+    UtAssert_True(CFE_ES_AppRecordIsUsed(UtAppRecPtr), "CFE_ES_RunAppTableScan - App not deleted");
+
+    /* Once the job has returned, and been removed by the worker, the next scan deletes the app */
+    memset(SubmittedPtr, 0, sizeof(*SubmittedPtr));
+    CFE_ES_RunAppTableScan(0, &CFE_ES_TaskData.BackgroundAppScanState);
+    UtAssert_True(!CFE_ES_AppRecordIsUsed(UtAppRecPtr), "CFE_ES_RunAppTableScan - App deleted after job returned");
 }
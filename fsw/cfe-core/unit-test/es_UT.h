@@ -53,7 +53,9 @@
 #include "cfe_version.h"
 #include "cfe_es.h"
 #include "cfe_es_cds.h"
+#include "cfe_es_atomic.h"
 #include "cfe_es_cds_mempool.h"
+#include "cfe_es_crc.h"
 #include "cfe_es_generic_pool.h"
 #include "cfe_es_global.h"
 #include "cfe_es_resource.h"
@@ -255,6 +257,7 @@ void TestCDSMempool(void);
 void TestESMempool(void);
 
 void TestSysLog(void);
+void TestCRC(void);
 void TestResourceID(void);
 void TestGenericCounterAPI(void);
 void TestGenericPool(void);
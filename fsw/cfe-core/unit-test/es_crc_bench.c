@@ -0,0 +1,96 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File:
+**    es_crc_bench.c
+**
+** Purpose:
+**    Host benchmark of the ES CRC computation.  This reports the throughput
+**    of CFE_ES_CrcRawUpdate() from cfe_es_crc.c for each CRC type, with
+**    buffers from 1 KB to 1 MB.  Each case processes 16 MB of data.
+**
+**    It is only built if ENABLE_UNIT_TEST_BENCHMARKS is set, and is not run
+**    as part of the unit tests.  The correctness of the CRCs is tested by
+**    the ES unit test.
+**
+*/
+
+/*
+** Includes
+*/
+#include "cfe_es_crc.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define ES_BENCH_MIN_SIZE       1024
+#define ES_BENCH_MAX_SIZE       (1024 * 1024)
+#define ES_BENCH_BYTES_PER_CASE (16 * 1024 * 1024)
+
+static uint8 ES_Bench_Buffer[ES_BENCH_MAX_SIZE];
+
+static double ES_Bench_GetSeconds(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return Now.tv_sec + (Now.tv_nsec / 1000000000.0);
+}
+
+int main(void)
+{
+    static const uint32 CrcTypes[] = { CFE_MISSION_ES_CRC_16, CFE_MISSION_ES_CRC_32, CFE_MISSION_ES_CRC_32C };
+    static const char * const CrcNames[] = { "CRC-16", "CRC-32", "CRC-32C" };
+    double StartTime;
+    double ElapsedTime;
+    uint32 Crc;
+    uint32 Iterations;
+    uint32 Count;
+    uint32 t;
+    size_t Size;
+    size_t i;
+
+    for (i = 0; i < sizeof(ES_Bench_Buffer); ++i)
+    {
+        ES_Bench_Buffer[i] = (uint8)((i * 2654435761UL) >> 13);
+    }
+
+    for (t = 0; t < (sizeof(CrcTypes) / sizeof(CrcTypes[0])); ++t)
+    {
+        for (Size = ES_BENCH_MIN_SIZE; Size <= ES_BENCH_MAX_SIZE; Size *= 4)
+        {
+            Iterations = ES_BENCH_BYTES_PER_CASE / Size;
+            Crc = 0;
+            StartTime = ES_Bench_GetSeconds();
+            for (Count = 0; Count < Iterations; ++Count)
+            {
+                /* feed the result back, so the calls cannot be dropped */
+                Crc = CFE_ES_CrcRawUpdate(CrcTypes[t], Crc, ES_Bench_Buffer, Size);
+            }
+            ElapsedTime = ES_Bench_GetSeconds() - StartTime;
+
+            printf("%-8s %8lu byte buffer: %8.1f MB/s (CRC 0x%08lx)\n", CrcNames[t], (unsigned long)Size,
+                   ((double)Size * Iterations) / (ElapsedTime * 1000000.0), (unsigned long)Crc);
+        }
+    }
+
+    return 0;
+}
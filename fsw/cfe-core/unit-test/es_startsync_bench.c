@@ -0,0 +1,445 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+** File:
+**    es_startsync_bench.c
+**
+** Purpose:
+**    Host benchmark of the ES startup sync.  This times the startup of a set
+**    of apps, from the creation of the core apps until the system is
+**    operational, once with the previous fixed interval polling and once with
+**    the real CFE_ES_StartupSyncWait() and CFE_ES_StartupSyncNotify() from
+**    cfe_es_startsync.c.
+**
+**    The startup protocol of ES and the apps is simulated by threads:
+**     - the core apps are started one at a time, and ES waits for each to
+**       be running before starting the next one
+**     - the startup script apps are then loaded, ES waits for all of them to
+**       reach LATE_INIT, enters APPS_INIT, waits for all of them to be
+**       running and enters OPERATIONAL
+**     - each app waits for its entry point, then calls the equivalents of
+**       WaitForSystemState(APPS_INIT), RunLoop and WaitForStartupSync
+**
+**    The OSAL binary semaphore calls used by the sync functions are
+**    implemented here with POSIX threads, so this only builds on hosts which
+**    provide them.  It is only built if ENABLE_UNIT_TEST_BENCHMARKS is set,
+**    and is not run as part of the unit tests.
+**
+*/
+
+/*
+** Includes
+*/
+#include "private/cfe_private.h"
+#include "cfe_es.h"
+#include "cfe_es_global.h"
+#include "cfe_psp.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#define ES_BENCH_CORE_APPS      5
+#define ES_BENCH_MAX_APPS       64
+#define ES_BENCH_TIMEOUT_MSEC   10000
+#define ES_BENCH_INIT_USEC      500     /* time an app takes for its own init */
+#define ES_BENCH_LOAD_USEC      200     /* time ES takes to load an app module */
+#define ES_BENCH_RUNS           5
+
+/*
+** The ES global data, of which the sync functions only use the semaphore
+*/
+CFE_ES_Global_t CFE_ES_Global;
+
+/*
+** Simulated app records
+*/
+typedef struct
+{
+    pthread_t TaskId;
+    bool      IsUsed;       /* set when the app record is finalized by ES */
+    uint32    AppState;
+} ES_Bench_App_t;
+
+static ES_Bench_App_t ES_Bench_Apps[ES_BENCH_CORE_APPS + ES_BENCH_MAX_APPS];
+static pthread_mutex_t ES_Bench_SharedDataLock = PTHREAD_MUTEX_INITIALIZER;
+static bool ES_Bench_Polling;
+
+/*
+** Binary semaphore, with the same semantics as the OSAL one.  There is only
+** the one startup sync semaphore, so the ID is not used.
+*/
+static pthread_mutex_t ES_Bench_SemLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  ES_Bench_SemCond = PTHREAD_COND_INITIALIZER;
+static bool            ES_Bench_SemValue;
+static uint32          ES_Bench_SemFlushCount;
+
+int32 OS_BinSemGive(osal_id_t sem_id)
+{
+    pthread_mutex_lock(&ES_Bench_SemLock);
+    ES_Bench_SemValue = true;
+    pthread_cond_signal(&ES_Bench_SemCond);
+    pthread_mutex_unlock(&ES_Bench_SemLock);
+    return OS_SUCCESS;
+}
+
+int32 OS_BinSemFlush(osal_id_t sem_id)
+{
+    pthread_mutex_lock(&ES_Bench_SemLock);
+    ++ES_Bench_SemFlushCount;
+    pthread_cond_broadcast(&ES_Bench_SemCond);
+    pthread_mutex_unlock(&ES_Bench_SemLock);
+    return OS_SUCCESS;
+}
+
+int32 OS_BinSemTimedWait(osal_id_t sem_id, uint32 msecs)
+{
+    struct timespec Deadline;
+    uint32 FlushCount;
+    int Result;
+    int32 Status;
+
+    clock_gettime(CLOCK_REALTIME, &Deadline);
+    Deadline.tv_sec += msecs / 1000;
+    Deadline.tv_nsec += (msecs % 1000) * 1000000L;
+    if (Deadline.tv_nsec >= 1000000000L)
+    {
+        ++Deadline.tv_sec;
+        Deadline.tv_nsec -= 1000000000L;
+    }
+
+    Result = 0;
+    pthread_mutex_lock(&ES_Bench_SemLock);
+    FlushCount = ES_Bench_SemFlushCount;
+    while (!ES_Bench_SemValue && FlushCount == ES_Bench_SemFlushCount && Result == 0)
+    {
+        Result = pthread_cond_timedwait(&ES_Bench_SemCond, &ES_Bench_SemLock, &Deadline);
+    }
+
+    if (ES_Bench_SemValue)
+    {
+        ES_Bench_SemValue = false;
+        Status = OS_SUCCESS;
+    }
+    else if (FlushCount != ES_Bench_SemFlushCount)
+    {
+        Status = OS_SUCCESS;
+    }
+    else
+    {
+        Status = OS_SEM_TIMEOUT;
+    }
+    pthread_mutex_unlock(&ES_Bench_SemLock);
+
+    return Status;
+}
+
+int32 OS_TaskDelay(uint32 millisecond)
+{
+    struct timespec Delay;
+
+    Delay.tv_sec = millisecond / 1000;
+    Delay.tv_nsec = (millisecond % 1000) * 1000000L;
+    while (nanosleep(&Delay, &Delay) != 0 && errno == EINTR)
+    {
+    }
+
+    return OS_SUCCESS;
+}
+
+void CFE_PSP_GetTime(OS_time_t *LocalTime)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    *LocalTime = OS_TimeAssembleFromNanoseconds(Now.tv_sec, Now.tv_nsec);
+}
+
+static double ES_Bench_GetMilliseconds(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (Now.tv_sec * 1000.0) + (Now.tv_nsec / 1000000.0);
+}
+
+/*
+** Waits for a state change, either through the sync functions or by the
+** fixed interval polling which was used before them
+*/
+static int32 ES_Bench_SyncWait(uint32 *WaitRemainingPtr)
+{
+    uint32 WaitTime;
+
+    if (!ES_Bench_Polling)
+    {
+        return CFE_ES_StartupSyncWait(WaitRemainingPtr);
+    }
+
+    if (*WaitRemainingPtr == 0)
+    {
+        return CFE_ES_OPERATION_TIMED_OUT;
+    }
+
+    WaitTime = *WaitRemainingPtr;
+    if (WaitTime > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
+    {
+        WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+    }
+    OS_TaskDelay(WaitTime);
+    *WaitRemainingPtr -= WaitTime;
+
+    return CFE_SUCCESS;
+}
+
+static void ES_Bench_SyncNotify(void)
+{
+    if (!ES_Bench_Polling)
+    {
+        CFE_ES_StartupSyncNotify();
+    }
+}
+
+static void ES_Bench_SetAppState(uint32 AppIdx, uint32 AppState)
+{
+    bool StateChanged;
+
+    pthread_mutex_lock(&ES_Bench_SharedDataLock);
+    StateChanged = (ES_Bench_Apps[AppIdx].AppState < AppState);
+    if (StateChanged)
+    {
+        ES_Bench_Apps[AppIdx].AppState = AppState;
+    }
+    pthread_mutex_unlock(&ES_Bench_SharedDataLock);
+
+    if (StateChanged)
+    {
+        ES_Bench_SyncNotify();
+    }
+}
+
+static void ES_Bench_SetSystemState(uint32 SystemState)
+{
+    CFE_ES_Global.SystemState = SystemState;
+    ES_Bench_SyncNotify();
+}
+
+/*
+** Equivalent of CFE_ES_WaitForSystemState()
+*/
+static void ES_Bench_WaitForSystemState(uint32 AppIdx, uint32 RequiredAppState, uint32 MinSystemState)
+{
+    uint32 WaitRemaining;
+
+    ES_Bench_SetAppState(AppIdx, RequiredAppState);
+
+    WaitRemaining = ES_BENCH_TIMEOUT_MSEC;
+    while (CFE_ES_Global.SystemState < MinSystemState)
+    {
+        if (ES_Bench_SyncWait(&WaitRemaining) != CFE_SUCCESS)
+        {
+            break;
+        }
+    }
+}
+
+static void *ES_Bench_AppMain(void *Arg)
+{
+    uint32 AppIdx;
+    uint32 WaitRemaining;
+    bool IsUsed;
+    struct timespec InitTime;
+
+    AppIdx = (uint32)(cpuaddr)Arg;
+
+    /*
+     * Equivalent of CFE_ES_GetAppEntryPoint(), which waits until ES has
+     * finalized the app record.  The polling version delayed first.
+     */
+    WaitRemaining = ES_BENCH_TIMEOUT_MSEC;
+    while (true)
+    {
+        if (ES_Bench_Polling)
+        {
+            OS_TaskDelay(CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC);
+        }
+
+        pthread_mutex_lock(&ES_Bench_SharedDataLock);
+        IsUsed = ES_Bench_Apps[AppIdx].IsUsed;
+        pthread_mutex_unlock(&ES_Bench_SharedDataLock);
+
+        if (IsUsed || (!ES_Bench_Polling && ES_Bench_SyncWait(&WaitRemaining) != CFE_SUCCESS))
+        {
+            break;
+        }
+    }
+
+    InitTime.tv_sec = 0;
+    InitTime.tv_nsec = ES_BENCH_INIT_USEC * 1000L;
+    nanosleep(&InitTime, NULL);
+
+    if (AppIdx < ES_BENCH_CORE_APPS)
+    {
+        /* core apps only wait for CORE_READY, and are then running */
+        ES_Bench_WaitForSystemState(AppIdx, CFE_ES_AppState_RUNNING, CFE_ES_SystemState_CORE_READY);
+    }
+    else
+    {
+        ES_Bench_WaitForSystemState(AppIdx, CFE_ES_AppState_LATE_INIT, CFE_ES_SystemState_APPS_INIT);
+        ES_Bench_SetAppState(AppIdx, CFE_ES_AppState_RUNNING);
+        ES_Bench_WaitForSystemState(AppIdx, CFE_ES_AppState_RUNNING, CFE_ES_SystemState_OPERATIONAL);
+    }
+
+    return NULL;
+}
+
+/*
+** Equivalent of CFE_ES_ApplicationSyncDelay(), for a range of apps
+*/
+static void ES_Bench_AppSyncDelay(uint32 FirstIdx, uint32 LastIdx, uint32 MinAppState)
+{
+    uint32 WaitRemaining;
+    uint32 AppNotReady;
+    uint32 i;
+
+    WaitRemaining = ES_BENCH_TIMEOUT_MSEC;
+    while (true)
+    {
+        AppNotReady = 0;
+        pthread_mutex_lock(&ES_Bench_SharedDataLock);
+        for (i = FirstIdx; i < LastIdx; ++i)
+        {
+            if (ES_Bench_Apps[i].IsUsed && ES_Bench_Apps[i].AppState < MinAppState)
+            {
+                ++AppNotReady;
+            }
+        }
+        pthread_mutex_unlock(&ES_Bench_SharedDataLock);
+
+        if (AppNotReady == 0 || ES_Bench_SyncWait(&WaitRemaining) != CFE_SUCCESS)
+        {
+            break;
+        }
+    }
+}
+
+static void ES_Bench_StartApp(uint32 AppIdx)
+{
+    pthread_create(&ES_Bench_Apps[AppIdx].TaskId, NULL, ES_Bench_AppMain, (void *)(cpuaddr)AppIdx);
+}
+
+static void ES_Bench_FinalizeApp(uint32 AppIdx)
+{
+    pthread_mutex_lock(&ES_Bench_SharedDataLock);
+    ES_Bench_Apps[AppIdx].IsUsed = true;
+    pthread_mutex_unlock(&ES_Bench_SharedDataLock);
+
+    /* the new app task may now get its entry point */
+    ES_Bench_SyncNotify();
+}
+
+/*
+** Times one startup, in milliseconds
+*/
+static double ES_Bench_Startup(uint32 NumApps)
+{
+    struct timespec LoadTime;
+    double StartTime;
+    uint32 i;
+
+    memset(ES_Bench_Apps, 0, sizeof(ES_Bench_Apps));
+    LoadTime.tv_sec = 0;
+    LoadTime.tv_nsec = ES_BENCH_LOAD_USEC * 1000L;
+
+    StartTime = ES_Bench_GetMilliseconds();
+
+    ES_Bench_SetSystemState(CFE_ES_SystemState_CORE_READY);
+    for (i = 0; i < ES_BENCH_CORE_APPS; ++i)
+    {
+        ES_Bench_StartApp(i);
+        ES_Bench_FinalizeApp(i);
+        ES_Bench_AppSyncDelay(i, i + 1, CFE_ES_AppState_RUNNING);
+    }
+
+    for (i = ES_BENCH_CORE_APPS; i < ES_BENCH_CORE_APPS + NumApps; ++i)
+    {
+        ES_Bench_StartApp(i);
+        nanosleep(&LoadTime, NULL);
+        ES_Bench_FinalizeApp(i);
+    }
+
+    ES_Bench_AppSyncDelay(ES_BENCH_CORE_APPS, ES_BENCH_CORE_APPS + NumApps, CFE_ES_AppState_LATE_INIT);
+    ES_Bench_SetSystemState(CFE_ES_SystemState_APPS_INIT);
+    ES_Bench_AppSyncDelay(ES_BENCH_CORE_APPS, ES_BENCH_CORE_APPS + NumApps, CFE_ES_AppState_RUNNING);
+    ES_Bench_SetSystemState(CFE_ES_SystemState_OPERATIONAL);
+
+    for (i = 0; i < ES_BENCH_CORE_APPS + NumApps; ++i)
+    {
+        pthread_join(ES_Bench_Apps[i].TaskId, NULL);
+    }
+
+    return ES_Bench_GetMilliseconds() - StartTime;
+}
+
+/*
+** Times a number of startups, and returns the median.  A waiter which misses
+** a notification waits for the poll interval, so single runs vary.
+*/
+static double ES_Bench_MedianStartup(uint32 NumApps, bool Polling)
+{
+    double Times[ES_BENCH_RUNS];
+    double Time;
+    uint32 i;
+    uint32 j;
+
+    ES_Bench_Polling = Polling;
+    for (i = 0; i < ES_BENCH_RUNS; ++i)
+    {
+        CFE_ES_Global.SystemState = CFE_ES_SystemState_UNDEFINED;
+        Time = ES_Bench_Startup(NumApps);
+        for (j = i; j > 0 && Times[j - 1] > Time; --j)
+        {
+            Times[j] = Times[j - 1];
+        }
+        Times[j] = Time;
+    }
+
+    return Times[ES_BENCH_RUNS / 2];
+}
+
+int main(void)
+{
+    static const uint32 NumApps[] = { 8, 32, ES_BENCH_MAX_APPS };
+    uint32 i;
+
+    printf("Startup of %d core apps and N script apps, poll interval %d ms, median of %d runs\n",
+           ES_BENCH_CORE_APPS, CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC, ES_BENCH_RUNS);
+
+    for (i = 0; i < sizeof(NumApps) / sizeof(NumApps[0]); ++i)
+    {
+        printf("N=%2lu: polling %7.1f ms, notified %6.1f ms\n", (unsigned long)NumApps[i],
+               ES_Bench_MedianStartup(NumApps[i], true), ES_Bench_MedianStartup(NumApps[i], false));
+    }
+
+    return 0;
+}
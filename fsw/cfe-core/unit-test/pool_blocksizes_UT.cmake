@@ -0,0 +1,170 @@
+##################################################################
+#
+# cFE memory pool block size generator unit test
+#
+# Writes memory pool profile files in both byte orders, generates the
+# block size header from them with cmake/pool_blocksizes.cmake, and
+# compares the result with the expected header.  Also checks that an
+# invalid profile file is rejected.
+#
+# Run as:
+#
+#   cmake -DCFE_SOURCE_DIR=<cfe> -DTEST_WORK_DIR=<dir> -P pool_blocksizes_UT.cmake
+#
+# The profile files are written with the printf utility, as CMake cannot
+# write binary data directly.
+#
+##################################################################
+
+include("${CFE_SOURCE_DIR}/cmake/pool_blocksizes.cmake")
+
+# Must match CFE_MISSION_ES_POOL_MAX_BUCKETS in the sample configuration
+set(UT_MAX_BUCKETS 17)
+
+##################################################################
+#
+# FUNCTION: ut_append_bytes
+#
+# Appends COUNT copies of the byte VALUE to the printf format in DATA_VAR
+#
+function(ut_append_bytes DATA_VAR VALUE COUNT)
+
+  math(EXPR DIGIT1 "${VALUE} / 64")
+  math(EXPR DIGIT2 "(${VALUE} / 8) % 8")
+  math(EXPR DIGIT3 "${VALUE} % 8")
+  set(DATA "${${DATA_VAR}}")
+  foreach(IDX RANGE 1 ${COUNT})
+    set(DATA "${DATA}\\${DIGIT1}${DIGIT2}${DIGIT3}")
+  endforeach()
+  set(${DATA_VAR} "${DATA}" PARENT_SCOPE)
+
+endfunction(ut_append_bytes)
+
+##################################################################
+#
+# FUNCTION: ut_append_uint32
+#
+# Appends a 32 bit VALUE in the given byte order to the printf format in DATA_VAR
+#
+function(ut_append_uint32 DATA_VAR VALUE IS_LITTLE_ENDIAN)
+
+  set(DATA "${${DATA_VAR}}")
+  if (IS_LITTLE_ENDIAN)
+    set(SHIFTS 0 8 16 24)
+  else (IS_LITTLE_ENDIAN)
+    set(SHIFTS 24 16 8 0)
+  endif (IS_LITTLE_ENDIAN)
+  foreach(SHIFT ${SHIFTS})
+    math(EXPR BYTE "(${VALUE} >> ${SHIFT}) & 255")
+    ut_append_bytes(DATA ${BYTE} 1)
+  endforeach()
+  set(${DATA_VAR} "${DATA}" PARENT_SCOPE)
+
+endfunction(ut_append_uint32)
+
+##################################################################
+#
+# FUNCTION: ut_write_profile
+#
+# Writes a pool profile file, as done by CFE_ES_WRITE_MEM_POOL_PROFILE_CC,
+# with NUM_BLOCK_SIZES block sizes of which the largest is LARGEST.
+# The remaining arguments are the MaxSize and Count of each size range.
+#
+function(ut_write_profile PROFILE_FILE IS_LITTLE_ENDIAN NUM_BLOCK_SIZES LARGEST)
+
+  set(RANGE_LIST ${ARGN})
+  list(LENGTH RANGE_LIST NUM_RANGES)
+  math(EXPR NUM_RANGES "${NUM_RANGES} / 2")
+
+  # Standard file header, which is always big endian
+  set(DATA)
+  ut_append_uint32(DATA 1665549617 FALSE)     # "cFE1"
+  ut_append_uint32(DATA ${POOL_PROFILE_FS_SUBTYPE} FALSE)
+  math(EXPR PAD_SIZE "${POOL_PROFILE_FS_HEADER_SIZE} - 8")
+  ut_append_bytes(DATA 0 ${PAD_SIZE})
+
+  # Fixed part of the profile
+  ut_append_bytes(DATA 0 ${POOL_PROFILE_NUM_BLOCK_SIZES_OFFSET})
+  ut_append_uint32(DATA ${NUM_BLOCK_SIZES} ${IS_LITTLE_ENDIAN})
+  math(EXPR PAD_SIZE "${POOL_PROFILE_NUM_RANGES_OFFSET} - ${POOL_PROFILE_NUM_BLOCK_SIZES_OFFSET} - 4")
+  ut_append_bytes(DATA 0 ${PAD_SIZE})
+  ut_append_uint32(DATA ${NUM_RANGES} ${IS_LITTLE_ENDIAN})
+  math(EXPR PAD_SIZE "${POOL_PROFILE_FIXED_SIZE} - ${POOL_PROFILE_NUM_RANGES_OFFSET} - 4")
+  ut_append_bytes(DATA 0 ${PAD_SIZE})
+
+  # Block profiles, only the largest block size is used by the tool
+  math(EXPR PAD_SIZE "(${NUM_BLOCK_SIZES} - 1) * ${POOL_PROFILE_BLOCK_SIZE}")
+  ut_append_bytes(DATA 0 ${PAD_SIZE})
+  ut_append_uint32(DATA ${LARGEST} ${IS_LITTLE_ENDIAN})
+  math(EXPR PAD_SIZE "((${UT_MAX_BUCKETS} - ${NUM_BLOCK_SIZES} + 1) * ${POOL_PROFILE_BLOCK_SIZE}) - 4 + (${UT_MAX_BUCKETS} * 4)")
+  ut_append_bytes(DATA 0 ${PAD_SIZE})
+
+  # Size ranges
+  while (RANGE_LIST)
+    list(GET RANGE_LIST 0 MAXSIZE)
+    list(GET RANGE_LIST 1 COUNT)
+    list(REMOVE_AT RANGE_LIST 0 1)
+    ut_append_uint32(DATA 0 ${IS_LITTLE_ENDIAN})
+    ut_append_uint32(DATA ${MAXSIZE} ${IS_LITTLE_ENDIAN})
+    ut_append_uint32(DATA ${COUNT} ${IS_LITTLE_ENDIAN})
+  endwhile (RANGE_LIST)
+
+  execute_process(COMMAND printf "${DATA}" OUTPUT_FILE "${PROFILE_FILE}" RESULT_VARIABLE RESULT)
+  if (NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Cannot write ${PROFILE_FILE}")
+  endif (NOT RESULT EQUAL 0)
+
+endfunction(ut_write_profile)
+
+file(REMOVE_RECURSE "${TEST_WORK_DIR}")
+file(MAKE_DIRECTORY "${TEST_WORK_DIR}")
+
+# Two profiles of the same pool, from targets of either byte order.
+# Together these request 8 blocks of up to 12 bytes, 2 of up to 30 bytes,
+# 1 of 100 bytes, and 1 of 600 bytes, which needs the largest block.
+set(PROFILE_LE "${TEST_WORK_DIR}/cpu1_es_pool_profile_le.dat")
+set(PROFILE_BE "${TEST_WORK_DIR}/cpu1_es_pool_profile_be.dat")
+ut_write_profile("${PROFILE_LE}" TRUE 3 512
+    10 5    30 2    0 0    100 1    600 1    0 0)
+ut_write_profile("${PROFILE_BE}" FALSE 3 512
+    12 3    0 0     0 0    0 0      0 0      0 0)
+
+set(OUTPUT_FILE "${TEST_WORK_DIR}/cfe_pool_blocksizes.h")
+generate_pool_blocksizes_header("${OUTPUT_FILE}" "" "${PROFILE_LE};${PROFILE_BE}")
+
+# Only 3 distinct sizes are used, the others repeat the smallest
+set(GUARD "GENERATED_INCLUDE_CFE_POOL_BLOCKSIZES_H")
+set(EXPECTED "/* Generated header file.  Do not edit */\n\n#ifndef ${GUARD}\n#define ${GUARD}\n")
+set(EXPECTED "${EXPECTED}\n/*\n * ES memory pool block sizes: 12 requests, average block size 64, largest block size 512\n")
+set(EXPECTED "${EXPECTED} * Computed from:\n *   ${PROFILE_LE}\n *   ${PROFILE_BE}\n */\n")
+foreach(SIZE_IDX 01 02 03 04 05 06 07 08 09 10 11 12 13 14 15 16)
+  if (SIZE_IDX EQUAL 15)
+    set(SIZE 32)
+  elseif (SIZE_IDX EQUAL 16)
+    set(SIZE 100)
+  else ()
+    set(SIZE 12)
+  endif ()
+  set(EXPECTED "${EXPECTED}#undef  CFE_PLATFORM_ES_MEM_BLOCK_SIZE_${SIZE_IDX}\n")
+  set(EXPECTED "${EXPECTED}#define CFE_PLATFORM_ES_MEM_BLOCK_SIZE_${SIZE_IDX}    ${SIZE}\n")
+endforeach()
+set(EXPECTED "${EXPECTED}\n#endif /* ${GUARD} */\n")
+
+file(READ "${OUTPUT_FILE}" ACTUAL)
+if (NOT ACTUAL STREQUAL EXPECTED)
+  message(FATAL_ERROR "Generated header does not match.\nExpected:\n${EXPECTED}\nActual:\n${ACTUAL}")
+endif (NOT ACTUAL STREQUAL EXPECTED)
+
+# A file which is not a pool profile is rejected by the command line tool
+file(WRITE "${TEST_WORK_DIR}/not_a_profile.dat" "This is an ordinary file\n")
+execute_process(COMMAND ${CMAKE_COMMAND}
+        -DOUTPUT_FILE=${TEST_WORK_DIR}/not_generated.h
+        -DES_POOL_PROFILES=${TEST_WORK_DIR}/not_a_profile.dat
+        -P "${CFE_SOURCE_DIR}/cmake/pool_blocksizes.cmake"
+    RESULT_VARIABLE RESULT
+    OUTPUT_QUIET ERROR_QUIET)
+if (RESULT EQUAL 0 OR EXISTS "${TEST_WORK_DIR}/not_generated.h")
+  message(FATAL_ERROR "Invalid profile file was not rejected")
+endif ()
+
+message(STATUS "Pool block size generator test passed")
@@ -132,6 +132,29 @@ CFE_Status_t  CFE_ES_CreateChildTask(CFE_ES_TaskId_t                 *TaskIdPtr,
     return status;
 }
 
+CFE_Status_t  CFE_ES_CreateChildTaskWithAffinity(CFE_ES_TaskId_t                 *TaskIdPtr,
+                                     const char                      *TaskName,
+                                     CFE_ES_ChildTaskMainFuncPtr_t    FunctionPtr,
+                                     CFE_ES_StackPointer_t            StackPtr,
+                                     size_t                           StackSize,
+                                     CFE_ES_TaskPriority_Atom_t       Priority,
+                                     uint32                           CpuAffinity)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_CreateChildTaskWithAffinity), TaskIdPtr);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_CreateChildTaskWithAffinity), TaskName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CreateChildTaskWithAffinity), FunctionPtr);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_CreateChildTaskWithAffinity), StackPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CreateChildTaskWithAffinity), StackSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CreateChildTaskWithAffinity), Priority);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CreateChildTaskWithAffinity), CpuAffinity);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_CreateChildTaskWithAffinity);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_GetAppID stub function
@@ -773,6 +796,33 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     UT_DEFAULT_IMPL(CFE_ES_PerfLogAdd);
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_PerfRegisterMarker stub function
+**
+** \par Description
+**        This function is used as a placeholder for the cFE ES function
+**        CFE_ES_PerfRegisterMarker.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_ES_PerfRegisterMarker(uint32 Marker, const char *MarkerName)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_PerfRegisterMarker), Marker);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_PerfRegisterMarker), MarkerName);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_PerfRegisterMarker);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_CalculateCRC stub function
@@ -917,6 +967,34 @@ int32 CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_CopyToCDSRange stub function
+**
+** \par Description
+**        This function is used as a placeholder for the cFE ES function
+**        CFE_ES_CopyToCDSRange.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size)
+{
+    int32   status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CopyToCDSRange), Handle);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_CopyToCDSRange), DataToCopy);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CopyToCDSRange), Offset);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CopyToCDSRange), Size);
+    status = UT_DEFAULT_IMPL(CFE_ES_CopyToCDSRange);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_RestoreFromCDS stub function
@@ -1161,6 +1239,21 @@ int32 CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId)
     return status;
 }
 
+CFE_Status_t CFE_ES_SubmitBackgroundJob(CFE_ES_BackgroundJobFunc_t JobFunc, void *JobArg, uint16 Priority,
+        uint32 PeriodMsec, uint32 DeadlineMsec)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_SubmitBackgroundJob), JobArg);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_SubmitBackgroundJob), Priority);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_SubmitBackgroundJob), PeriodMsec);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_SubmitBackgroundJob), DeadlineMsec);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_SubmitBackgroundJob);
+
+    return status;
+}
+
 int32 CFE_ES_DeleteGenCounter(CFE_ES_CounterId_t CounterId)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_DeleteGenCounter), CounterId);
@@ -1231,6 +1324,18 @@ int32 CFE_ES_IncrementGenCounter(CFE_ES_CounterId_t CounterId)
     return status;
 }
 
+int32 CFE_ES_AddGenCounter(CFE_ES_CounterId_t CounterId, uint32 Amount)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_AddGenCounter), CounterId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_AddGenCounter), Amount);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_AddGenCounter);
+
+    return status;
+}
+
 int32 CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *CounterName)
 {
     UT_Stub_RegisterContext(UT_KEY(CFE_ES_RegisterGenCounter), CounterIdPtr);
@@ -1243,6 +1348,18 @@ int32 CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *Co
     return status;
 }
 
+int32 CFE_ES_RegisterAppGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *CounterName)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_RegisterAppGenCounter), CounterIdPtr);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_RegisterAppGenCounter), CounterName);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_RegisterAppGenCounter);
+
+    return status;
+}
+
 int32 CFE_ES_ReloadApp(CFE_ES_AppId_t AppID, const char *AppFileName)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_ReloadApp), AppID);
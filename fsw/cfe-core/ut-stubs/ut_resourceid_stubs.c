@@ -86,6 +86,32 @@ CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32 TableS
     return CFE_ResourceId_FromInteger(CFE_ResourceId_ToInteger(StartId) + return_code);
 }
 
+CFE_ResourceId_t CFE_ResourceId_FindNextFree(CFE_ResourceId_t StartId, uint32 TableSize, uint32 *SlotMap, bool (*CheckFunc)(CFE_ResourceId_t))
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_FindNextFree), StartId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_FindNextFree), TableSize);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ResourceId_FindNextFree), SlotMap);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_FindNextFree), CheckFunc);
+
+    UT_DEFAULT_IMPL(CFE_ResourceId_FindNextFree);
+
+    /*
+     * The result is the same as CFE_ResourceId_FindNext(), so test cases
+     * control both through the CFE_ResourceId_FindNext() stub
+     */
+    return CFE_ResourceId_FindNext(StartId, TableSize, CheckFunc);
+}
+
+void CFE_ResourceId_SlotMapMark(uint32 *SlotMap, uint32 TableSize, uint32 EntryIdx, bool IsUsed)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ResourceId_SlotMapMark), SlotMap);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_SlotMapMark), TableSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_SlotMapMark), EntryIdx);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_SlotMapMark), IsUsed);
+
+    UT_DEFAULT_IMPL(CFE_ResourceId_SlotMapMark);
+}
+
 int32 CFE_ResourceId_ToIndex(CFE_ResourceId_t Id, uint32 BaseValue, uint32 TableSize, uint32 *Idx)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_ToIndex), Id);
@@ -119,3 +145,57 @@ int32 CFE_ResourceId_ToIndex(CFE_ResourceId_t Id, uint32 BaseValue, uint32 Table
     return return_code;
 }
 
+
+void CFE_ResourceId_NameIndexAdd(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 EntryIdx, const char *Name)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ResourceId_NameIndexAdd), Index);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_NameIndexAdd), TableSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_NameIndexAdd), EntryIdx);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ResourceId_NameIndexAdd), Name);
+
+    UT_DEFAULT_IMPL(CFE_ResourceId_NameIndexAdd);
+}
+
+void CFE_ResourceId_NameIndexRemove(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 EntryIdx)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ResourceId_NameIndexRemove), Index);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_NameIndexRemove), TableSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_NameIndexRemove), EntryIdx);
+
+    UT_DEFAULT_IMPL(CFE_ResourceId_NameIndexRemove);
+}
+
+int32 CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, const char *Name,
+        bool (*MatchFunc)(uint32, const char *), uint32 *EntryIdx)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ResourceId_NameIndexFind), Index);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_NameIndexFind), TableSize);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ResourceId_NameIndexFind), Name);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ResourceId_NameIndexFind), MatchFunc);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ResourceId_NameIndexFind), EntryIdx);
+
+    int32  return_code;
+    uint32 Idx;
+
+    return_code = UT_DEFAULT_IMPL(CFE_ResourceId_NameIndexFind);
+
+    /*
+     * Mimic a typical output by checking every entry, so the test case
+     * can set up table entries directly without maintaining the index.
+     */
+    if (return_code == CFE_SUCCESS)
+    {
+        return_code = CFE_ES_ERR_NAME_NOT_FOUND;
+        for (Idx = 0; Idx < TableSize; ++Idx)
+        {
+            if (MatchFunc(Idx, Name))
+            {
+                *EntryIdx   = Idx;
+                return_code = CFE_SUCCESS;
+                break;
+            }
+        }
+    }
+
+    return return_code;
+}
@@ -132,3 +132,266 @@ CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32 TableS
 
     return CheckId;
 }
+
+/*********************************************************************/
+/*
+ * CFE_ResourceId_SerialAfter
+ *
+ * Local helper to get the serial number which CFE_ResourceId_FindNext() checks
+ * at the given step after the starting serial number, including the wrap
+ * when CFE_RESOURCEID_MAX is reached.  The table index of the result is
+ * always (Serial + Steps) % TableSize.
+ */
+static uint32 CFE_ResourceId_SerialAfter(uint32 Serial, uint32 Steps, uint32 TableSize)
+{
+    uint32 WrapSteps;
+
+    if (Serial >= CFE_RESOURCEID_MAX)
+    {
+        WrapSteps = 1;
+    }
+    else
+    {
+        WrapSteps = CFE_RESOURCEID_MAX - Serial;
+    }
+
+    if (Steps < WrapSteps)
+    {
+        return Serial + Steps;
+    }
+
+    return ((Serial + WrapSteps) % TableSize) + (Steps - WrapSteps);
+}
+
+/*********************************************************************/
+/*
+ * CFE_ResourceId_FindNextFree
+ *
+ * For complete API information, see prototype in header
+ */
+CFE_ResourceId_t CFE_ResourceId_FindNextFree(CFE_ResourceId_t StartId, uint32 TableSize, uint32 *SlotMap, bool (*CheckFunc)(CFE_ResourceId_t))
+{
+    uint32           Serial;
+    uint32           ResourceType;
+    uint32           Steps;
+    uint32           Idx;
+    uint32           Span;
+    uint32           Mask;
+    CFE_ResourceId_t CheckId;
+
+    if (SlotMap == NULL || TableSize == 0)
+    {
+        return CFE_ResourceId_FindNext(StartId, TableSize, CheckFunc);
+    }
+
+    ResourceType = CFE_ResourceId_GetBase(StartId);
+    Serial       = CFE_ResourceId_GetSerial(StartId);
+
+    /*
+     * Idx is the table index of the ID which is (Steps + 1) after StartId.
+     * Indices follow the steps in order, wrapping at the end of the table.
+     */
+    Steps = 0;
+    Idx   = CFE_ResourceId_SerialAfter(Serial, 1, TableSize) % TableSize;
+    while (Steps < TableSize)
+    {
+        Span = 32 - (Idx % 32);
+        if (Span > (TableSize - Idx))
+        {
+            Span = TableSize - Idx;
+        }
+        Mask = (0xFFFFFFFFU >> (32 - Span)) << (Idx % 32);
+
+        if ((SlotMap[Idx / 32] & Mask) == Mask)
+        {
+            /* All remaining entries in this word are used */
+            Steps += Span;
+            Idx += Span;
+        }
+        else
+        {
+            if ((SlotMap[Idx / 32] & (1U << (Idx % 32))) == 0)
+            {
+                CheckId = CFE_ResourceId_FromInteger(ResourceType + CFE_ResourceId_SerialAfter(Serial, Steps + 1, TableSize));
+                if (!CheckFunc(CheckId))
+                {
+                    return CheckId;
+                }
+
+                /* The entry is in use but was not marked in the map */
+                SlotMap[Idx / 32] |= 1U << (Idx % 32);
+            }
+
+            ++Steps;
+            ++Idx;
+        }
+
+        if (Idx >= TableSize)
+        {
+            Idx = 0;
+        }
+    }
+
+    /*
+     * The map shows every entry as used, which is normally because the table
+     * is full.  Check every entry in case an entry was freed without being
+     * marked, as CFE_ResourceId_FindNext() would.
+     */
+    for (Steps = 1; Steps <= TableSize; ++Steps)
+    {
+        CheckId = CFE_ResourceId_FromInteger(ResourceType + CFE_ResourceId_SerialAfter(Serial, Steps, TableSize));
+        if (!CheckFunc(CheckId))
+        {
+            Idx = (Serial + Steps) % TableSize;
+            SlotMap[Idx / 32] &= ~(1U << (Idx % 32));
+            return CheckId;
+        }
+    }
+
+    return CFE_RESOURCEID_UNDEFINED;
+}
+
+/*********************************************************************/
+/*
+ * CFE_ResourceId_SlotMapMark
+ *
+ * For complete API information, see prototype in header
+ */
+void CFE_ResourceId_SlotMapMark(uint32 *SlotMap, uint32 TableSize, uint32 EntryIdx, bool IsUsed)
+{
+    if (SlotMap == NULL || EntryIdx >= TableSize)
+    {
+        return;
+    }
+
+    if (IsUsed)
+    {
+        SlotMap[EntryIdx / 32] |= 1U << (EntryIdx % 32);
+    }
+    else
+    {
+        SlotMap[EntryIdx / 32] &= ~(1U << (EntryIdx % 32));
+    }
+}
+
+/*********************************************************************/
+/*
+ * CFE_ResourceId_NameHash
+ *
+ * Local helper to compute the hash of a name for the name index (32 bit FNV-1a)
+ */
+static uint32 CFE_ResourceId_NameHash(const char *Name)
+{
+    uint32 Hash;
+
+    Hash = 2166136261U;
+    while (*Name != 0)
+    {
+        Hash ^= (uint8)*Name;
+        Hash *= 16777619U;
+        ++Name;
+    }
+
+    return Hash;
+}
+
+/*********************************************************************/
+/*
+ * CFE_ResourceId_NameIndexRemove
+ *
+ * For complete API information, see prototype in header
+ */
+void CFE_ResourceId_NameIndexRemove(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 EntryIdx)
+{
+    uint16 *LinkPtr;
+    uint32  Count;
+
+    if (Index == NULL || EntryIdx >= TableSize)
+    {
+        return;
+    }
+
+    /*
+     * Search the chain of the bucket the entry was last added to.  If the
+     * entry was never added (or already removed) it is not found.  The search
+     * is limited to the table size in case the index is corrupt.
+     */
+    LinkPtr = &Index[Index[EntryIdx].NameHash % TableSize].FirstEntry;
+    Count   = TableSize;
+    while (*LinkPtr != 0 && *LinkPtr <= TableSize && Count > 0)
+    {
+        if (*LinkPtr == (EntryIdx + 1))
+        {
+            *LinkPtr                  = Index[EntryIdx].NextEntry;
+            Index[EntryIdx].NextEntry = 0;
+            break;
+        }
+
+        LinkPtr = &Index[*LinkPtr - 1].NextEntry;
+        --Count;
+    }
+}
+
+/*********************************************************************/
+/*
+ * CFE_ResourceId_NameIndexAdd
+ *
+ * For complete API information, see prototype in header
+ */
+void CFE_ResourceId_NameIndexAdd(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 EntryIdx, const char *Name)
+{
+    uint32 Bucket;
+
+    if (Index == NULL || Name == NULL || EntryIdx >= TableSize || EntryIdx >= 0xFFFF)
+    {
+        return;
+    }
+
+    CFE_ResourceId_NameIndexRemove(Index, TableSize, EntryIdx);
+
+    Index[EntryIdx].NameHash  = CFE_ResourceId_NameHash(Name);
+    Bucket                    = Index[EntryIdx].NameHash % TableSize;
+    Index[EntryIdx].NextEntry = Index[Bucket].FirstEntry;
+    Index[Bucket].FirstEntry  = EntryIdx + 1;
+}
+
+/*********************************************************************/
+/*
+ * CFE_ResourceId_NameIndexFind
+ *
+ * For complete API information, see prototype in header
+ */
+int32 CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, const char *Name,
+        bool (*MatchFunc)(uint32, const char *), uint32 *EntryIdx)
+{
+    uint32 Hash;
+    uint32 Link;
+    uint32 Count;
+
+    if (Index == NULL || Name == NULL || MatchFunc == NULL || EntryIdx == NULL)
+    {
+        return CFE_ES_ERR_BUFFER;
+    }
+
+    if (TableSize == 0)
+    {
+        return CFE_ES_ERR_NAME_NOT_FOUND;
+    }
+
+    Hash  = CFE_ResourceId_NameHash(Name);
+    Link  = Index[Hash % TableSize].FirstEntry;
+    Count = TableSize;
+    while (Link != 0 && Link <= TableSize && Count > 0)
+    {
+        if (Index[Link - 1].NameHash == Hash && MatchFunc(Link - 1, Name))
+        {
+            *EntryIdx = Link - 1;
+            return CFE_SUCCESS;
+        }
+
+        Link = Index[Link - 1].NextEntry;
+        --Count;
+    }
+
+    return CFE_ES_ERR_NAME_NOT_FOUND;
+}
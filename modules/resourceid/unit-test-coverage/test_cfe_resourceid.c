@@ -21,6 +21,9 @@
 /*
  * Includes
  */
+#include <stdio.h>
+#include <string.h>
+
 #include "cfe.h"
 #include "cfe_resourceid_api.h"
 #include "cfe_resourceid_basevalue.h"
@@ -30,12 +33,75 @@
 
 #define UT_RESOURCEID_BASE_OFFSET 37
 #define UT_RESOURCEID_TEST_SLOTS  149 /* oddball for test purposes */
+#define UT_RESOURCEID_NAME_SLOTS  7
+
+static char UT_ResourceId_Names[UT_RESOURCEID_NAME_SLOTS][16];
+static CFE_ResourceId_NameIndexEntry_t UT_ResourceId_NameIndex[UT_RESOURCEID_NAME_SLOTS];
+static bool   UT_ResourceId_SlotUsed[UT_RESOURCEID_TEST_SLOTS];
+static uint32 UT_ResourceId_SlotMap[CFE_RESOURCEID_SLOTMAP_WORDS(UT_RESOURCEID_TEST_SLOTS)];
 
 static bool UT_ResourceId_CheckIdSlotUsed(CFE_ResourceId_t Id)
 {
     return UT_DEFAULT_IMPL(UT_ResourceId_CheckIdSlotUsed) != 0;
 }
 
+static bool UT_ResourceId_CheckSlotTableUsed(CFE_ResourceId_t Id)
+{
+    return UT_ResourceId_SlotUsed[CFE_ResourceId_GetSerial(Id) % UT_RESOURCEID_TEST_SLOTS];
+}
+
+static void UT_ResourceId_SetSlotUsed(uint32 Idx, bool IsUsed)
+{
+    UT_ResourceId_SlotUsed[Idx] = IsUsed;
+    CFE_ResourceId_SlotMapMark(UT_ResourceId_SlotMap, UT_RESOURCEID_TEST_SLOTS, Idx, IsUsed);
+}
+
+/* Checks that the slot map search finds the same ID as a search of every entry */
+static void UT_ResourceId_CheckFindNextFree(CFE_ResourceId_t StartId)
+{
+    CFE_ResourceId_t RefId;
+    CFE_ResourceId_t Id;
+
+    RefId = CFE_ResourceId_FindNext(StartId, UT_RESOURCEID_TEST_SLOTS, UT_ResourceId_CheckSlotTableUsed);
+    Id    = CFE_ResourceId_FindNextFree(StartId, UT_RESOURCEID_TEST_SLOTS, UT_ResourceId_SlotMap,
+                                     UT_ResourceId_CheckSlotTableUsed);
+    UtAssert_True(CFE_ResourceId_Equal(Id, RefId), "CFE_ResourceId_FindNextFree(%lx): expected=%lx, got=%lx",
+                  CFE_ResourceId_ToInteger(StartId), CFE_ResourceId_ToInteger(RefId), CFE_ResourceId_ToInteger(Id));
+}
+
+/* An entry of the test registry is in use if it has a name */
+static bool UT_ResourceId_NameMatch(uint32 Idx, const char *Name)
+{
+    return (UT_ResourceId_Names[Idx][0] != 0 && strcmp(Name, UT_ResourceId_Names[Idx]) == 0);
+}
+
+static void UT_ResourceId_SetName(uint32 TableSize, uint32 Idx, const char *Name)
+{
+    strncpy(UT_ResourceId_Names[Idx], Name, sizeof(UT_ResourceId_Names[Idx]) - 1);
+    CFE_ResourceId_NameIndexAdd(UT_ResourceId_NameIndex, TableSize, Idx, UT_ResourceId_Names[Idx]);
+}
+
+/* Checks that a name is found at the expected index, or not found if Idx is TableSize */
+static void UT_ResourceId_CheckFind(uint32 TableSize, const char *Name, uint32 Idx)
+{
+    uint32 TestIndex;
+    int32  status;
+
+    TestIndex = TableSize;
+    status = CFE_ResourceId_NameIndexFind(UT_ResourceId_NameIndex, TableSize, Name, UT_ResourceId_NameMatch, &TestIndex);
+    if (Idx < TableSize)
+    {
+        UtAssert_True(status == CFE_SUCCESS && TestIndex == Idx,
+                      "CFE_ResourceId_NameIndexFind(%s): status=%lx, expected=%lu, got=%lu", Name,
+                      (unsigned long)status, (unsigned long)Idx, (unsigned long)TestIndex);
+    }
+    else
+    {
+        UtAssert_True(status == CFE_ES_ERR_NAME_NOT_FOUND,
+                      "CFE_ResourceId_NameIndexFind(%s) not found: status=%lx", Name, (unsigned long)status);
+    }
+}
+
 
 void TestResourceID(void)
 {
@@ -175,7 +241,177 @@ void TestResourceID(void)
     UtAssert_INT32_EQ(CFE_ResourceId_ToIndex(Id, ~RefBase, 1, &TestIndex), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 }
 
+void TestNameIndex(void)
+{
+    /*
+     * Test cases for the name index, using a small test registry.
+     * The names are stored in the test registry before being indexed,
+     * and an entry is in use if its name is not empty.
+     */
+    char   Name[16];
+    uint32 i;
+    uint32 TestIndex;
+
+    memset(UT_ResourceId_Names, 0, sizeof(UT_ResourceId_Names));
+    memset(UT_ResourceId_NameIndex, 0, sizeof(UT_ResourceId_NameIndex));
+
+    /* An index which is all zero is empty */
+    UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, "Name0", UT_RESOURCEID_NAME_SLOTS);
+    UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, "", UT_RESOURCEID_NAME_SLOTS);
+
+    /* Fill the registry, so some names share a bucket */
+    for (i = 0; i < UT_RESOURCEID_NAME_SLOTS; ++i)
+    {
+        snprintf(Name, sizeof(Name), "Name%lu", (unsigned long)i);
+        UT_ResourceId_SetName(UT_RESOURCEID_NAME_SLOTS, i, Name);
+    }
+    for (i = 0; i < UT_RESOURCEID_NAME_SLOTS; ++i)
+    {
+        snprintf(Name, sizeof(Name), "Name%lu", (unsigned long)i);
+        UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, Name, i);
+    }
+    UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, "Name7", UT_RESOURCEID_NAME_SLOTS);
+
+    /* Setting a new name moves the entry */
+    UT_ResourceId_SetName(UT_RESOURCEID_NAME_SLOTS, 3, "Other");
+    UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, "Name3", UT_RESOURCEID_NAME_SLOTS);
+    UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, "Other", 3);
+
+    /* Adding an entry again under the same name does not duplicate it */
+    UT_ResourceId_SetName(UT_RESOURCEID_NAME_SLOTS, 4, "Name4");
+    UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, "Name4", 4);
+
+    /* A removed entry is not found, and removing it again has no effect */
+    CFE_ResourceId_NameIndexRemove(UT_ResourceId_NameIndex, UT_RESOURCEID_NAME_SLOTS, 5);
+    UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, "Name5", UT_RESOURCEID_NAME_SLOTS);
+    CFE_ResourceId_NameIndexRemove(UT_ResourceId_NameIndex, UT_RESOURCEID_NAME_SLOTS, 5);
+    for (i = 0; i < UT_RESOURCEID_NAME_SLOTS; ++i)
+    {
+        snprintf(Name, sizeof(Name), "Name%lu", (unsigned long)i);
+        if (i != 3 && i != 5)
+        {
+            UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, Name, i);
+        }
+    }
+
+    /* An entry which is not in use is not found, even if it is still in the index */
+    UT_ResourceId_Names[2][0] = 0;
+    UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, "Name2", UT_RESOURCEID_NAME_SLOTS);
+
+    /* A duplicate name in another entry is found once the first entry is not in use */
+    UT_ResourceId_SetName(UT_RESOURCEID_NAME_SLOTS, 5, "Name6");
+    UT_ResourceId_Names[6][0] = 0;
+    UT_ResourceId_CheckFind(UT_RESOURCEID_NAME_SLOTS, "Name6", 5);
+
+    /* A table of one entry has a single bucket */
+    memset(UT_ResourceId_Names, 0, sizeof(UT_ResourceId_Names));
+    memset(UT_ResourceId_NameIndex, 0, sizeof(UT_ResourceId_NameIndex));
+    UT_ResourceId_SetName(1, 0, "Single");
+    UT_ResourceId_CheckFind(1, "Single", 0);
+    UT_ResourceId_CheckFind(1, "Other", 1);
+
+    /* Validate off-nominal inputs */
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(NULL, 1, "Single", UT_ResourceId_NameMatch, &TestIndex),
+                      CFE_ES_ERR_BUFFER);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(UT_ResourceId_NameIndex, 1, NULL, UT_ResourceId_NameMatch, &TestIndex),
+                      CFE_ES_ERR_BUFFER);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(UT_ResourceId_NameIndex, 1, "Single", NULL, &TestIndex),
+                      CFE_ES_ERR_BUFFER);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(UT_ResourceId_NameIndex, 1, "Single", UT_ResourceId_NameMatch, NULL),
+                      CFE_ES_ERR_BUFFER);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(UT_ResourceId_NameIndex, 0, "Single", UT_ResourceId_NameMatch, &TestIndex),
+                      CFE_ES_ERR_NAME_NOT_FOUND);
+
+    CFE_ResourceId_NameIndexAdd(NULL, 1, 0, "Single");
+    CFE_ResourceId_NameIndexAdd(UT_ResourceId_NameIndex, 1, 0, NULL);
+    CFE_ResourceId_NameIndexAdd(UT_ResourceId_NameIndex, 1, 1, "Other");
+    CFE_ResourceId_NameIndexRemove(NULL, 1, 0);
+    CFE_ResourceId_NameIndexRemove(UT_ResourceId_NameIndex, 1, 1);
+    UT_ResourceId_CheckFind(1, "Single", 0);
+
+    /* A corrupt link ends the search */
+    UT_ResourceId_NameIndex[0].FirstEntry = 2;
+    UT_ResourceId_CheckFind(1, "Single", 1);
+    CFE_ResourceId_NameIndexRemove(UT_ResourceId_NameIndex, 1, 0);
+}
+
+void TestSlotMap(void)
+{
+    /*
+     * Test cases for CFE_ResourceId_FindNextFree(), which must always
+     * agree with CFE_ResourceId_FindNext() while the slot map is correct
+     */
+    CFE_ResourceId_t StartId;
+    CFE_ResourceId_t Id;
+    uint32           RefBase;
+    uint32           Idx;
+
+    memset(UT_ResourceId_SlotUsed, 0, sizeof(UT_ResourceId_SlotUsed));
+    memset(UT_ResourceId_SlotMap, 0, sizeof(UT_ResourceId_SlotMap));
+    RefBase = CFE_RESOURCEID_MAKE_BASE(UT_RESOURCEID_BASE_OFFSET);
+
+    /* A mix of used entries, including whole words of the map and the last entry */
+    for (Idx = 0; Idx < UT_RESOURCEID_TEST_SLOTS; ++Idx)
+    {
+        if ((Idx % 3) == 0 || (Idx >= 40 && Idx < 100) || Idx >= 140)
+        {
+            UT_ResourceId_SetSlotUsed(Idx, true);
+        }
+    }
+
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase));
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase + 38));
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase + 3 * UT_RESOURCEID_TEST_SLOTS + 120));
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase + 138));
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase + CFE_RESOURCEID_MAX - 20));
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase + CFE_RESOURCEID_MAX - 1));
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase + CFE_RESOURCEID_MAX));
+
+    /* Only one free entry, found across the serial number wrap */
+    for (Idx = 0; Idx < UT_RESOURCEID_TEST_SLOTS; ++Idx)
+    {
+        UT_ResourceId_SetSlotUsed(Idx, Idx != 5);
+    }
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase + CFE_RESOURCEID_MAX - 1));
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase + 5));
+
+    /* An entry which is used but not marked is checked, and then marked */
+    UT_ResourceId_SlotUsed[5] = true;
+    UT_ResourceId_SetSlotUsed(70, false);
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase));
+    UtAssert_True((UT_ResourceId_SlotMap[0] & (1U << 5)) != 0, "Used entry marked in slot map");
+
+    /* An entry which is free but still marked is found when the map is otherwise full */
+    UT_ResourceId_SlotUsed[70] = false;
+    UT_ResourceId_SlotMap[70 / 32] |= 1U << (70 % 32);
+    UT_ResourceId_CheckFindNextFree(CFE_ResourceId_FromInteger(RefBase + 100));
+    UtAssert_True((UT_ResourceId_SlotMap[70 / 32] & (1U << (70 % 32))) == 0, "Free entry cleared in slot map");
+
+    /* A full table */
+    UT_ResourceId_SetSlotUsed(70, true);
+    Id = CFE_ResourceId_FindNextFree(CFE_ResourceId_FromInteger(RefBase), UT_RESOURCEID_TEST_SLOTS,
+                                     UT_ResourceId_SlotMap, UT_ResourceId_CheckSlotTableUsed);
+    UtAssert_True(!CFE_ResourceId_IsDefined(Id), "CFE_ResourceId_FindNextFree() on full table");
+
+    /* Without a slot map every entry is checked */
+    UT_ResourceId_SetSlotUsed(148, false);
+    StartId = CFE_ResourceId_FromInteger(RefBase + 10);
+    Id = CFE_ResourceId_FindNextFree(StartId, UT_RESOURCEID_TEST_SLOTS, NULL, UT_ResourceId_CheckSlotTableUsed);
+    UtAssert_True(CFE_ResourceId_ToInteger(Id) == RefBase + 148, "CFE_ResourceId_FindNextFree() without slot map: got=%lx",
+                  CFE_ResourceId_ToInteger(Id));
+    Id = CFE_ResourceId_FindNextFree(StartId, 0, UT_ResourceId_SlotMap, UT_ResourceId_CheckSlotTableUsed);
+    UtAssert_True(!CFE_ResourceId_IsDefined(Id), "CFE_ResourceId_FindNextFree() on empty table");
+
+    /* Entries outside of the table are not marked */
+    CFE_ResourceId_SlotMapMark(UT_ResourceId_SlotMap, UT_RESOURCEID_TEST_SLOTS, UT_RESOURCEID_TEST_SLOTS, true);
+    UtAssert_True((UT_ResourceId_SlotMap[UT_RESOURCEID_TEST_SLOTS / 32] & (1U << (UT_RESOURCEID_TEST_SLOTS % 32))) == 0,
+                  "Entry outside of table not marked");
+    CFE_ResourceId_SlotMapMark(NULL, UT_RESOURCEID_TEST_SLOTS, 0, true);
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(TestResourceID, NULL, NULL, "Resource ID");
+    UtTest_Add(TestNameIndex, NULL, NULL, "Name Index");
+    UtTest_Add(TestSlotMap, NULL, NULL, "Slot Map");
 }